@@ -0,0 +1,135 @@
+#include <rad/Container/FlatHashMap.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+using FlatMap = rad::FlatHashMap<std::uint64_t, std::uint64_t>;
+using StdMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+using FlatStringMap = rad::FlatHashMap<std::string, std::uint64_t>;
+using StdStringMap = std::unordered_map<std::string, std::uint64_t>;
+
+// Random keys; keys[count, 2 * count) are never inserted and serve as misses.
+template <typename Key>
+std::vector<Key> MakeKeys(std::size_t count)
+{
+    std::mt19937_64 random(5);
+    std::vector<Key> keys(count * 2);
+    for (Key& key : keys)
+    {
+        if constexpr (std::is_same_v<Key, std::string>)
+        {
+            key = "key-" + std::to_string(random());
+        }
+        else
+        {
+            key = random();
+        }
+    }
+    return keys;
+}
+
+template <typename Map>
+Map MakeMap(const std::vector<typename Map::key_type>& keys, std::size_t count)
+{
+    Map map;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        map.emplace(keys[index], index);
+    }
+    return map;
+}
+
+// Inserts into an empty map, including the rehashes on the way.
+template <typename Map>
+void BM_HashMapInsert(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys<typename Map::key_type>(count);
+    for (auto _ : state)
+    {
+        Map map = MakeMap<Map>(keys, count);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+void BM_HashMapFindHit(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys<typename Map::key_type>(count);
+    const Map map = MakeMap<Map>(keys, count);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            sum += map.find(keys[index])->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+void BM_HashMapFindMiss(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys<typename Map::key_type>(count);
+    const Map map = MakeMap<Map>(keys, count);
+    for (auto _ : state)
+    {
+        std::size_t found = 0;
+        for (std::size_t index = count; index < keys.size(); ++index)
+        {
+            found += (map.find(keys[index]) != map.end()) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Erases every key from a full map; building the map is excluded from the timing.
+template <typename Map>
+void BM_HashMapErase(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys<typename Map::key_type>(count);
+    const Map full = MakeMap<Map>(keys, count);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Map map = full;
+        state.ResumeTiming();
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            map.erase(keys[index]);
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_HashMapInsert<StdMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapInsert<FlatMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapFindHit<StdMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapFindHit<FlatMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapFindMiss<StdMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapFindMiss<FlatMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapErase<StdMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapErase<FlatMap>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_HashMapInsert<StdStringMap>)->Arg(1 << 16);
+BENCHMARK(BM_HashMapInsert<FlatStringMap>)->Arg(1 << 16);
+BENCHMARK(BM_HashMapFindHit<StdStringMap>)->Arg(1 << 16);
+BENCHMARK(BM_HashMapFindHit<FlatStringMap>)->Arg(1 << 16);
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <rad/Container/FlatHashTable.h>
+
+#include <tuple>
+
+namespace rad
+{
+
+namespace detail
+{
+
+template <typename Key, typename Value>
+struct FlatHashMapPolicy
+{
+    using key_type = Key;
+    using value_type = std::pair<const Key, Value>;
+
+    static constexpr bool ConstIteration = false;
+
+    [[nodiscard]] static const Key& GetKey(const value_type& value) noexcept
+    {
+        return value.first;
+    }
+
+    [[nodiscard]] static bool ValueEqual(const value_type& left, const value_type& right)
+    {
+        return left.second == right.second;
+    }
+
+    // Moves the key out of its const member, as node handles do; source is destroyed right away.
+    static void Transfer(value_type* destination, value_type* source)
+    {
+        std::construct_at(destination, std::piecewise_construct,
+                          std::forward_as_tuple(std::move(const_cast<Key&>(source->first))),
+                          std::forward_as_tuple(std::move(source->second)));
+        std::destroy_at(source);
+    }
+}; // struct FlatHashMapPolicy
+
+} // namespace detail
+
+// Hash map that stores its elements inline in one open-addressing array (a Swiss table), so
+// lookups touch one group of control bytes and usually a single slot. Compared with
+// std::unordered_map, inserting may move elements and invalidates iterators and references;
+// erasing invalidates only the erased element.
+//
+// The default functors are rad::Hash and std::equal_to, or StringHash and std::equal_to<> for
+// string keys. When both functors define is_transparent, find, contains, count, erase, at,
+// operator[] and try_emplace accept any key type they understand (e.g. std::string_view for
+// std::string keys). The hash must spread entropy over all bits: the low 7 bits tag control bytes
+// and the rest select the probe position.
+template <typename Key, typename Value, typename Hash = detail::FlatHashDefaultHash<Key>,
+          typename KeyEqual = detail::FlatHashDefaultEqual<Key>>
+class FlatHashMap
+    : public detail::FlatHashTable<detail::FlatHashMapPolicy<Key, Value>, Hash, KeyEqual>
+{
+    using Base = detail::FlatHashTable<detail::FlatHashMapPolicy<Key, Value>, Hash, KeyEqual>;
+
+    template <typename K>
+    static constexpr bool IsTransparentKey = detail::FlatHashTransparent<Hash, KeyEqual> &&
+                                             !std::is_same_v<std::remove_cvref_t<K>, Key> &&
+                                             std::is_constructible_v<Key, K&&>;
+
+public:
+    using mapped_type = Value;
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::key_type;
+    using typename Base::size_type;
+    using typename Base::value_type;
+    template <typename K>
+    using KeyArg = typename Base::template KeyArg<K>;
+
+    using Base::Base;
+
+    FlatHashMap() = default;
+
+    template <std::input_iterator InputIt>
+    FlatHashMap(InputIt first, InputIt last, size_type capacity = 0, const Hash& hash = Hash(),
+                const KeyEqual& equal = KeyEqual()) :
+        Base(capacity, hash, equal)
+    {
+        insert(first, last);
+    }
+
+    FlatHashMap(std::initializer_list<value_type> values, size_type capacity = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()) :
+        FlatHashMap(values.begin(), values.end(), std::max(capacity, values.size()), hash, equal)
+    {
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    // Moves the key out of its const member, as Transfer does.
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return TryEmplaceImpl(std::move(const_cast<Key&>(value.first)), std::move(value.second));
+    }
+
+    template <typename P>
+        requires std::is_constructible_v<value_type, P&&>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return emplace(std::forward<P>(value));
+    }
+
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace(*first);
+        }
+    }
+
+    void insert(std::initializer_list<value_type> values) { insert(values.begin(), values.end()); }
+
+    // Builds the element only if its key is new. A key and a mapped value are used directly;
+    // other arguments construct a temporary pair to find the key first.
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        if constexpr (sizeof...(Args) == 2)
+        {
+            return EmplacePair(std::forward<Args>(args)...);
+        }
+        else
+        {
+            value_type value(std::forward<Args>(args)...);
+            return TryEmplaceImpl(std::move(const_cast<Key&>(value.first)),
+                                  std::move(value.second));
+        }
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return TryEmplaceImpl(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return TryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    // Looks up key without converting it and constructs a Key from it only when inserting.
+    template <typename K, typename... Args>
+        requires IsTransparentKey<K>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return TryEmplaceImpl(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value)
+    {
+        return InsertOrAssignImpl(key, std::forward<M>(value));
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& value)
+    {
+        return InsertOrAssignImpl(std::move(key), std::forward<M>(value));
+    }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+    Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+    template <typename K>
+        requires IsTransparentKey<K>
+    Value& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+    // Throws std::out_of_range if key is missing.
+    template <typename K = key_type>
+    [[nodiscard]] Value& at(const KeyArg<K>& key)
+    {
+        const iterator it = this->find(key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("FlatHashMap::at: key not found");
+        }
+        return it->second;
+    }
+
+    template <typename K = key_type>
+    [[nodiscard]] const Value& at(const KeyArg<K>& key) const
+    {
+        return const_cast<FlatHashMap*>(this)->at(key);
+    }
+
+private:
+    // key and args may refer into an element, as in map[map.at(other)], so when inserting may
+    // rehash, the new element is built before its slot is reserved.
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> TryEmplaceImpl(K&& key, Args&&... args)
+    {
+        if (this->InsertMayRehash()) [[unlikely]]
+        {
+            const iterator it = this->find(key);
+            if (it != this->end())
+            {
+                return {it, false};
+            }
+            value_type value(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+                             std::forward_as_tuple(std::forward<Args>(args)...));
+            const size_type index = this->FindOrPrepareInsert(value.first).first;
+            this->ConstructAt(index, std::piecewise_construct,
+                              std::forward_as_tuple(std::move(const_cast<Key&>(value.first))),
+                              std::forward_as_tuple(std::move(value.second)));
+            return {this->IteratorAt(index), true};
+        }
+
+        const auto [index, inserted] = this->FindOrPrepareInsert(key);
+        if (inserted)
+        {
+            this->ConstructAt(index, std::piecewise_construct,
+                              std::forward_as_tuple(std::forward<K>(key)),
+                              std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+        return {this->IteratorAt(index), inserted};
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> InsertOrAssignImpl(K&& key, M&& value)
+    {
+        const auto result = TryEmplaceImpl(std::forward<K>(key), std::forward<M>(value));
+        if (!result.second)
+        {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    template <typename First, typename Second>
+    std::pair<iterator, bool> EmplacePair(First&& first, Second&& second)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<First>, Key>)
+        {
+            return TryEmplaceImpl(std::forward<First>(first), std::forward<Second>(second));
+        }
+        else
+        {
+            value_type value(std::forward<First>(first), std::forward<Second>(second));
+            return TryEmplaceImpl(std::move(const_cast<Key&>(value.first)),
+                                  std::move(value.second));
+        }
+    }
+}; // class FlatHashMap
+
+} // namespace rad
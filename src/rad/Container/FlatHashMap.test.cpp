@@ -0,0 +1,276 @@
+#include <rad/Container/FlatHashMap.h>
+#include <rad/Container/FlatHashSet.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// Forces every key onto one probe sequence.
+struct CollidingHash
+{
+    std::size_t operator()(int) const noexcept { return 42; }
+};
+
+// Counts live instances so that tests can detect leaked or doubly destroyed elements.
+class Tracked
+{
+public:
+    static inline int liveCount = 0;
+
+    explicit Tracked(int value) : m_value(std::make_unique<int>(value)) { ++liveCount; }
+    Tracked(const Tracked& other) : m_value(std::make_unique<int>(*other.m_value)) { ++liveCount; }
+    Tracked(Tracked&& other) noexcept : m_value(std::move(other.m_value)) { ++liveCount; }
+    Tracked& operator=(const Tracked&) = delete;
+    ~Tracked() { --liveCount; }
+
+    [[nodiscard]] int Value() const { return *m_value; }
+
+private:
+    std::unique_ptr<int> m_value;
+}; // class Tracked
+
+} // namespace
+
+TEST(Container, FlatHashMatchesUnorderedMap)
+{
+    std::mt19937 random(3);
+    rad::FlatHashMap<std::uint32_t, std::uint32_t> map;
+    std::unordered_map<std::uint32_t, std::uint32_t> reference;
+    // A small key space mixes inserts of new keys, hits and erases, leaving deleted slots behind.
+    for (int step = 0; step < 200000; ++step)
+    {
+        const std::uint32_t key = random() % 5000;
+        switch (random() % 4)
+        {
+        case 0:
+        case 1:
+            EXPECT_EQ(map.insert_or_assign(key, step).second,
+                      reference.insert_or_assign(key, step).second);
+            break;
+        case 2:
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+            break;
+        default:
+        {
+            const auto it = map.find(key);
+            const auto expected = reference.find(key);
+            ASSERT_EQ(it == map.end(), expected == reference.end());
+            if (it != map.end())
+            {
+                EXPECT_EQ(it->second, expected->second);
+            }
+            break;
+        }
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+
+    std::size_t visited = 0;
+    for (const auto& [key, value] : map)
+    {
+        ASSERT_EQ(reference.at(key), value);
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+    EXPECT_LE(map.load_factor(), map.max_load_factor());
+}
+
+TEST(Container, FlatHashMapOperations)
+{
+    rad::FlatHashMap<int, std::string> map = {{1, "one"}, {2, "two"}};
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_THROW(static_cast<void>(map.at(3)), std::out_of_range);
+
+    map[3] = "three";
+    EXPECT_FALSE(map.try_emplace(3, "drei").second);
+    EXPECT_EQ(map[3], "three");
+    EXPECT_TRUE(map.emplace(4, "four").second);
+    EXPECT_FALSE(map.emplace(std::make_pair(4, std::string("vier"))).second);
+    EXPECT_FALSE(map.insert({1, "eins"}).second);
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_TRUE(map.contains(4));
+    EXPECT_EQ(map.count(5), 0u);
+
+    // erase(iterator) returns the next element, so every element can be erased in one pass.
+    std::size_t erased = 0;
+    for (auto it = map.begin(); it != map.end();)
+    {
+        it = (it->first % 2 == 0) ? map.erase(it) : std::next(it);
+        ++erased;
+    }
+    EXPECT_EQ(erased, 4u);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_FALSE(map.contains(2));
+    EXPECT_TRUE(map.contains(3));
+
+    rad::FlatHashMap<int, std::string> copy = map;
+    EXPECT_EQ(copy, map);
+    copy[1] = "uno";
+    EXPECT_NE(copy, map);
+    rad::FlatHashMap<int, std::string> moved = std::move(copy);
+    EXPECT_EQ(moved.at(1), "uno");
+    EXPECT_TRUE(copy.empty());
+    copy = moved;
+    EXPECT_EQ(copy, moved);
+}
+
+TEST(Container, FlatHashMapInsertFromElement)
+{
+    // Every key and value comes from an element, so inserts that rehash must not read them
+    // afterwards.
+    const auto name = [](int index)
+    { return "element " + std::to_string(index) + ", too long for the small-string buffer"; };
+    rad::FlatHashMap<std::string, std::string> map;
+    map.try_emplace(name(0), name(1));
+    for (int index = 1; index < 1000; ++index)
+    {
+        const std::string& previous = map.at(name(index - 1));
+        if (index % 2 == 0)
+        {
+            map[previous] = name(index + 1);
+        }
+        else
+        {
+            EXPECT_TRUE(map.try_emplace(previous, previous).second);
+            map.at(name(index)) = name(index + 1);
+        }
+    }
+    EXPECT_EQ(map.size(), 1000u);
+    for (int index = 0; index < 1000; ++index)
+    {
+        EXPECT_EQ(map.at(name(index)), name(index + 1));
+    }
+
+    std::pair<const std::string, std::string> value{name(-1), name(0)};
+    EXPECT_TRUE(map.insert(std::move(value)).second);
+    EXPECT_TRUE(value.first.empty());
+    EXPECT_EQ(map.at(name(-1)), name(0));
+}
+
+TEST(Container, FlatHashMapHeterogeneousLookup)
+{
+    rad::FlatHashMap<std::string, int> map;
+    map["alpha"] = 1;
+    map[std::string_view("beta")] = 2;
+    map.try_emplace(std::string_view("gamma"), 3);
+
+    const std::string_view key = "beta";
+    EXPECT_EQ(map.find(key)->second, 2);
+    EXPECT_TRUE(map.contains("alpha"));
+    EXPECT_EQ(map.at(std::string_view("gamma")), 3);
+    EXPECT_EQ(map.count(std::string_view("delta")), 0u);
+    EXPECT_EQ(map.erase(std::string_view("alpha")), 1u);
+    EXPECT_EQ(map.size(), 2u);
+
+    rad::FlatHashSet<std::string> set = {"x", "y"};
+    EXPECT_TRUE(set.contains(std::string_view("x")));
+    EXPECT_FALSE(set.contains("z"));
+}
+
+TEST(Container, FlatHashSetOperations)
+{
+    rad::FlatHashSet<int> set;
+    for (int value = 0; value < 1000; ++value)
+    {
+        EXPECT_TRUE(set.insert(value).second);
+    }
+    EXPECT_FALSE(set.insert(7).second);
+    EXPECT_EQ(set.size(), 1000u);
+    for (int value = 0; value < 1000; value += 2)
+    {
+        EXPECT_EQ(set.erase(value), 1u);
+    }
+    EXPECT_EQ(set.size(), 500u);
+    for (const int value : set)
+    {
+        EXPECT_EQ(value % 2, 1);
+    }
+    EXPECT_EQ(set, rad::FlatHashSet<int>(set.begin(), set.end()));
+
+    // Colliding hashes still find every key through the probe sequence.
+    rad::FlatHashSet<int, CollidingHash> colliding;
+    for (int value = 0; value < 100; ++value)
+    {
+        colliding.insert(value);
+    }
+    for (int value = 0; value < 100; value += 3)
+    {
+        colliding.erase(value);
+    }
+    for (int value = 0; value < 100; ++value)
+    {
+        EXPECT_EQ(colliding.contains(value), value % 3 != 0) << value;
+    }
+}
+
+TEST(Container, FlatHashCapacity)
+{
+    rad::FlatHashMap<int, int> map;
+    EXPECT_EQ(map.capacity(), 0u);
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_EQ(map.begin(), map.end());
+
+    map.reserve(1000);
+    const std::size_t capacity = map.capacity();
+    EXPECT_GE(capacity * 7 / 8, 1000u);
+    map[0] = 0;
+    const int* first = &map[0];
+    for (int key = 1; key < 1000; ++key)
+    {
+        map[key] = key;
+    }
+    // Reserved tables neither grow nor move their elements.
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(&map[0], first);
+
+    for (int key = 10; key < 1000; ++key)
+    {
+        map.erase(key);
+    }
+    map.rehash(0);
+    EXPECT_LT(map.capacity(), 32u);
+    for (int key = 0; key < 10; ++key)
+    {
+        EXPECT_EQ(map.at(key), key);
+    }
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    map.rehash(0);
+    EXPECT_EQ(map.capacity(), 0u);
+}
+
+TEST(Container, FlatHashElementLifetime)
+{
+    {
+        rad::FlatHashMap<int, Tracked> map;
+        for (int key = 0; key < 500; ++key)
+        {
+            map.try_emplace(key, key * 2);
+        }
+        for (int key = 0; key < 500; key += 5)
+        {
+            map.erase(key);
+        }
+        EXPECT_EQ(Tracked::liveCount, 400);
+        const rad::FlatHashMap<int, Tracked> copy = map;
+        EXPECT_EQ(Tracked::liveCount, 800);
+        EXPECT_EQ(copy.at(7).Value(), 14);
+        map.clear();
+        EXPECT_EQ(Tracked::liveCount, 400);
+    }
+    EXPECT_EQ(Tracked::liveCount, 0);
+}
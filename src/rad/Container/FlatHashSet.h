@@ -0,0 +1,106 @@
+#pragma once
+
+#include <rad/Container/FlatHashTable.h>
+
+namespace rad
+{
+
+namespace detail
+{
+
+template <typename Key>
+struct FlatHashSetPolicy
+{
+    using key_type = Key;
+    using value_type = Key;
+
+    // Elements are keys, so they are never modified in place.
+    static constexpr bool ConstIteration = true;
+
+    [[nodiscard]] static const Key& GetKey(const Key& value) noexcept { return value; }
+
+    [[nodiscard]] static bool ValueEqual(const Key&, const Key&) noexcept { return true; }
+
+    static void Transfer(Key* destination, Key* source)
+    {
+        std::construct_at(destination, std::move(*source));
+        std::destroy_at(source);
+    }
+}; // struct FlatHashSetPolicy
+
+} // namespace detail
+
+// Hash set counterpart of FlatHashMap, with the same storage, invalidation rules, default
+// functors and heterogeneous lookup.
+template <typename Key, typename Hash = detail::FlatHashDefaultHash<Key>,
+          typename KeyEqual = detail::FlatHashDefaultEqual<Key>>
+class FlatHashSet : public detail::FlatHashTable<detail::FlatHashSetPolicy<Key>, Hash, KeyEqual>
+{
+    using Base = detail::FlatHashTable<detail::FlatHashSetPolicy<Key>, Hash, KeyEqual>;
+
+public:
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::size_type;
+    using typename Base::value_type;
+
+    using Base::Base;
+
+    FlatHashSet() = default;
+
+    template <std::input_iterator InputIt>
+    FlatHashSet(InputIt first, InputIt last, size_type capacity = 0, const Hash& hash = Hash(),
+                const KeyEqual& equal = KeyEqual()) :
+        Base(capacity, hash, equal)
+    {
+        insert(first, last);
+    }
+
+    FlatHashSet(std::initializer_list<Key> values, size_type capacity = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()) :
+        FlatHashSet(values.begin(), values.end(), std::max(capacity, values.size()), hash, equal)
+    {
+    }
+
+    std::pair<iterator, bool> insert(const Key& value) { return InsertImpl(value); }
+    std::pair<iterator, bool> insert(Key&& value) { return InsertImpl(std::move(value)); }
+
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace(*first);
+        }
+    }
+
+    void insert(std::initializer_list<Key> values) { insert(values.begin(), values.end()); }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        if constexpr (sizeof...(Args) == 1 &&
+                      (std::is_same_v<std::remove_cvref_t<Args>, Key> && ...))
+        {
+            return InsertImpl(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return InsertImpl(Key(std::forward<Args>(args)...));
+        }
+    }
+
+private:
+    template <typename K>
+    std::pair<iterator, bool> InsertImpl(K&& value)
+    {
+        const auto [index, inserted] = this->FindOrPrepareInsert(value);
+        if (inserted)
+        {
+            this->ConstructAt(index, std::forward<K>(value));
+        }
+        return {this->IteratorAt(index), inserted};
+    }
+}; // class FlatHashSet
+
+} // namespace rad
@@ -0,0 +1,858 @@
+#pragma once
+
+#include <rad/Core/Hash.h>
+#include <rad/Core/Platform.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(RAD_ARCH_X86) && RAD_COMPILED_X86_SSE2
+#include <emmintrin.h>
+#define RAD_FLAT_HASH_SSE2
+#endif
+
+namespace rad
+{
+
+namespace detail
+{
+
+// Swiss table (https://abseil.io/about/design/swisstables): one control byte per slot holds
+// either the low 7 bits of the slot's hash (H2) or one of the special values below, and lookups
+// compare a whole group of control bytes against H2 at once.
+using FlatHashControl = std::int8_t;
+
+inline constexpr FlatHashControl FlatHashEmpty = -128;
+inline constexpr FlatHashControl FlatHashDeleted = -2;
+// Terminates iteration; sits after the last slot.
+inline constexpr FlatHashControl FlatHashSentinel = -1;
+
+// Set bits mark matching control bytes within a group of Width bytes; each byte owns 1 << Shift
+// bits.
+template <typename T, int Width, int Shift>
+class FlatHashBitMask
+{
+public:
+    explicit FlatHashBitMask(T mask) noexcept : m_mask(mask) {}
+
+    [[nodiscard]] explicit operator bool() const noexcept { return m_mask != 0; }
+
+    [[nodiscard]] std::size_t LowestIndex() const noexcept
+    {
+        return static_cast<std::size_t>(std::countr_zero(m_mask)) >> Shift;
+    }
+
+    // Number of unmatched bytes at the low and high end of the group.
+    [[nodiscard]] std::size_t TrailingZeros() const noexcept { return LowestIndex(); }
+
+    [[nodiscard]] std::size_t LeadingZeros() const noexcept
+    {
+        constexpr int ExtraBits = std::numeric_limits<T>::digits - (Width << Shift);
+        return static_cast<std::size_t>(std::countl_zero(m_mask) - ExtraBits) >> Shift;
+    }
+
+    void ClearLowest() noexcept { m_mask &= m_mask - 1; }
+
+private:
+    T m_mask;
+}; // class FlatHashBitMask
+
+#if defined(RAD_FLAT_HASH_SSE2)
+
+// Sixteen control bytes compared with SSE2, which every x86-64 target has.
+class FlatHashGroup
+{
+public:
+    static constexpr std::size_t Width = 16;
+
+    using BitMask = FlatHashBitMask<std::uint32_t, 16, 0>;
+
+    explicit FlatHashGroup(const FlatHashControl* control) noexcept :
+        m_control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control)))
+    {
+    }
+
+    [[nodiscard]] BitMask Match(std::uint8_t h2) const noexcept
+    {
+        return MoveMask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), m_control));
+    }
+
+    [[nodiscard]] BitMask MatchEmpty() const noexcept
+    {
+        return MoveMask(_mm_cmpeq_epi8(_mm_set1_epi8(FlatHashEmpty), m_control));
+    }
+
+    // Empty and deleted are the only values below the sentinel.
+    [[nodiscard]] BitMask MatchEmptyOrDeleted() const noexcept
+    {
+        return MoveMask(_mm_cmpgt_epi8(_mm_set1_epi8(FlatHashSentinel), m_control));
+    }
+
+private:
+    [[nodiscard]] static BitMask MoveMask(__m128i bytes) noexcept
+    {
+        return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(bytes)));
+    }
+
+    __m128i m_control;
+}; // class FlatHashGroup
+
+#else
+
+// Eight control bytes compared within a 64-bit word; the high bit of each byte reports a match.
+class FlatHashGroup
+{
+public:
+    static constexpr std::size_t Width = 8;
+
+    using BitMask = FlatHashBitMask<std::uint64_t, 8, 3>;
+
+    explicit FlatHashGroup(const FlatHashControl* control) noexcept
+    {
+        std::memcpy(&m_control, control, sizeof(m_control));
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            m_control = ByteSwap(m_control);
+        }
+    }
+
+    // May report a full slot whose H2 differs when a lower byte matched; callers compare keys.
+    [[nodiscard]] BitMask Match(std::uint8_t h2) const noexcept
+    {
+        const std::uint64_t bytes = m_control ^ (LowBits * h2);
+        return BitMask((bytes - LowBits) & ~bytes & HighBits);
+    }
+
+    // Empty has bit 1 clear; deleted and the sentinel have it set.
+    [[nodiscard]] BitMask MatchEmpty() const noexcept
+    {
+        return BitMask(m_control & ~(m_control << 6) & HighBits);
+    }
+
+    // Empty and deleted have bit 0 clear; the sentinel has it set.
+    [[nodiscard]] BitMask MatchEmptyOrDeleted() const noexcept
+    {
+        return BitMask(m_control & ~(m_control << 7) & HighBits);
+    }
+
+private:
+    static constexpr std::uint64_t LowBits = 0x0101010101010101ull;
+    static constexpr std::uint64_t HighBits = 0x8080808080808080ull;
+
+    [[nodiscard]] static std::uint64_t ByteSwap(std::uint64_t value) noexcept
+    {
+        std::uint64_t swapped = 0;
+        for (int index = 0; index < 8; ++index, value >>= 8)
+        {
+            swapped = (swapped << 8) | (value & 0xFF);
+        }
+        return swapped;
+    }
+
+    std::uint64_t m_control;
+}; // class FlatHashGroup
+
+#endif
+
+// Control bytes of tables that have never allocated: lookups see one group of empty slots.
+alignas(16) inline constexpr FlatHashControl FlatHashEmptyGroup[16] = {
+    FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty,
+    FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty,
+    FlatHashEmpty, FlatHashEmpty, FlatHashEmpty, FlatHashEmpty};
+
+// Default functors: strings hash and compare transparently, so maps keyed by std::string accept
+// std::string_view and C strings without building a temporary key.
+template <typename Key>
+using FlatHashDefaultHash =
+    std::conditional_t<std::is_convertible_v<const Key&, std::string_view>, StringHash, Hash<Key>>;
+
+template <typename Key>
+using FlatHashDefaultEqual =
+    std::conditional_t<std::is_convertible_v<const Key&, std::string_view>, std::equal_to<>,
+                       std::equal_to<Key>>;
+
+template <typename Hash, typename KeyEqual>
+concept FlatHashTransparent =
+    requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; };
+
+// Lookup key type: K when both functors are transparent, otherwise the key type itself. The
+// alias resolves to K directly, so K stays deducible.
+template <bool Transparent>
+struct FlatHashKeyArg
+{
+    template <typename K, typename Key>
+    using Type = Key;
+};
+
+template <>
+struct FlatHashKeyArg<true>
+{
+    template <typename K, typename Key>
+    using Type = K;
+};
+
+// Open-addressing storage shared by FlatHashMap and FlatHashSet. Policy supplies the stored
+// value_type, GetKey(value) and Transfer(destination, source), which move-constructs a value and
+// destroys its source.
+//
+// Capacity is zero or 2^k - 1 slots, followed in the control array by the sentinel and copies of
+// the first Width - 1 control bytes, so a group starting at any slot can be loaded unaligned.
+// Groups are probed quadratically and at most 7/8 of the slots are used.
+template <typename Policy, typename Hash, typename KeyEqual>
+class FlatHashTable
+{
+public:
+    using key_type = typename Policy::key_type;
+    using value_type = typename Policy::value_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+
+    template <typename K>
+    using KeyArg = typename FlatHashKeyArg<FlatHashTransparent<Hash, KeyEqual>>::template Type<
+        K, key_type>;
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+        Iterator() noexcept = default;
+
+        // iterator converts to const_iterator.
+        template <bool OtherConst>
+            requires(Const && !OtherConst)
+        Iterator(const Iterator<OtherConst>& other) noexcept :
+            m_control(other.m_control), m_slot(other.m_slot)
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return *m_slot; }
+        [[nodiscard]] pointer operator->() const noexcept { return m_slot; }
+
+        Iterator& operator++() noexcept
+        {
+            ++m_control;
+            ++m_slot;
+            SkipEmptyOrDeleted();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        [[nodiscard]] bool operator==(const Iterator& other) const noexcept
+        {
+            return m_control == other.m_control;
+        }
+
+    private:
+        friend class FlatHashTable;
+        template <bool>
+        friend class Iterator;
+
+        Iterator(const FlatHashControl* control, value_type* slot) noexcept :
+            m_control(control), m_slot(slot)
+        {
+        }
+
+        // Moves to the next full slot, or to end() at the sentinel.
+        void SkipEmptyOrDeleted() noexcept
+        {
+            while (*m_control < FlatHashSentinel)
+            {
+                ++m_control;
+                ++m_slot;
+            }
+            if (*m_control == FlatHashSentinel)
+            {
+                m_control = nullptr;
+                m_slot = nullptr;
+            }
+        }
+
+        const FlatHashControl* m_control = nullptr;
+        value_type* m_slot = nullptr;
+    }; // class Iterator
+
+    using iterator = Iterator<Policy::ConstIteration>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashTable() noexcept(std::is_nothrow_default_constructible_v<Hash> &&
+                             std::is_nothrow_default_constructible_v<KeyEqual>) = default;
+
+    explicit FlatHashTable(size_type capacity, const Hash& hash = Hash(),
+                           const KeyEqual& equal = KeyEqual()) :
+        m_hash(hash), m_equal(equal)
+    {
+        reserve(capacity);
+    }
+
+    FlatHashTable(const FlatHashTable& other) : m_hash(other.m_hash), m_equal(other.m_equal)
+    {
+        reserve(other.m_size);
+        try
+        {
+            for (const value_type& value : other)
+            {
+                const std::size_t hash = HashKey(Policy::GetKey(value));
+                ConstructAt(PrepareInsert(hash, FindInsertSlot(hash)), value);
+            }
+        }
+        catch (...)
+        {
+            DestroyAndDeallocate();
+            throw;
+        }
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept(std::is_nothrow_move_constructible_v<Hash> &&
+                                                 std::is_nothrow_move_constructible_v<KeyEqual>) :
+        m_control(std::exchange(other.m_control, const_cast<FlatHashControl*>(FlatHashEmptyGroup))),
+        m_slots(std::exchange(other.m_slots, nullptr)),
+        m_capacity(std::exchange(other.m_capacity, 0)),
+        m_size(std::exchange(other.m_size, 0)),
+        m_growthLeft(std::exchange(other.m_growthLeft, 0)),
+        m_hash(std::move(other.m_hash)),
+        m_equal(std::move(other.m_equal))
+    {
+    }
+
+    FlatHashTable& operator=(const FlatHashTable& other)
+    {
+        if (this != &other)
+        {
+            FlatHashTable copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept(
+        std::is_nothrow_move_constructible_v<Hash> &&
+        std::is_nothrow_move_constructible_v<KeyEqual>)
+    {
+        if (this != &other)
+        {
+            FlatHashTable moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~FlatHashTable() { DestroyAndDeallocate(); }
+
+    [[nodiscard]] iterator begin() noexcept
+    {
+        if (m_size == 0)
+        {
+            return end();
+        }
+        iterator it(m_control, m_slots);
+        it.SkipEmptyOrDeleted();
+        return it;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return const_cast<FlatHashTable*>(this)->begin();
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] iterator end() noexcept { return iterator(); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    // Number of slots; at most 7/8 of them are filled before the table grows.
+    [[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+
+    [[nodiscard]] size_type max_size() const noexcept
+    {
+        return std::numeric_limits<difference_type>::max() / sizeof(value_type);
+    }
+
+    [[nodiscard]] float load_factor() const noexcept
+    {
+        return (m_capacity == 0) ? 0.0f
+                                 : static_cast<float>(m_size) / static_cast<float>(m_capacity);
+    }
+
+    [[nodiscard]] float max_load_factor() const noexcept { return 7.0f / 8.0f; }
+
+    [[nodiscard]] hasher hash_function() const { return m_hash; }
+    [[nodiscard]] key_equal key_eq() const { return m_equal; }
+
+    // Destroys every element but keeps the slots for reuse.
+    void clear() noexcept
+    {
+        if (m_capacity == 0)
+        {
+            return;
+        }
+        DestroyElements();
+        ResetControl();
+        m_size = 0;
+    }
+
+    // Makes room for count elements without further rehashing.
+    void reserve(size_type count)
+    {
+        if (count > m_size + m_growthLeft)
+        {
+            Resize(NormalizeCapacity(GrowthToCapacity(count)));
+        }
+    }
+
+    // Rebuilds the table with at least count slots and room for the current elements, purging
+    // deleted slots. rehash(0) shrinks the table to fit.
+    void rehash(size_type count)
+    {
+        if (count == 0 && m_size == 0)
+        {
+            DestroyAndDeallocate();
+            m_control = const_cast<FlatHashControl*>(FlatHashEmptyGroup);
+            m_slots = nullptr;
+            m_capacity = 0;
+            m_growthLeft = 0;
+            return;
+        }
+        const size_type capacity =
+            NormalizeCapacity(std::max(count, GrowthToCapacity(m_size)));
+        if (count == 0 || capacity > m_capacity)
+        {
+            Resize(capacity);
+        }
+    }
+
+    // Lookups accept any key type when Hash and KeyEqual are both transparent.
+    template <typename K = key_type>
+    [[nodiscard]] iterator find(const KeyArg<K>& key)
+    {
+        const size_type index = FindIndex(key, HashKey(key));
+        return (index == NotFound) ? end() : IteratorAt(index);
+    }
+
+    template <typename K = key_type>
+    [[nodiscard]] const_iterator find(const KeyArg<K>& key) const
+    {
+        return const_cast<FlatHashTable*>(this)->find(key);
+    }
+
+    template <typename K = key_type>
+    [[nodiscard]] bool contains(const KeyArg<K>& key) const
+    {
+        return FindIndex(key, HashKey(key)) != NotFound;
+    }
+
+    template <typename K = key_type>
+    [[nodiscard]] size_type count(const KeyArg<K>& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    // Erasing never moves other elements, so iterators to them stay valid.
+    iterator erase(const_iterator position)
+    {
+        assert(position != end());
+        const auto index = static_cast<size_type>(position.m_control - m_control);
+        EraseAt(index);
+        iterator next(m_control + index + 1, m_slots + index + 1);
+        next.SkipEmptyOrDeleted();
+        return next;
+    }
+
+    iterator erase(iterator position)
+        requires(!Policy::ConstIteration)
+    {
+        return erase(const_iterator(position));
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        while (first != last)
+        {
+            first = erase(first);
+        }
+        return iterator(last.m_control, last.m_slot);
+    }
+
+    template <typename K = key_type>
+    size_type erase(const KeyArg<K>& key)
+    {
+        const size_type index = FindIndex(key, HashKey(key));
+        if (index == NotFound)
+        {
+            return 0;
+        }
+        EraseAt(index);
+        return 1;
+    }
+
+    void swap(FlatHashTable& other) noexcept(std::is_nothrow_swappable_v<Hash> &&
+                                             std::is_nothrow_swappable_v<KeyEqual>)
+    {
+        using std::swap;
+        swap(m_control, other.m_control);
+        swap(m_slots, other.m_slots);
+        swap(m_capacity, other.m_capacity);
+        swap(m_size, other.m_size);
+        swap(m_growthLeft, other.m_growthLeft);
+        swap(m_hash, other.m_hash);
+        swap(m_equal, other.m_equal);
+    }
+
+    friend void swap(FlatHashTable& left, FlatHashTable& right) noexcept(noexcept(left.swap(right)))
+    {
+        left.swap(right);
+    }
+
+    // Equal when both hold the same keys (and, for maps, the same mapped values).
+    [[nodiscard]] friend bool operator==(const FlatHashTable& left, const FlatHashTable& right)
+    {
+        if (left.size() != right.size())
+        {
+            return false;
+        }
+        for (const value_type& value : left)
+        {
+            const auto it = right.find(Policy::GetKey(value));
+            if (it == right.end() || !Policy::ValueEqual(value, *it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+protected:
+    static constexpr size_type NotFound = std::numeric_limits<size_type>::max();
+
+    template <typename K>
+    [[nodiscard]] std::size_t HashKey(const K& key) const
+    {
+        return static_cast<std::size_t>(m_hash(key));
+    }
+
+    [[nodiscard]] iterator IteratorAt(size_type index) noexcept
+    {
+        return iterator(m_control + index, m_slots + index);
+    }
+
+    [[nodiscard]] value_type* SlotAt(size_type index) noexcept { return m_slots + index; }
+
+    template <typename K>
+    [[nodiscard]] size_type FindIndex(const K& key, std::size_t hash) const
+    {
+        ProbeSequence probe(hash, m_capacity);
+        while (true)
+        {
+            const FlatHashGroup group(m_control + probe.Offset());
+            for (auto match = group.Match(H2(hash)); match; match.ClearLowest())
+            {
+                const size_type index = probe.Offset(match.LowestIndex());
+                if (m_equal(Policy::GetKey(m_slots[index]), key)) [[likely]]
+                {
+                    return index;
+                }
+            }
+            if (group.MatchEmpty()) [[likely]]
+            {
+                return NotFound;
+            }
+            probe.Next();
+        }
+    }
+
+    // Returns the index of key, or reserves a slot for it whose value the caller must construct
+    // with ConstructAt. The bool is true when the slot is new.
+    template <typename K>
+    [[nodiscard]] std::pair<size_type, bool> FindOrPrepareInsert(const K& key)
+    {
+        const std::size_t hash = HashKey(key);
+        const size_type index = FindIndex(key, hash);
+        if (index != NotFound)
+        {
+            return {index, false};
+        }
+        return {PrepareInsert(hash, FindInsertSlot(hash)), true};
+    }
+
+    // Whether reserving a slot for a new key may rehash, moving every element.
+    [[nodiscard]] bool InsertMayRehash() const noexcept { return m_growthLeft == 0; }
+
+    // Constructs the value of a slot reserved by FindOrPrepareInsert. If construction throws,
+    // the slot is released again.
+    template <typename... Args>
+    void ConstructAt(size_type index, Args&&... args)
+    {
+        try
+        {
+            std::construct_at(m_slots + index, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            SetControl(index, FlatHashDeleted);
+            --m_size;
+            throw;
+        }
+    }
+
+private:
+    // Visits groups at triangular-number offsets, which reach every group of a power-of-two
+    // table.
+    class ProbeSequence
+    {
+    public:
+        ProbeSequence(std::size_t hash, size_type mask) noexcept :
+            m_mask(mask), m_offset(H1(hash) & mask)
+        {
+        }
+
+        [[nodiscard]] size_type Offset() const noexcept { return m_offset; }
+        [[nodiscard]] size_type Offset(size_type index) const noexcept
+        {
+            return (m_offset + index) & m_mask;
+        }
+
+        void Next() noexcept
+        {
+            m_step += FlatHashGroup::Width;
+            m_offset = (m_offset + m_step) & m_mask;
+        }
+
+    private:
+        size_type m_mask;
+        size_type m_offset;
+        size_type m_step = 0;
+    }; // class ProbeSequence
+
+    [[nodiscard]] static std::size_t H1(std::size_t hash) noexcept { return hash >> 7; }
+    [[nodiscard]] static std::uint8_t H2(std::size_t hash) noexcept
+    {
+        return static_cast<std::uint8_t>(hash & 0x7F);
+    }
+
+    [[nodiscard]] static size_type NormalizeCapacity(size_type count) noexcept
+    {
+        return (count == 0) ? 1 : std::numeric_limits<size_type>::max() >> std::countl_zero(count);
+    }
+
+    // Largest element count a table of the given capacity holds before it grows; a small table
+    // of exactly one portable group keeps one slot empty so that probing terminates.
+    [[nodiscard]] static size_type CapacityToGrowth(size_type capacity) noexcept
+    {
+        if (FlatHashGroup::Width == 8 && capacity == 7)
+        {
+            return 6;
+        }
+        return capacity - capacity / 8;
+    }
+
+    [[nodiscard]] static size_type GrowthToCapacity(size_type growth) noexcept
+    {
+        if (FlatHashGroup::Width == 8 && growth == 7)
+        {
+            return 8;
+        }
+        return (growth == 0) ? 0 : growth + (growth - 1) / 7;
+    }
+
+    [[nodiscard]] size_type ControlSize() const noexcept
+    {
+        return m_capacity + FlatHashGroup::Width;
+    }
+
+    [[nodiscard]] static size_type SlotOffset(size_type capacity) noexcept
+    {
+        const size_type controlSize = capacity + FlatHashGroup::Width;
+        return (controlSize + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+    }
+
+    [[nodiscard]] static size_type AllocationSize(size_type capacity) noexcept
+    {
+        return SlotOffset(capacity) + capacity * sizeof(value_type);
+    }
+
+    static constexpr std::align_val_t AllocationAlignment{
+        std::max(alignof(value_type), alignof(std::max_align_t))};
+
+    // Writes control byte index and its copy past the sentinel.
+    void SetControl(size_type index, FlatHashControl value) noexcept
+    {
+        constexpr size_type ClonedBytes = FlatHashGroup::Width - 1;
+        m_control[index] = value;
+        m_control[((index - ClonedBytes) & m_capacity) + (ClonedBytes & m_capacity)] = value;
+    }
+
+    void ResetControl() noexcept
+    {
+        std::memset(m_control, static_cast<unsigned char>(FlatHashEmpty), ControlSize());
+        m_control[m_capacity] = FlatHashSentinel;
+        m_growthLeft = CapacityToGrowth(m_capacity);
+    }
+
+    // First empty or deleted slot on the probe sequence of hash.
+    [[nodiscard]] size_type FindInsertSlot(std::size_t hash) const noexcept
+    {
+        ProbeSequence probe(hash, m_capacity);
+        while (true)
+        {
+            const FlatHashGroup group(m_control + probe.Offset());
+            if (const auto match = group.MatchEmptyOrDeleted())
+            {
+                return probe.Offset(match.LowestIndex());
+            }
+            probe.Next();
+        }
+    }
+
+    // Claims slot index for an element with the given hash, growing the table first if the
+    // slot is empty and the growth budget is spent.
+    [[nodiscard]] size_type PrepareInsert(std::size_t hash, size_type index)
+    {
+        if (m_growthLeft == 0 && m_control[index] != FlatHashDeleted)
+        {
+            GrowOrPurge();
+            index = FindInsertSlot(hash);
+        }
+        if (m_control[index] == FlatHashEmpty)
+        {
+            --m_growthLeft;
+        }
+        SetControl(index, static_cast<FlatHashControl>(H2(hash)));
+        ++m_size;
+        return index;
+    }
+
+    // Doubles the table, or rebuilds it at the same size when deleted slots rather than
+    // elements exhausted the growth budget.
+    void GrowOrPurge()
+    {
+        if (m_capacity > FlatHashGroup::Width && m_size * 32 <= m_capacity * 25)
+        {
+            Resize(m_capacity);
+        }
+        else
+        {
+            Resize(m_capacity * 2 + 1);
+        }
+    }
+
+    void Resize(size_type capacity)
+    {
+        assert(capacity >= m_size && std::has_single_bit(capacity + 1));
+        FlatHashControl* oldControl = m_control;
+        value_type* oldSlots = m_slots;
+        const size_type oldCapacity = m_capacity;
+
+        auto* memory =
+            static_cast<std::byte*>(::operator new(AllocationSize(capacity), AllocationAlignment));
+        m_control = reinterpret_cast<FlatHashControl*>(memory);
+        m_slots = reinterpret_cast<value_type*>(memory + SlotOffset(capacity));
+        m_capacity = capacity;
+        ResetControl();
+        m_growthLeft -= m_size;
+
+        for (size_type index = 0; index < oldCapacity; ++index)
+        {
+            if (oldControl[index] >= 0)
+            {
+                const std::size_t hash = HashKey(Policy::GetKey(oldSlots[index]));
+                const size_type target = FindInsertSlot(hash);
+                SetControl(target, static_cast<FlatHashControl>(H2(hash)));
+                Policy::Transfer(m_slots + target, oldSlots + index);
+            }
+        }
+        if (oldCapacity > 0)
+        {
+            ::operator delete(oldControl, AllocationSize(oldCapacity), AllocationAlignment);
+        }
+    }
+
+    void EraseAt(size_type index) noexcept
+    {
+        std::destroy_at(m_slots + index);
+        --m_size;
+        // A slot can become empty again only if no probe sequence ever passed over it, which
+        // holds when every group window containing it still has an empty slot.
+        const size_type before = (index - FlatHashGroup::Width) & m_capacity;
+        const auto emptyAfter = FlatHashGroup(m_control + index).MatchEmpty();
+        const auto emptyBefore = FlatHashGroup(m_control + before).MatchEmpty();
+        const bool wasNeverFull =
+            emptyBefore && emptyAfter &&
+            emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros() < FlatHashGroup::Width;
+        SetControl(index, wasNeverFull ? FlatHashEmpty : FlatHashDeleted);
+        if (wasNeverFull)
+        {
+            ++m_growthLeft;
+        }
+    }
+
+    void DestroyElements() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (size_type index = 0; index < m_capacity; ++index)
+            {
+                if (m_control[index] >= 0)
+                {
+                    std::destroy_at(m_slots + index);
+                }
+            }
+        }
+    }
+
+    void DestroyAndDeallocate() noexcept
+    {
+        if (m_capacity == 0)
+        {
+            return;
+        }
+        DestroyElements();
+        ::operator delete(m_control, AllocationSize(m_capacity), AllocationAlignment);
+    }
+
+    // Tables without slots share the read-only empty group; nothing writes to it because
+    // inserting grows the table first.
+    FlatHashControl* m_control = const_cast<FlatHashControl*>(FlatHashEmptyGroup);
+    value_type* m_slots = nullptr;
+    size_type m_capacity = 0;
+    size_type m_size = 0;
+    size_type m_growthLeft = 0;
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_equal;
+}; // class FlatHashTable
+
+} // namespace detail
+
+} // namespace rad
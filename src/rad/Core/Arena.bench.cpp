@@ -0,0 +1,86 @@
+#include <rad/Core/Arena.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t BatchSize = 1024;
+
+// Request-scoped pattern: many small allocations, then everything is freed together.
+void BM_ArenaAllocate(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    rad::Arena arena;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < BatchSize; ++i)
+        {
+            benchmark::DoNotOptimize(arena.Allocate(size));
+        }
+        arena.Reset();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BatchSize));
+}
+
+void BM_RadAllocate(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<void*> pointers(BatchSize);
+    for (auto _ : state)
+    {
+        for (void*& ptr : pointers)
+        {
+            ptr = rad::Allocate(size);
+            benchmark::DoNotOptimize(ptr);
+        }
+        for (void* ptr : pointers)
+        {
+            rad::Free(ptr);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BatchSize));
+}
+
+void BM_ArenaPmrVector(benchmark::State& state)
+{
+    rad::Arena arena;
+    for (auto _ : state)
+    {
+        {
+            rad::ArenaMemoryResource resource{arena};
+            std::pmr::vector<std::pmr::vector<int>> rows{&resource};
+            for (int row = 0; row < 64; ++row)
+            {
+                rows.emplace_back(16, row);
+            }
+            benchmark::DoNotOptimize(rows.data());
+        }
+        arena.Reset();
+    }
+}
+
+void BM_StdVector(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<std::vector<int>> rows;
+        for (int row = 0; row < 64; ++row)
+        {
+            rows.emplace_back(16, row);
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ArenaAllocate)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(BM_RadAllocate)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(BM_ArenaPmrVector);
+BENCHMARK(BM_StdVector);
@@ -0,0 +1,161 @@
+#include <rad/Core/Arena.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace rad
+{
+
+struct alignas(std::max_align_t) Arena::Chunk
+{
+    Chunk* next = nullptr;
+    // Total size including this header.
+    std::size_t size = 0;
+
+    [[nodiscard]] std::byte* Begin() noexcept { return reinterpret_cast<std::byte*>(this + 1); }
+    [[nodiscard]] std::byte* End() noexcept { return reinterpret_cast<std::byte*>(this) + size; }
+};
+
+Arena::Arena(std::size_t chunkSize) noexcept :
+    m_chunkSize(std::max(chunkSize, sizeof(Chunk) * 2))
+{
+}
+
+Arena::~Arena()
+{
+    Release();
+}
+
+void Arena::Reset() noexcept
+{
+    RetireCounters();
+    m_current = nullptr;
+    m_cursor = nullptr;
+    m_end = nullptr;
+    if (m_head != nullptr)
+    {
+        EnterChunk(m_head);
+    }
+}
+
+void Arena::Release() noexcept
+{
+    RetireCounters();
+    Chunk* chunk = m_head;
+    while (chunk != nullptr)
+    {
+        Chunk* next = chunk->next;
+        const std::size_t size = chunk->size;
+        FreeAligned(chunk);
+        GetGlobalMemoryTracker().RecordArenaChunkDeallocation(size);
+        chunk = next;
+    }
+    m_head = nullptr;
+    m_current = nullptr;
+    m_cursor = nullptr;
+    m_end = nullptr;
+    m_statistics.arenaChunkCount = 0;
+    m_statistics.arenaChunkBytes = 0;
+}
+
+MemoryStatistics Arena::Statistics() const noexcept
+{
+    MemoryStatistics statistics = m_statistics;
+    statistics.activeAllocationCount = m_allocationCount;
+    statistics.activeBytes = m_allocatedBytes;
+    statistics.peakAllocationCount = std::max(statistics.peakAllocationCount, m_allocationCount);
+    statistics.peakBytes = std::max(statistics.peakBytes, m_allocatedBytes);
+    statistics.totalAllocationCount += m_allocationCount;
+    statistics.totalAllocatedBytes += m_allocatedBytes;
+    return statistics;
+}
+
+void* Arena::AllocateSlow(std::size_t size, std::size_t alignment,
+                          std::source_location location) noexcept
+{
+    if ((size == 0) || !IsPowerOfTwo(alignment))
+    {
+        return nullptr;
+    }
+
+    // Walk chunks kept by Reset before acquiring a new one.
+    while ((m_current != nullptr) && (m_current->next != nullptr))
+    {
+        EnterChunk(m_current->next);
+        if (void* ptr = TryBump(size, alignment))
+        {
+            return ptr;
+        }
+    }
+
+    const std::size_t padding = std::max(alignment, alignof(std::max_align_t)) - 1;
+    if (size > std::numeric_limits<std::size_t>::max() - sizeof(Chunk) - padding)
+    {
+        return nullptr;
+    }
+    const std::size_t chunkSize = std::max(m_chunkSize, sizeof(Chunk) + padding + size);
+    void* memory = AllocateAligned(chunkSize, alignof(Chunk), location);
+    if (memory == nullptr)
+    {
+        return nullptr;
+    }
+    GetGlobalMemoryTracker().RecordArenaChunkAllocation(chunkSize);
+    ++m_statistics.arenaChunkCount;
+    m_statistics.arenaChunkBytes += chunkSize;
+
+    Chunk* chunk = ::new (memory) Chunk{nullptr, chunkSize};
+    if (m_current != nullptr)
+    {
+        m_current->next = chunk;
+    }
+    else
+    {
+        m_head = chunk;
+    }
+    EnterChunk(chunk);
+    return TryBump(size, alignment);
+}
+
+void Arena::EnterChunk(Chunk* chunk) noexcept
+{
+    m_current = chunk;
+    m_cursor = chunk->Begin();
+    m_end = chunk->End();
+}
+
+void Arena::RetireCounters() noexcept
+{
+    m_statistics.peakAllocationCount =
+        std::max(m_statistics.peakAllocationCount, m_allocationCount);
+    m_statistics.peakBytes = std::max(m_statistics.peakBytes, m_allocatedBytes);
+    m_statistics.totalAllocationCount += m_allocationCount;
+    m_statistics.totalAllocatedBytes += m_allocatedBytes;
+    m_allocationCount = 0;
+    m_allocatedBytes = 0;
+}
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    // memory_resource must return a usable pointer even for zero-byte requests.
+    void* ptr = m_arena.Allocate(std::max(bytes, std::size_t{1}), alignment);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void ArenaMemoryResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+    static_cast<void>(ptr);
+    static_cast<void>(bytes);
+    static_cast<void>(alignment);
+}
+
+bool ArenaMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    const auto* resource = dynamic_cast<const ArenaMemoryResource*>(&other);
+    return (resource != nullptr) && (&resource->m_arena == &m_arena);
+}
+
+} // namespace rad
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <rad/Core/Integer.h>
+#include <rad/Core/Memory.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <source_location>
+#include <type_traits>
+#include <utility>
+
+namespace rad
+{
+
+// Monotonic bump allocator. Memory is carved from chunks obtained through AllocateAligned (so
+// chunks appear in the MemoryTracker) and is only reclaimed all at once by Reset or Release.
+// Destructors of objects placed in an arena are never run. Not thread-safe.
+class Arena
+{
+public:
+    static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+    explicit Arena(std::size_t chunkSize = DefaultChunkSize) noexcept;
+    ~Arena();
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Returns nullptr for zero size or allocation failure. alignment must be a power of two.
+    // Requests larger than the chunk size get a dedicated chunk.
+    [[nodiscard]] void* Allocate(
+        std::size_t size, std::size_t alignment = alignof(std::max_align_t),
+        std::source_location location = std::source_location::current()) noexcept
+    {
+        assert(IsPowerOfTwo(alignment));
+        void* ptr = TryBump(size, alignment);
+        if (ptr == nullptr)
+        {
+            ptr = AllocateSlow(size, alignment, location);
+            if (ptr == nullptr)
+            {
+                return nullptr;
+            }
+        }
+        ++m_allocationCount;
+        m_allocatedBytes += size;
+        return ptr;
+    }
+
+    // Constructs an object in the arena; returns nullptr on allocation failure.
+    template <typename T, typename... Args>
+    [[nodiscard]] T* New(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena never runs destructors");
+        void* ptr = Allocate(sizeof(T), alignof(T));
+        return ptr != nullptr ? ::new (ptr) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Frees every allocation in O(1); chunks are kept and reused by later allocations.
+    void Reset() noexcept;
+    // Frees every allocation and returns all chunks to the system.
+    void Release() noexcept;
+
+    [[nodiscard]] std::size_t ChunkSize() const noexcept { return m_chunkSize; }
+    // Active values cover allocations since the last Reset; arena chunk values describe the
+    // chunks this arena currently holds.
+    [[nodiscard]] MemoryStatistics Statistics() const noexcept;
+
+private:
+    struct Chunk;
+
+    // Carves size bytes from the current chunk, or returns nullptr if they do not fit.
+    [[nodiscard]] void* TryBump(std::size_t size, std::size_t alignment) noexcept
+    {
+        const std::uintptr_t cursor = reinterpret_cast<std::uintptr_t>(m_cursor);
+        const std::uintptr_t aligned = (cursor + alignment - 1) & ~(alignment - 1);
+        const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(m_end);
+        if ((size == 0) || (aligned < cursor) || (aligned > end) || (size > end - aligned))
+        {
+            return nullptr;
+        }
+        m_cursor = reinterpret_cast<std::byte*>(aligned + size);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    [[nodiscard]] void* AllocateSlow(std::size_t size, std::size_t alignment,
+                                     std::source_location location) noexcept;
+    void EnterChunk(Chunk* chunk) noexcept;
+    void RetireCounters() noexcept;
+
+    std::size_t m_chunkSize;
+    Chunk* m_head = nullptr;
+    Chunk* m_current = nullptr;
+    std::byte* m_cursor = nullptr;
+    std::byte* m_end = nullptr;
+    // Allocations since the last Reset; folded into m_statistics by RetireCounters.
+    std::size_t m_allocationCount = 0;
+    std::size_t m_allocatedBytes = 0;
+    MemoryStatistics m_statistics;
+}; // class Arena
+
+// std::pmr adapter so standard containers can allocate from an Arena. Deallocation is a no-op;
+// memory returns when the arena is reset or released.
+class ArenaMemoryResource : public std::pmr::memory_resource
+{
+public:
+    explicit ArenaMemoryResource(Arena& arena) noexcept :
+        m_arena(arena)
+    {
+    }
+
+    [[nodiscard]] Arena& GetArena() const noexcept { return m_arena; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    Arena& m_arena;
+}; // class ArenaMemoryResource
+
+} // namespace rad
@@ -0,0 +1,79 @@
+#include <rad/Core/Arena.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory_resource>
+#include <vector>
+
+TEST(Core, Arena)
+{
+    rad::Arena arena{1024};
+
+    // Allocations honor the requested alignment and do not overlap.
+    {
+        auto* first = static_cast<std::byte*>(arena.Allocate(24));
+        auto* second = static_cast<std::byte*>(arena.Allocate(40, 64));
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        EXPECT_TRUE(rad::IsAligned(first, alignof(std::max_align_t)));
+        EXPECT_TRUE(rad::IsAligned(second, 64));
+        EXPECT_GE(second, first + 24);
+        std::memset(first, 0x11, 24);
+        std::memset(second, 0x22, 40);
+        EXPECT_EQ(arena.Allocate(0), nullptr);
+    }
+
+    // Oversized requests get their own chunk.
+    {
+        void* large = arena.Allocate(4096);
+        ASSERT_NE(large, nullptr);
+        std::memset(large, 0x33, 4096);
+    }
+
+    const rad::MemoryStatistics statistics = arena.Statistics();
+    EXPECT_EQ(statistics.activeAllocationCount, 3u);
+    EXPECT_EQ(statistics.activeBytes, 24u + 40u + 4096u);
+    EXPECT_EQ(statistics.arenaChunkCount, 2u);
+    EXPECT_GE(statistics.arenaChunkBytes, 1024u + 4096u);
+
+    // Reset keeps the chunks and hands the same memory out again.
+    arena.Reset();
+    {
+        const rad::MemoryStatistics afterReset = arena.Statistics();
+        EXPECT_EQ(afterReset.activeAllocationCount, 0u);
+        EXPECT_EQ(afterReset.peakAllocationCount, 3u);
+        EXPECT_EQ(afterReset.totalAllocationCount, 3u);
+        EXPECT_EQ(afterReset.arenaChunkCount, 2u);
+        auto* value = arena.New<int>(7);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, 7);
+    }
+
+    arena.Release();
+    EXPECT_EQ(arena.Statistics().arenaChunkCount, 0u);
+}
+
+TEST(Core, ArenaMemoryResource)
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    const std::size_t chunksBefore = rad::GetGlobalMemoryTracker().Statistics().arenaChunkCount;
+#endif
+    {
+        rad::Arena arena;
+        rad::ArenaMemoryResource resource{arena};
+        std::pmr::vector<int> values{&resource};
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(values[999], 999);
+        EXPECT_GT(arena.Statistics().activeBytes, 1000 * sizeof(int));
+#if RAD_ENABLE_MEMORY_TRACKING
+        EXPECT_GT(rad::GetGlobalMemoryTracker().Statistics().arenaChunkCount, chunksBefore);
+#endif
+    }
+#if RAD_ENABLE_MEMORY_TRACKING
+    EXPECT_EQ(rad::GetGlobalMemoryTracker().Statistics().arenaChunkCount, chunksBefore);
+#endif
+}
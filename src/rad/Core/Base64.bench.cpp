@@ -0,0 +1,140 @@
+#include <rad/Core/Base64.h>
+#include <rad/System/CpuInfo.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+// The argument selects the rad::SimdLevel limit; unsupported levels are skipped.
+bool ApplySimdLevel(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return false;
+    }
+    rad::SetSimdLevelLimit(level);
+    return true;
+}
+
+std::vector<std::byte> MakePayload(std::size_t size)
+{
+    std::mt19937 random(1);
+    std::vector<std::byte> payload(size);
+    for (std::byte& value : payload)
+    {
+        value = static_cast<std::byte>(random());
+    }
+    return payload;
+}
+
+constexpr std::size_t PayloadSize = 1024 * 1024;
+
+void BM_EncodeBase64(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<std::byte> payload = MakePayload(PayloadSize);
+    for (auto _ : state)
+    {
+        std::string encoded = rad::EncodeBase64(payload);
+        benchmark::DoNotOptimize(encoded);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(PayloadSize));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void BM_DecodeBase64(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::string encoded = rad::EncodeBase64(MakePayload(PayloadSize));
+    for (auto _ : state)
+    {
+        auto decoded = rad::DecodeBase64(encoded);
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(encoded.size()));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// Streams the payload in 64 KiB chunks through one reused output buffer, the way a socket or
+// file writer would, so no per-call allocation is measured.
+constexpr std::size_t ChunkSize = 64 * 1024;
+
+void BM_Base64EncoderStreaming(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<std::byte> payload = MakePayload(PayloadSize);
+    std::vector<char> buffer(rad::Base64Encoder::EncodedSize(ChunkSize + 2));
+    for (auto _ : state)
+    {
+        rad::Base64Encoder encoder;
+        for (std::size_t offset = 0; offset < payload.size(); offset += ChunkSize)
+        {
+            encoder.Update(rad::Span<const std::byte>(payload.data() + offset, ChunkSize), buffer);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+        encoder.Finish(buffer);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(PayloadSize));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void BM_Base64DecoderStreaming(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::string encoded = rad::EncodeBase64(MakePayload(PayloadSize));
+    std::vector<std::byte> buffer(rad::Base64Decoder::MaxDecodedSize(ChunkSize + 3));
+    for (auto _ : state)
+    {
+        rad::Base64Decoder decoder;
+        for (std::size_t offset = 0; offset < encoded.size(); offset += ChunkSize)
+        {
+            const auto written =
+                decoder.Update(std::string_view(encoded).substr(offset, ChunkSize), buffer);
+            benchmark::DoNotOptimize(written);
+        }
+        const auto written = decoder.Finish(buffer);
+        benchmark::DoNotOptimize(written);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(encoded.size()));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                       rad::SimdLevel::AVX2, rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_EncodeBase64)->Apply(SimdLevels);
+BENCHMARK(BM_DecodeBase64)->Apply(SimdLevels);
+BENCHMARK(BM_Base64EncoderStreaming)->Apply(SimdLevels);
+BENCHMARK(BM_Base64DecoderStreaming)->Apply(SimdLevels);
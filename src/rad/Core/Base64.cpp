@@ -1,153 +1,791 @@
 #include <rad/Core/Base64.h>
+#include <rad/Core/Platform.h>
+#include <rad/System/CpuInfo.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 
+#if defined(RAD_ARCH_X86)
+#include <immintrin.h>
+#elif defined(RAD_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif
+
 namespace rad
 {
 namespace
 {
 
-constexpr std::string_view Base64Alphabet =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr std::uint8_t InvalidSextet = 0xFF;
+
+struct Alphabet
+{
+    std::string_view chars;
+    // Maps every byte value to its sextet, or InvalidSextet for bytes outside the alphabet.
+    std::array<std::uint8_t, 256> decodeTable;
+};
 
-[[nodiscard]] constexpr int DecodeBase64Character(char value) noexcept
+[[nodiscard]] constexpr Alphabet MakeAlphabet(std::string_view chars) noexcept
 {
-    if (value >= 'A' && value <= 'Z')
+    Alphabet alphabet = {chars, {}};
+    alphabet.decodeTable.fill(InvalidSextet);
+    for (std::size_t index = 0; index < chars.size(); ++index)
     {
-        return value - 'A';
+        alphabet.decodeTable[static_cast<unsigned char>(chars[index])] =
+            static_cast<std::uint8_t>(index);
     }
-    if (value >= 'a' && value <= 'z')
+    return alphabet;
+}
+
+constexpr Alphabet StandardAlphabet =
+    MakeAlphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+constexpr Alphabet UrlAlphabet =
+    MakeAlphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+
+[[nodiscard]] constexpr bool IsUrl(Base64Variant variant) noexcept
+{
+    return variant != Base64Variant::Standard;
+}
+
+[[nodiscard]] constexpr bool IsPadded(Base64Variant variant) noexcept
+{
+    return variant != Base64Variant::UrlNoPadding;
+}
+
+[[nodiscard]] constexpr const Alphabet& GetAlphabet(Base64Variant variant) noexcept
+{
+    return IsUrl(variant) ? UrlAlphabet : StandardAlphabet;
+}
+
+// Vector kernels handle a prefix of the input and leave the rest, including any padding, to the
+// scalar loops below. They are templated on the URL-safe alphabet. Encoders consume whole 3-byte
+// groups and return the bytes consumed. Decoders consume whole 4-character groups, stop before
+// the first block holding anything outside the alphabet, and return the characters consumed;
+// they may store up to 8 bytes past their output, which callers must leave room for.
+using EncodeKernel = std::size_t (*)(const std::uint8_t* input, std::size_t size,
+                                     char* output) noexcept;
+using DecodeKernel = std::size_t (*)(const char* input, std::size_t size,
+                                     std::uint8_t* output) noexcept;
+
+#if defined(RAD_ARCH_X86)
+
+// Muła's multiply-based split of 3-byte groups, pre-shuffled into 32-bit lanes, into one sextet
+// per byte.
+RAD_TARGET_SSE4_2 inline __m128i SplitSextets(__m128i input) noexcept
+{
+    const __m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)),
+                                         _mm_set1_epi32(0x04000040));
+    const __m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)),
+                                        _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(high, low);
+}
+
+// Per-range offsets from sextet to ASCII; ranges 11 and 12 hold the two alphabet-specific
+// characters.
+template <bool Url>
+RAD_TARGET_SSE4_2 inline __m128i AsciiOffsets() noexcept
+{
+    constexpr char Sextet62 = Url ? '-' : '+';
+    constexpr char Sextet63 = Url ? '_' : '/';
+    return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                         '0' - 52, '0' - 52, '0' - 52, '0' - 52, Sextet62 - 62, Sextet63 - 63, 'A',
+                         0, 0);
+}
+
+// Maps sextets to ASCII by adding a per-range offset selected with one shuffle.
+template <bool Url>
+RAD_TARGET_SSE4_2 inline __m128i SextetsToAscii(__m128i sextets) noexcept
+{
+    __m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+    const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets);
+    range = _mm_or_si128(range, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+    return _mm_add_epi8(sextets, _mm_shuffle_epi8(AsciiOffsets<Url>(), range));
+}
+
+template <bool Url>
+RAD_TARGET_SSE4_2 std::size_t EncodeSse4_2(const std::uint8_t* input, std::size_t size,
+                                          char* output) noexcept
+{
+    const __m128i groups = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    std::size_t offset = 0;
+    // Each step reads 16 bytes and consumes 12.
+    for (; size - offset >= 16; offset += 12, output += 16)
     {
-        return value - 'a' + 26;
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+        const __m128i sextets = SplitSextets(_mm_shuffle_epi8(bytes, groups));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), SextetsToAscii<Url>(sextets));
     }
-    if (value >= '0' && value <= '9')
+    return offset;
+}
+
+// Rewrites the URL-safe '-' and '_' as '+' and '/' so that the standard validation applies.
+// Returns false if chars holds a standard-only '+' or '/'.
+RAD_TARGET_SSE4_2 inline bool UrlToStandard(__m128i& chars) noexcept
+{
+    const __m128i isStandardOnly = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('+')),
+                                                _mm_cmpeq_epi8(chars, _mm_set1_epi8('/')));
+    if (!_mm_testz_si128(isStandardOnly, isStandardOnly))
     {
-        return value - '0' + 52;
+        return false;
     }
-    if (value == '+')
+    const __m128i isMinus = _mm_cmpeq_epi8(chars, _mm_set1_epi8('-'));
+    const __m128i isUnderscore = _mm_cmpeq_epi8(chars, _mm_set1_epi8('_'));
+    chars = _mm_sub_epi8(chars, _mm_and_si128(isMinus, _mm_set1_epi8('-' - '+')));
+    chars = _mm_sub_epi8(chars, _mm_and_si128(isUnderscore, _mm_set1_epi8('_' - '/')));
+    return true;
+}
+
+// Validates 16 characters and converts them to sextets; returns false if any is outside the
+// alphabet. Uses Muła's nibble lookups: a character is valid iff its two lookups share no bit.
+template <bool Url>
+RAD_TARGET_SSE4_2 inline bool AsciiToSextets(__m128i chars, __m128i& sextets) noexcept
+{
+    const __m128i lowMask =
+        _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                      0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i highMask =
+        _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                      0x10, 0x10, 0x10, 0x10);
+    const __m128i roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    if constexpr (Url)
     {
-        return 62;
+        if (!UrlToStandard(chars))
+        {
+            return false;
+        }
     }
-    if (value == '/')
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), nibbleMask);
+    const __m128i lowNibbles = _mm_and_si128(chars, nibbleMask);
+    if (!_mm_testz_si128(_mm_shuffle_epi8(lowMask, lowNibbles),
+                         _mm_shuffle_epi8(highMask, highNibbles)))
     {
-        return 63;
+        return false;
     }
-    return -1;
+    const __m128i isSlash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('/'));
+    sextets = _mm_add_epi8(chars, _mm_shuffle_epi8(roll, _mm_add_epi8(isSlash, highNibbles)));
+    return true;
 }
 
-} // namespace
+// Packs four sextets per 32-bit lane into three bytes, leaving them in the low 12 bytes.
+RAD_TARGET_SSE4_2 inline __m128i PackSextets(__m128i sextets) noexcept
+{
+    const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+    const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(words,
+                            _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
 
-std::string EncodeBase64(Span<const std::byte> data)
+template <bool Url>
+RAD_TARGET_SSE4_2 std::size_t DecodeSse4_2(const char* input, std::size_t size,
+                                          std::uint8_t* output) noexcept
 {
-    if (data.size() > std::numeric_limits<std::size_t>::max() / 4 * 3)
+    std::size_t offset = 0;
+    // Each step consumes 16 characters and stores 16 bytes, of which 12 are kept.
+    for (; size - offset >= 16; offset += 16, output += 12)
     {
-        throw std::length_error("Base64 input is too large");
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+        __m128i sextets;
+        if (!AsciiToSextets<Url>(chars, sextets))
+        {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), PackSextets(sextets));
     }
+    return offset;
+}
 
-    std::string encoded;
-    encoded.reserve((data.size() / 3 + (data.size() % 3 != 0)) * 4);
+template <bool Url>
+RAD_TARGET_AVX2 std::size_t EncodeAvx2(const std::uint8_t* input, std::size_t size,
+                                       char* output) noexcept
+{
+    const __m256i groups = _mm256_broadcastsi128_si256(
+        _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m256i offsets = _mm256_broadcastsi128_si256(AsciiOffsets<Url>());
+    std::size_t offset = 0;
+    // Each step reads 28 bytes, 12 per lane from two overlapping loads, and consumes 24.
+    for (; size - offset >= 28; offset += 24, output += 32)
+    {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+        const __m128i high =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset + 12));
+        const __m256i bytes =
+            _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1),
+                                groups);
+
+        const __m256i sextets = _mm256_or_si256(
+            _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)),
+                               _mm256_set1_epi32(0x04000040)),
+            _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)),
+                               _mm256_set1_epi32(0x01000010)));
+
+        __m256i range = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+        const __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets);
+        range = _mm256_or_si256(range, _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+        const __m256i chars = _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, range));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), chars);
+    }
+    return offset + EncodeSse4_2<Url>(input + offset, size - offset, output);
+}
+
+template <bool Url>
+RAD_TARGET_AVX2 std::size_t DecodeAvx2(const char* input, std::size_t size,
+                                       std::uint8_t* output) noexcept
+{
+    const __m256i lowMask = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                      0x1B, 0x1B, 0x1B, 0x1A));
+    const __m256i highMask = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                      0x10, 0x10, 0x10, 0x10));
+    const __m256i roll = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+    const __m256i lanePack = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
 
     std::size_t offset = 0;
-    while (data.size() - offset >= 3)
+    // Each step consumes 32 characters and stores 32 bytes, of which 24 are kept.
+    for (; size - offset >= 32; offset += 32, output += 24)
     {
-        const auto first = std::to_integer<unsigned int>(data[offset]);
-        const auto second = std::to_integer<unsigned int>(data[offset + 1]);
-        const auto third = std::to_integer<unsigned int>(data[offset + 2]);
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset));
+        if constexpr (Url)
+        {
+            // Same rewrite as UrlToStandard.
+            const __m256i isStandardOnly =
+                _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('+')),
+                                _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/')));
+            if (!_mm256_testz_si256(isStandardOnly, isStandardOnly))
+            {
+                break;
+            }
+            const __m256i isMinus = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('-'));
+            const __m256i isUnderscore = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_'));
+            chars = _mm256_sub_epi8(chars, _mm256_and_si256(isMinus, _mm256_set1_epi8('-' - '+')));
+            chars = _mm256_sub_epi8(chars,
+                                    _mm256_and_si256(isUnderscore, _mm256_set1_epi8('_' - '/')));
+        }
+        const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), nibbleMask);
+        const __m256i lowNibbles = _mm256_and_si256(chars, nibbleMask);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lowMask, lowNibbles),
+                                _mm256_shuffle_epi8(highMask, highNibbles)))
+        {
+            break;
+        }
+        const __m256i isSlash = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'));
+        const __m256i sextets = _mm256_add_epi8(
+            chars, _mm256_shuffle_epi8(roll, _mm256_add_epi8(isSlash, highNibbles)));
 
-        encoded.push_back(Base64Alphabet[first >> 2]);
-        encoded.push_back(Base64Alphabet[((first & 0x03u) << 4) | (second >> 4)]);
-        encoded.push_back(Base64Alphabet[((second & 0x0Fu) << 2) | (third >> 6)]);
-        encoded.push_back(Base64Alphabet[third & 0x3Fu]);
-        offset += 3;
+        const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        const __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        const __m256i packed = _mm256_permutevar8x32_epi32(
+            _mm256_shuffle_epi8(words, lanePack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), packed);
     }
+    return offset + DecodeSse4_2<Url>(input + offset, size - offset, output);
+}
 
-    const auto remaining = data.size() - offset;
-    if (remaining == 1)
+#elif defined(RAD_ARCH_AARCH64)
+
+template <bool Url>
+std::size_t EncodeNeon(const std::uint8_t* input, std::size_t size, char* output) noexcept
+{
+    const std::string_view chars = (Url ? UrlAlphabet : StandardAlphabet).chars;
+    const auto* alphabet = reinterpret_cast<const std::uint8_t*>(chars.data());
+    const uint8x16x4_t table = {vld1q_u8(alphabet), vld1q_u8(alphabet + 16),
+                                vld1q_u8(alphabet + 32), vld1q_u8(alphabet + 48)};
+    const uint8x16_t sextetMask = vdupq_n_u8(0x3F);
+    std::size_t offset = 0;
+    for (; size - offset >= 48; offset += 48, output += 64)
     {
-        const auto first = std::to_integer<unsigned int>(data[offset]);
-        encoded.push_back(Base64Alphabet[first >> 2]);
-        encoded.push_back(Base64Alphabet[(first & 0x03u) << 4]);
-        encoded.append("==");
+        // De-interleaving loads put the first, second and third byte of each group in separate
+        // registers, so splitting into sextets is plain shifts.
+        const uint8x16x3_t bytes = vld3q_u8(input + offset);
+        uint8x16x4_t chars;
+        chars.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        chars.val[1] = vandq_u8(
+            vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), sextetMask);
+        chars.val[2] = vandq_u8(
+            vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), sextetMask);
+        chars.val[3] = vandq_u8(bytes.val[2], sextetMask);
+        for (uint8x16_t& value : chars.val)
+        {
+            value = vqtbl4q_u8(table, value);
+        }
+        vst4q_u8(reinterpret_cast<std::uint8_t*>(output), chars);
     }
-    else if (remaining == 2)
+    return offset;
+}
+
+template <bool Url>
+std::size_t DecodeNeon(const char* input, std::size_t size, std::uint8_t* output) noexcept
+{
+    const std::uint8_t* table = (Url ? UrlAlphabet : StandardAlphabet).decodeTable.data();
+    const uint8x16x4_t lowTable = {vld1q_u8(table), vld1q_u8(table + 16), vld1q_u8(table + 32),
+                                   vld1q_u8(table + 48)};
+    const uint8x16x4_t highTable = {vld1q_u8(table + 64), vld1q_u8(table + 80),
+                                    vld1q_u8(table + 96), vld1q_u8(table + 112)};
+    std::size_t offset = 0;
+    for (; size - offset >= 64; offset += 64, output += 48)
     {
-        const auto first = std::to_integer<unsigned int>(data[offset]);
-        const auto second = std::to_integer<unsigned int>(data[offset + 1]);
-        encoded.push_back(Base64Alphabet[first >> 2]);
-        encoded.push_back(Base64Alphabet[((first & 0x03u) << 4) | (second >> 4)]);
-        encoded.push_back(Base64Alphabet[(second & 0x0Fu) << 2]);
-        encoded.push_back('=');
+        const uint8x16x4_t chars = vld4q_u8(reinterpret_cast<const std::uint8_t*>(input + offset));
+        uint8x16x4_t sextets;
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int i = 0; i < 4; ++i)
+        {
+            // Table lookups return zero past index 63, so each half only answers for its own
+            // range; bytes of 128 and above match neither and are rejected separately.
+            const uint8x16_t sextet =
+                vorrq_u8(vqtbl4q_u8(lowTable, chars.val[i]),
+                         vqtbl4q_u8(highTable, vsubq_u8(chars.val[i], vdupq_n_u8(64))));
+            invalid = vorrq_u8(invalid, vcgtq_u8(sextet, vdupq_n_u8(63)));
+            invalid = vorrq_u8(invalid, vcgeq_u8(chars.val[i], vdupq_n_u8(128)));
+            sextets.val[i] = sextet;
+        }
+        if (vmaxvq_u8(invalid) != 0)
+        {
+            break;
+        }
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(sextets.val[0], 2), vshrq_n_u8(sextets.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(sextets.val[1], 4), vshrq_n_u8(sextets.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(sextets.val[2], 6), sextets.val[3]);
+        vst3q_u8(output, bytes);
     }
+    return offset;
+}
 
-    return encoded;
+#endif
+
+template <bool Url>
+[[nodiscard]] EncodeKernel SelectEncodeKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+    case SimdLevel::AVX2:
+        return EncodeAvx2<Url>;
+    case SimdLevel::SSE4_2:
+        return EncodeSse4_2<Url>;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return EncodeNeon<Url>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <bool Url>
+[[nodiscard]] DecodeKernel SelectDecodeKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+    case SimdLevel::AVX2:
+        return DecodeAvx2<Url>;
+    case SimdLevel::SSE4_2:
+        return DecodeSse4_2<Url>;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return DecodeNeon<Url>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+// Encodes every whole 3-byte group of input and returns the bytes consumed.
+std::size_t EncodeGroups(const std::uint8_t* input, std::size_t size, char* output,
+                         Base64Variant variant) noexcept
+{
+    const std::string_view alphabet = GetAlphabet(variant).chars;
+    std::size_t offset = 0;
+    const EncodeKernel kernel =
+        IsUrl(variant) ? SelectEncodeKernel<true>() : SelectEncodeKernel<false>();
+    if (kernel != nullptr)
+    {
+        offset = kernel(input, size, output);
+        output += offset / 3 * 4;
+    }
+
+    for (; size - offset >= 3; offset += 3, output += 4)
+    {
+        const unsigned int first = input[offset];
+        const unsigned int second = input[offset + 1];
+        const unsigned int third = input[offset + 2];
+
+        output[0] = alphabet[first >> 2];
+        output[1] = alphabet[((first & 0x03u) << 4) | (second >> 4)];
+        output[2] = alphabet[((second & 0x0Fu) << 2) | (third >> 6)];
+        output[3] = alphabet[third & 0x3Fu];
+    }
+    return offset;
 }
 
-std::string EncodeBase64(std::string_view data)
+// Encodes the final 1 or 2 bytes and returns the characters written.
+std::size_t EncodeTail(const std::uint8_t* input, std::size_t size, char* output,
+                       Base64Variant variant) noexcept
 {
-    return EncodeBase64(AsBytes(data));
+    const std::string_view alphabet = GetAlphabet(variant).chars;
+    const unsigned int first = input[0];
+    const unsigned int second = (size == 2) ? input[1] : 0;
+    output[0] = alphabet[first >> 2];
+    output[1] = alphabet[((first & 0x03u) << 4) | (second >> 4)];
+    if (size == 2)
+    {
+        output[2] = alphabet[(second & 0x0Fu) << 2];
+    }
+    if (!IsPadded(variant))
+    {
+        return size + 1;
+    }
+    for (std::size_t index = size + 1; index < 4; ++index)
+    {
+        output[index] = '=';
+    }
+    return 4;
 }
 
-std::optional<std::vector<std::byte>> DecodeBase64(std::string_view data)
+// Decodes whole 4-character groups up to the first one holding anything outside the alphabet,
+// including padding, and returns the characters consumed. Never stores past size / 4 * 3 bytes.
+std::size_t DecodeGroups(const char* input, std::size_t size, std::uint8_t* output,
+                         Base64Variant variant) noexcept
 {
-    if (data.size() % 4 != 0)
+    const std::array<std::uint8_t, 256>& table = GetAlphabet(variant).decodeTable;
+    std::size_t offset = 0;
+    const DecodeKernel kernel =
+        IsUrl(variant) ? SelectDecodeKernel<true>() : SelectDecodeKernel<false>();
+    // Holding back the last 16 characters keeps the kernels' wide stores inside the output.
+    if (kernel != nullptr && size > 16)
+    {
+        offset = kernel(input, size - 16, output);
+        output += offset / 4 * 3;
+    }
+
+    for (; size - offset >= 4; offset += 4, output += 3)
+    {
+        const unsigned int first = table[static_cast<unsigned char>(input[offset])];
+        const unsigned int second = table[static_cast<unsigned char>(input[offset + 1])];
+        const unsigned int third = table[static_cast<unsigned char>(input[offset + 2])];
+        const unsigned int fourth = table[static_cast<unsigned char>(input[offset + 3])];
+        if ((first | second | third | fourth) > 0x3Fu)
+        {
+            break;
+        }
+        output[0] = static_cast<std::uint8_t>((first << 2) | (second >> 4));
+        output[1] = static_cast<std::uint8_t>(((second & 0x0Fu) << 4) | (third >> 2));
+        output[2] = static_cast<std::uint8_t>(((third & 0x03u) << 6) | fourth);
+    }
+    return offset;
+}
+
+// Decodes the last group of a stream: four characters ending in padding for padded variants, or
+// two to four characters for UrlNoPadding. Returns the bytes written, or nullopt if the group is
+// malformed or its unused trailing bits are not zero.
+std::optional<std::size_t> DecodeFinalGroup(std::string_view group, std::uint8_t* output,
+                                            Base64Variant variant) noexcept
+{
+    std::size_t length = group.size();
+    if (IsPadded(variant))
+    {
+        if (length != 4)
+        {
+            return std::nullopt;
+        }
+        if (group[3] == '=')
+        {
+            length = (group[2] == '=') ? 2 : 3;
+        }
+    }
+    if (length < 2 || length > 4)
     {
         return std::nullopt;
     }
 
-    std::vector<std::byte> decoded;
-    decoded.reserve(data.size() / 4 * 3);
+    const std::array<std::uint8_t, 256>& table = GetAlphabet(variant).decodeTable;
+    std::uint32_t bits = 0;
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        const std::uint8_t sextet = table[static_cast<unsigned char>(group[index])];
+        if (sextet == InvalidSextet)
+        {
+            return std::nullopt;
+        }
+        bits = (bits << 6) | sextet;
+    }
+
+    const std::size_t byteCount = length * 3 / 4;
+    const std::size_t unusedBits = length * 6 - byteCount * 8;
+    if ((bits & ((1u << unusedBits) - 1)) != 0)
+    {
+        return std::nullopt;
+    }
+    bits >>= unusedBits;
+    for (std::size_t index = byteCount; index-- > 0; bits >>= 8)
+    {
+        output[index] = static_cast<std::uint8_t>(bits);
+    }
+    return byteCount;
+}
+
+void CheckOutputSize(std::size_t available, std::size_t required)
+{
+    if (available < required)
+    {
+        throw std::length_error("Base64 output buffer is too small");
+    }
+}
+
+} // namespace
+
+std::string EncodeBase64(Span<const std::byte> data, Base64Variant variant)
+{
+    std::string encoded(Base64Encoder::EncodedSize(data.size(), variant), '\0');
+    const auto* input = reinterpret_cast<const std::uint8_t*>(data.data());
+    const std::size_t offset = EncodeGroups(input, data.size(), encoded.data(), variant);
+    if (offset < data.size())
+    {
+        EncodeTail(input + offset, data.size() - offset, encoded.data() + offset / 3 * 4,
+                   variant);
+    }
+    return encoded;
+}
+
+std::string EncodeBase64(std::string_view data, Base64Variant variant)
+{
+    return EncodeBase64(AsBytes(data), variant);
+}
+
+std::optional<std::vector<std::byte>> DecodeBase64(std::string_view data, Base64Variant variant)
+{
+    if (IsPadded(variant) ? (data.size() % 4 != 0) : (data.size() % 4 == 1))
+    {
+        return std::nullopt;
+    }
 
-    for (std::size_t offset = 0; offset < data.size(); offset += 4)
+    std::vector<std::byte> decoded(Base64Decoder::MaxDecodedSize(data.size()));
+    auto* output = reinterpret_cast<std::uint8_t*>(decoded.data());
+    const std::size_t offset = DecodeGroups(data.data(), data.size(), output, variant);
+    std::size_t size = offset / 4 * 3;
+    if (offset < data.size())
     {
-        const auto first = DecodeBase64Character(data[offset]);
-        const auto second = DecodeBase64Character(data[offset + 1]);
-        if (first < 0 || second < 0)
+        // Only the final group may hold padding or be short.
+        if (data.size() - offset > 4)
         {
             return std::nullopt;
         }
+        const std::optional<std::size_t> tailSize =
+            DecodeFinalGroup(data.substr(offset), output + size, variant);
+        if (!tailSize)
+        {
+            return std::nullopt;
+        }
+        size += *tailSize;
+    }
+    decoded.resize(size);
+    return decoded;
+}
+
+Base64Encoder::Base64Encoder(Base64Variant variant) noexcept :
+    m_variant(variant)
+{
+}
+
+std::size_t Base64Encoder::EncodedSize(std::size_t size, Base64Variant variant)
+{
+    if (size > std::numeric_limits<std::size_t>::max() / 4 * 3)
+    {
+        throw std::length_error("Base64 input is too large");
+    }
+    const std::size_t remaining = size % 3;
+    const std::size_t tailSize = (remaining == 0) ? 0 : IsPadded(variant) ? 4 : remaining + 1;
+    return size / 3 * 4 + tailSize;
+}
+
+std::size_t Base64Encoder::UpdateSize(std::size_t inputSize) const noexcept
+{
+    return inputSize / 3 * 4 + (inputSize % 3 + m_pendingSize) / 3 * 4;
+}
+
+std::size_t Base64Encoder::FinishSize() const noexcept
+{
+    if (m_pendingSize == 0)
+    {
+        return 0;
+    }
+    return IsPadded(m_variant) ? 4 : m_pendingSize + 1;
+}
 
-        const bool isLastGroup = offset + 4 == data.size();
-        if (data[offset + 2] == '=')
+std::size_t Base64Encoder::Update(Span<const std::byte> input, Span<char> output)
+{
+    CheckOutputSize(output.size(), UpdateSize(input.size()));
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(input.data());
+    std::size_t size = input.size();
+    char* cursor = output.data();
+
+    if (m_pendingSize > 0)
+    {
+        if (m_pendingSize + size < 3)
         {
-            if (!isLastGroup || data[offset + 3] != '=' || (second & 0x0F) != 0)
-            {
-                return std::nullopt;
-            }
+            std::copy_n(bytes, size, m_pending.begin() + m_pendingSize);
+            m_pendingSize += size;
+            return 0;
+        }
+        std::array<std::uint8_t, 3> group = {};
+        const std::size_t taken = group.size() - m_pendingSize;
+        std::copy_n(m_pending.begin(), m_pendingSize, group.begin());
+        std::copy_n(bytes, taken, group.begin() + m_pendingSize);
+        cursor += EncodeGroups(group.data(), group.size(), cursor, m_variant) / 3 * 4;
+        bytes += taken;
+        size -= taken;
+        m_pendingSize = 0;
+    }
+
+    const std::size_t offset = EncodeGroups(bytes, size, cursor, m_variant);
+    cursor += offset / 3 * 4;
+    m_pendingSize = size - offset;
+    std::copy_n(bytes + offset, m_pendingSize, m_pending.begin());
+    return static_cast<std::size_t>(cursor - output.data());
+}
+
+std::size_t Base64Encoder::Finish(Span<char> output)
+{
+    CheckOutputSize(output.size(), FinishSize());
+    std::size_t written = 0;
+    if (m_pendingSize > 0)
+    {
+        written = EncodeTail(m_pending.data(), m_pendingSize, output.data(), m_variant);
+    }
+    Reset();
+    return written;
+}
+
+void Base64Encoder::Reset() noexcept
+{
+    m_pendingSize = 0;
+}
+
+Base64Decoder::Base64Decoder(Base64Variant variant) noexcept :
+    m_variant(variant)
+{
+}
+
+std::size_t Base64Decoder::UpdateSize(std::size_t inputSize) const noexcept
+{
+    return inputSize / 4 * 3 + (inputSize % 4 + m_pendingSize) / 4 * 3;
+}
+
+std::size_t Base64Decoder::FinishSize() const noexcept
+{
+    return MaxDecodedSize(m_pendingSize);
+}
+
+std::optional<std::size_t> Base64Decoder::Update(std::string_view input, Span<std::byte> output)
+{
+    CheckOutputSize(output.size(), UpdateSize(input.size()));
+    auto* const bytes = reinterpret_cast<std::uint8_t*>(output.data());
+    std::size_t written = 0;
 
-            decoded.push_back(static_cast<std::byte>((first << 2) | (second >> 4)));
-            continue;
+    // Decodes a group that may be the padded final one.
+    const auto decodeGroup = [&](std::string_view group)
+    {
+        if (DecodeGroups(group.data(), group.size(), bytes + written, m_variant) == group.size())
+        {
+            written += 3;
+            return true;
+        }
+        const std::optional<std::size_t> tailSize =
+            IsPadded(m_variant) ? DecodeFinalGroup(group, bytes + written, m_variant)
+                                : std::nullopt;
+        if (!tailSize)
+        {
+            return false;
         }
+        written += *tailSize;
+        m_finished = true;
+        return true;
+    };
+
+    if (m_failed || (m_finished && !input.empty()))
+    {
+        m_failed = true;
+        return std::nullopt;
+    }
 
-        const auto third = DecodeBase64Character(data[offset + 2]);
-        if (third < 0)
+    if (m_pendingSize > 0)
+    {
+        const std::size_t taken = std::min(m_pending.size() - m_pendingSize, input.size());
+        input.copy(m_pending.data() + m_pendingSize, taken);
+        m_pendingSize += taken;
+        input.remove_prefix(taken);
+        if (m_pendingSize < m_pending.size())
+        {
+            return 0;
+        }
+        m_pendingSize = 0;
+        if (!decodeGroup(std::string_view(m_pending.data(), m_pending.size())))
         {
+            m_failed = true;
             return std::nullopt;
         }
+    }
 
-        decoded.push_back(static_cast<std::byte>((first << 2) | (second >> 4)));
-        if (data[offset + 3] == '=')
+    if (!m_finished)
+    {
+        const std::size_t offset = DecodeGroups(input.data(), input.size(), bytes + written,
+                                                m_variant);
+        written += offset / 4 * 3;
+        input.remove_prefix(offset);
+        if (input.size() >= 4)
         {
-            if (!isLastGroup || (third & 0x03) != 0)
+            if (!decodeGroup(input.substr(0, 4)))
             {
+                m_failed = true;
                 return std::nullopt;
             }
-
-            decoded.push_back(static_cast<std::byte>(((second & 0x0F) << 4) | (third >> 2)));
-            continue;
+            input.remove_prefix(4);
         }
+    }
 
-        const auto fourth = DecodeBase64Character(data[offset + 3]);
-        if (fourth < 0)
-        {
-            return std::nullopt;
-        }
+    // Nothing may follow a padded group.
+    if (m_finished && !input.empty())
+    {
+        m_failed = true;
+        return std::nullopt;
+    }
+    m_pendingSize = input.copy(m_pending.data(), input.size());
+    return written;
+}
 
-        decoded.push_back(static_cast<std::byte>(((second & 0x0F) << 4) | (third >> 2)));
-        decoded.push_back(static_cast<std::byte>(((third & 0x03) << 6) | fourth));
+std::optional<std::size_t> Base64Decoder::Finish(Span<std::byte> output)
+{
+    CheckOutputSize(output.size(), FinishSize());
+    std::optional<std::size_t> written = 0;
+    if (m_failed)
+    {
+        written = std::nullopt;
+    }
+    else if (m_pendingSize > 0)
+    {
+        written = DecodeFinalGroup(std::string_view(m_pending.data(), m_pendingSize),
+                                   reinterpret_cast<std::uint8_t*>(output.data()), m_variant);
     }
+    Reset();
+    return written;
+}
 
-    return decoded;
+void Base64Decoder::Reset() noexcept
+{
+    m_pendingSize = 0;
+    m_finished = false;
+    m_failed = false;
 }
 
 } // namespace rad
@@ -2,7 +2,9 @@
 
 #include <rad/Core/Span.h>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -11,12 +13,91 @@
 namespace rad
 {
 
-// Encodes bytes using the standard RFC 4648 Section 4 alphabet with canonical '=' padding.
-[[nodiscard]] std::string EncodeBase64(Span<const std::byte> data);
-[[nodiscard]] std::string EncodeBase64(std::string_view data);
+enum class Base64Variant
+{
+    // RFC 4648 Section 4 alphabet with canonical '=' padding.
+    Standard,
+    // RFC 4648 Section 5 URL- and filename-safe alphabet ('-' and '_') with '=' padding.
+    Url,
+    // Section 5 alphabet without padding, as used by JWT.
+    UrlNoPadding,
+};
+
+// Encodes bytes with canonical padding for the variant.
+[[nodiscard]] std::string EncodeBase64(Span<const std::byte> data,
+                                       Base64Variant variant = Base64Variant::Standard);
+[[nodiscard]] std::string EncodeBase64(std::string_view data,
+                                       Base64Variant variant = Base64Variant::Standard);
+
+// Strictly decodes canonical Base64. Returns nullopt for characters outside the variant's
+// alphabet, whitespace, missing or misplaced padding, and non-zero unused trailing bits.
+[[nodiscard]] std::optional<std::vector<std::byte>> DecodeBase64(
+    std::string_view data, Base64Variant variant = Base64Variant::Standard);
+
+// Incremental encoder that writes into caller-provided buffers. Chunks may have any size; up to
+// two bytes are carried over to the next call.
+class Base64Encoder
+{
+public:
+    explicit Base64Encoder(Base64Variant variant = Base64Variant::Standard) noexcept;
+
+    // Exact encoded length of size bytes, for pre-sizing whole outputs. Throws
+    // std::length_error if it does not fit in std::size_t.
+    [[nodiscard]] static std::size_t EncodedSize(std::size_t size,
+                                                 Base64Variant variant = Base64Variant::Standard);
+
+    // Exact number of characters the next Update or Finish call writes.
+    [[nodiscard]] std::size_t UpdateSize(std::size_t inputSize) const noexcept;
+    [[nodiscard]] std::size_t FinishSize() const noexcept;
+
+    // Encodes input and returns the number of characters written. Throws std::length_error if
+    // output is smaller than UpdateSize(input.size()).
+    std::size_t Update(Span<const std::byte> input, Span<char> output);
+    // Writes the final group with any padding, returns its length, and resets the encoder.
+    std::size_t Finish(Span<char> output);
+    void Reset() noexcept;
+
+private:
+    Base64Variant m_variant;
+    std::array<std::uint8_t, 2> m_pending = {};
+    std::size_t m_pendingSize = 0;
+}; // class Base64Encoder
+
+// Incremental strict decoder that writes into caller-provided buffers. Chunks may split the
+// input anywhere; up to three characters are carried over to the next call. Once a call fails,
+// later calls fail too until Reset.
+class Base64Decoder
+{
+public:
+    explicit Base64Decoder(Base64Variant variant = Base64Variant::Standard) noexcept;
+
+    // Upper bound on the decoded length of size encoded characters.
+    [[nodiscard]] static constexpr std::size_t MaxDecodedSize(std::size_t size) noexcept
+    {
+        return size / 4 * 3 + (size % 4) * 3 / 4;
+    }
+
+    // Upper bound on the number of bytes the next Update or Finish call writes.
+    [[nodiscard]] std::size_t UpdateSize(std::size_t inputSize) const noexcept;
+    [[nodiscard]] std::size_t FinishSize() const noexcept;
+
+    // Decodes input and returns the number of bytes written, or nullopt for invalid input.
+    // Throws std::length_error if output is smaller than UpdateSize(input.size()). Bytes of
+    // output past the returned count may be overwritten.
+    [[nodiscard]] std::optional<std::size_t> Update(std::string_view input,
+                                                    Span<std::byte> output);
+    // Decodes carried-over characters of an unpadded final group and resets the decoder.
+    // Returns nullopt if the input ended mid-group or in an earlier failure.
+    [[nodiscard]] std::optional<std::size_t> Finish(Span<std::byte> output);
+    void Reset() noexcept;
 
-// Strictly decodes canonical RFC 4648 Section 4 Base64. Returns nullopt for invalid characters,
-// whitespace, missing or misplaced padding, and non-zero unused trailing bits.
-[[nodiscard]] std::optional<std::vector<std::byte>> DecodeBase64(std::string_view data);
+private:
+    Base64Variant m_variant;
+    std::array<char, 4> m_pending = {};
+    std::size_t m_pendingSize = 0;
+    // Set after a padded group, which must be the last one.
+    bool m_finished = false;
+    bool m_failed = false;
+}; // class Base64Decoder
 
 } // namespace rad
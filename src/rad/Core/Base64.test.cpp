@@ -1,10 +1,15 @@
 #include <rad/Core/Base64.h>
+#include <rad/System/CpuInfo.h>
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <array>
+#include <cctype>
 #include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -84,3 +89,198 @@ TEST(Core, Base64RoundTrip)
     ASSERT_TRUE(decoded);
     EXPECT_EQ(*decoded, bytes);
 }
+
+TEST(Core, Base64SimdMatchesScalar)
+{
+    std::mt19937 random(42);
+    std::vector<std::vector<std::byte>> inputs;
+    for (std::size_t size = 0; size <= 300; ++size)
+    {
+        std::vector<std::byte>& input = inputs.emplace_back(size);
+        for (std::byte& value : input)
+        {
+            value = static_cast<std::byte>(random());
+        }
+    }
+
+    rad::SetSimdLevelLimit(rad::SimdLevel::Scalar);
+    std::vector<std::string> expected;
+    for (const std::vector<std::byte>& input : inputs)
+    {
+        expected.push_back(rad::EncodeBase64(input));
+    }
+    const std::string valid = expected[96];
+    ASSERT_EQ(valid.size(), 128u);
+    const std::string validUrl = rad::EncodeBase64(inputs[96], rad::Base64Variant::Url);
+
+    for (const rad::SimdLevel level : {rad::SimdLevel::SSE4_2, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+
+        for (std::size_t index = 0; index < inputs.size(); ++index)
+        {
+            EXPECT_EQ(rad::EncodeBase64(inputs[index]), expected[index]) << index;
+            const auto decoded = rad::DecodeBase64(expected[index]);
+            ASSERT_TRUE(decoded) << index;
+            EXPECT_EQ(*decoded, inputs[index]) << index;
+        }
+
+        // Every byte value outside the alphabet is rejected wherever it lands in a vector block.
+        for (const std::size_t position : {0, 5, 15, 31, 47, 63, 64, 100, 123})
+        {
+            for (int value = 0; value < 256; ++value)
+            {
+                std::string mutated = valid;
+                mutated[position] = static_cast<char>(value);
+                const bool inAlphabet = std::isalnum(value) || value == '+' || value == '/';
+                EXPECT_EQ(rad::DecodeBase64(mutated).has_value(), inAlphabet)
+                    << "position " << position << ", byte " << value;
+
+                std::string mutatedUrl = validUrl;
+                mutatedUrl[position] = static_cast<char>(value);
+                const bool inUrlAlphabet = std::isalnum(value) || value == '-' || value == '_';
+                EXPECT_EQ(rad::DecodeBase64(mutatedUrl, rad::Base64Variant::Url).has_value(),
+                          inUrlAlphabet)
+                    << "position " << position << ", byte " << value;
+            }
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, Base64Url)
+{
+    const std::array bytes = {std::byte{0xFB}, std::byte{0xFF}};
+    EXPECT_EQ(rad::EncodeBase64(bytes), "+/8=");
+    EXPECT_EQ(rad::EncodeBase64(bytes, rad::Base64Variant::Url), "-_8=");
+    EXPECT_EQ(rad::EncodeBase64(bytes, rad::Base64Variant::UrlNoPadding), "-_8");
+    EXPECT_EQ(rad::EncodeBase64("f", rad::Base64Variant::UrlNoPadding), "Zg");
+    EXPECT_EQ(rad::EncodeBase64("foo", rad::Base64Variant::UrlNoPadding), "Zm9v");
+
+    EXPECT_EQ(rad::DecodeBase64("-_8=", rad::Base64Variant::Url),
+              (std::vector<std::byte>(bytes.begin(), bytes.end())));
+    EXPECT_EQ(rad::DecodeBase64("-_8", rad::Base64Variant::UrlNoPadding),
+              (std::vector<std::byte>(bytes.begin(), bytes.end())));
+    EXPECT_FALSE(rad::DecodeBase64("-_8="));
+    EXPECT_FALSE(rad::DecodeBase64("+/8=", rad::Base64Variant::Url));
+    EXPECT_FALSE(rad::DecodeBase64("-_8", rad::Base64Variant::Url));
+    EXPECT_FALSE(rad::DecodeBase64("-_8=", rad::Base64Variant::UrlNoPadding));
+    EXPECT_FALSE(rad::DecodeBase64("Zm9vY", rad::Base64Variant::UrlNoPadding));
+    EXPECT_FALSE(rad::DecodeBase64("Zh", rad::Base64Variant::UrlNoPadding));
+
+    for (std::size_t size = 0; size < 16; ++size)
+    {
+        const std::string plain(size, 'x');
+        for (const rad::Base64Variant variant :
+             {rad::Base64Variant::Standard, rad::Base64Variant::Url,
+              rad::Base64Variant::UrlNoPadding})
+        {
+            const std::string encoded = rad::EncodeBase64(plain, variant);
+            EXPECT_EQ(encoded.size(), rad::Base64Encoder::EncodedSize(size, variant));
+            EXPECT_GE(rad::Base64Decoder::MaxDecodedSize(encoded.size()), size);
+        }
+    }
+}
+
+TEST(Core, Base64Streaming)
+{
+    std::mt19937 random(7);
+    std::vector<std::byte> payload(1000);
+    for (std::byte& value : payload)
+    {
+        value = static_cast<std::byte>(random());
+    }
+
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                       rad::SimdLevel::AVX2, rad::SimdLevel::NEON})
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+
+        for (const rad::Base64Variant variant :
+             {rad::Base64Variant::Standard, rad::Base64Variant::Url,
+              rad::Base64Variant::UrlNoPadding})
+        {
+            for (const std::size_t size : {0, 1, 2, 3, 47, 48, 100, 1000})
+            {
+                const rad::Span<const std::byte> input(payload.data(), size);
+                const std::string expected = rad::EncodeBase64(input, variant);
+                for (const std::size_t chunk : {1, 2, 5, 16, 33, 64, 1000})
+                {
+                    rad::Base64Encoder encoder(variant);
+                    std::string encoded;
+                    for (std::size_t offset = 0; offset < size; offset += chunk)
+                    {
+                        const auto part = input.subspan(offset, std::min(chunk, size - offset));
+                        std::string buffer(encoder.UpdateSize(part.size()), '\0');
+                        EXPECT_EQ(encoder.Update(part, buffer), buffer.size());
+                        encoded += buffer;
+                    }
+                    std::string buffer(encoder.FinishSize(), '\0');
+                    EXPECT_EQ(encoder.Finish(buffer), buffer.size());
+                    encoded += buffer;
+                    EXPECT_EQ(encoded, expected) << size << ", " << chunk;
+
+                    rad::Base64Decoder decoder(variant);
+                    std::vector<std::byte> decoded;
+                    for (std::size_t offset = 0; offset < expected.size(); offset += chunk)
+                    {
+                        const std::string_view part =
+                            std::string_view(expected).substr(offset, chunk);
+                        std::vector<std::byte> bytes(decoder.UpdateSize(part.size()));
+                        const auto written = decoder.Update(part, bytes);
+                        ASSERT_TRUE(written) << size << ", " << chunk;
+                        decoded.insert(decoded.end(), bytes.begin(), bytes.begin() + *written);
+                    }
+                    std::vector<std::byte> bytes(decoder.FinishSize());
+                    const auto written = decoder.Finish(bytes);
+                    ASSERT_TRUE(written) << size << ", " << chunk;
+                    decoded.insert(decoded.end(), bytes.begin(), bytes.begin() + *written);
+                    EXPECT_TRUE(std::ranges::equal(decoded, input)) << size << ", " << chunk;
+                }
+            }
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, Base64StreamingRejectsInvalidInput)
+{
+    std::array<std::byte, 64> output = {};
+
+    rad::Base64Decoder decoder;
+    EXPECT_TRUE(decoder.Update("Zg=", output));
+    EXPECT_EQ(decoder.Update("=", output), 1u);
+    EXPECT_FALSE(decoder.Update("Zg==", output));
+    // Failures are sticky until the decoder is reset.
+    EXPECT_FALSE(decoder.Update("", output));
+    EXPECT_FALSE(decoder.Finish(output));
+    EXPECT_EQ(decoder.Update("Zm9v", output), 3u);
+    EXPECT_EQ(decoder.Finish(output), 0u);
+
+    EXPECT_EQ(decoder.Update("Zm9", output), 0u);
+    EXPECT_FALSE(decoder.Finish(output));
+    EXPECT_FALSE(decoder.Update("Zm!v", output));
+    decoder.Reset();
+
+    rad::Base64Decoder unpadded(rad::Base64Variant::UrlNoPadding);
+    EXPECT_EQ(unpadded.Update("Zm9vYg", output), 3u);
+    EXPECT_EQ(unpadded.Finish(output), 1u);
+    EXPECT_EQ(output[0], std::byte{'b'});
+    EXPECT_EQ(unpadded.Update("Zm9vY", output), 3u);
+    EXPECT_FALSE(unpadded.Finish(output));
+
+    rad::Base64Encoder encoder;
+    EXPECT_THROW(encoder.Update(rad::AsBytes(std::string_view("foo")), rad::Span<char>()),
+                 std::length_error);
+    EXPECT_THROW(static_cast<void>(decoder.Update("Zm9v", rad::Span<std::byte>())),
+                 std::length_error);
+}
@@ -0,0 +1,118 @@
+#include <rad/Core/Blas.h>
+#include <rad/System/CpuInfo.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+template <typename T>
+std::vector<T> MakeValues(std::size_t size)
+{
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        values.push_back(T(distribution(random)));
+    }
+    return values;
+}
+
+bool ApplySimdLevel(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return false;
+    }
+    rad::SetSimdLevelLimit(level);
+    return true;
+}
+
+// The first argument selects the rad::SimdLevel limit, the second the vector length; 4096
+// elements stay in L1, 1 << 20 stream from memory.
+template <typename X, typename Y>
+void BM_Dot(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const auto size = static_cast<std::size_t>(state.range(1));
+    const std::vector<X> x = MakeValues<X>(size);
+    const std::vector<Y> y = MakeValues<Y>(size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rad::Dot(rad::Span<const X>(x), rad::Span<const Y>(y)));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(size * (sizeof(X) + sizeof(Y))));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// A 4096 x 4096 matrix; bandwidth is dominated by the matrix element size.
+template <typename T>
+void BM_Gemv(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    constexpr std::size_t Size = 4096;
+    const std::vector<T> matrix = MakeValues<T>(Size * Size);
+    const std::vector<float> x = MakeValues<float>(Size);
+    std::vector<float> y(Size);
+    for (auto _ : state)
+    {
+        rad::Gemv(rad::Span<const T>(matrix), rad::Span<const float>(x), rad::Span<float>(y));
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Size * Size));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(Size * Size * sizeof(T)));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+void SimdLevelsAndSizes(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        for (const std::int64_t size : {4096, 1 << 20})
+        {
+            benchmark->Args({static_cast<std::int64_t>(level), size});
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_Dot<float, float>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Dot<rad::BFloat16, rad::BFloat16>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Dot<rad::Float16, rad::Float16>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Dot<rad::Float8E4M3, rad::Float8E4M3>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Dot<rad::Float8E5M2, rad::Float8E5M2>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Dot<rad::BFloat16, float>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Dot<rad::Float8E4M3, float>)->Apply(SimdLevelsAndSizes);
+BENCHMARK(BM_Gemv<float>)->Apply(SimdLevels);
+BENCHMARK(BM_Gemv<rad::BFloat16>)->Apply(SimdLevels);
+BENCHMARK(BM_Gemv<rad::Float16>)->Apply(SimdLevels);
+BENCHMARK(BM_Gemv<rad::Float8E4M3>)->Apply(SimdLevels);
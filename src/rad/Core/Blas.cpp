@@ -0,0 +1,694 @@
+#include <rad/Core/Blas.h>
+#include <rad/Core/Integer.h>
+#include <rad/Core/Platform.h>
+#include <rad/System/CpuInfo.h>
+
+#if defined(RAD_ARCH_X86)
+#include <immintrin.h>
+#define RAD_TARGET_AVX512_BF16                                                                     \
+    RAD_TARGET("ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,avx512f,avx512bw,"           \
+               "avx512dq,avx512vl,avx512bf16")
+#elif defined(RAD_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace rad
+{
+
+namespace
+{
+
+// Kernels process a prefix of whole vectors and return how many columns they consumed; the
+// scalar loops finish the rest.
+template <typename X, typename Y>
+using DotKernel = std::size_t (*)(const X* x, const Y* y, std::size_t size, Float32& sum) noexcept;
+template <typename T>
+using AxpyKernel = std::size_t (*)(Float32 alpha, const T* x, Float32* y,
+                                   std::size_t size) noexcept;
+// Dot products of rows matrix, matrix + stride, ... matrix + 3 * stride with x, added to sums.
+template <typename T>
+using Dot4Kernel = std::size_t (*)(const T* matrix, std::size_t stride, const Float32* x,
+                                   std::size_t size, Float32* sums) noexcept;
+
+template <typename X, typename Y>
+[[nodiscard]] Float32 DotScalar(const X* x, const Y* y, std::size_t size) noexcept
+{
+    // Four independent sums hide the add latency.
+    Float32 sums[4] = {};
+    std::size_t index = 0;
+    for (; size - index >= 4; index += 4)
+    {
+        for (std::size_t lane = 0; lane < 4; ++lane)
+        {
+            sums[lane] += static_cast<Float32>(x[index + lane]) *
+                          static_cast<Float32>(y[index + lane]);
+        }
+    }
+    for (; index < size; ++index)
+    {
+        sums[0] += static_cast<Float32>(x[index]) * static_cast<Float32>(y[index]);
+    }
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+template <typename T>
+void AxpyScalar(Float32 alpha, const T* x, Float32* y, std::size_t size) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        y[index] += alpha * static_cast<Float32>(x[index]);
+    }
+}
+
+#if defined(RAD_ARCH_X86)
+
+// Loads of eight elements widened to Float32.
+
+RAD_TARGET_AVX2 inline __m256 LoadAvx2(const Float32* input) noexcept
+{
+    return _mm256_loadu_ps(input);
+}
+
+RAD_TARGET_AVX2 inline __m256 LoadAvx2(const BFloat16* input) noexcept
+{
+    const __m256i halves =
+        _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(halves, 16));
+}
+
+RAD_TARGET_AVX2 inline __m256 LoadAvx2(const Float16* input) noexcept
+{
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+}
+
+// Float8E5M2 is the upper byte of a Float16.
+RAD_TARGET_AVX2 inline __m256 LoadAvx2(const Float8E5M2* input) noexcept
+{
+    const __m128i bytes =
+        _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+    return _mm256_cvtph_ps(_mm_slli_epi16(bytes, 8));
+}
+
+// The Float8E4M3 magnitude bits placed in a Float16 give the value divided by 2^8, denormals
+// included; only the NaN encoding needs a fix-up. Shifting the sign-extended byte left by 7
+// leaves the magnitude in bits 7-13 and the sign in bits 14 and 15, of which 14 is cleared.
+RAD_TARGET_AVX2 inline __m256 LoadAvx2(const Float8E4M3* input) noexcept
+{
+    const __m128i shifted = _mm_slli_epi16(
+        _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input))), 7);
+    const __m256 value = _mm256_mul_ps(
+        _mm256_cvtph_ps(_mm_and_si128(shifted, _mm_set1_epi16(Sint16(0xBFFF)))),
+        _mm256_set1_ps(256.0f));
+    const __m128i magnitudeMask = _mm_set1_epi16(0x3F80);
+    const __m128i isNaN = _mm_cmpeq_epi16(_mm_and_si128(shifted, magnitudeMask), magnitudeMask);
+    return _mm256_or_ps(value, _mm256_castsi256_ps(_mm256_cvtepi16_epi32(isNaN)));
+}
+
+RAD_TARGET_AVX2 inline Float32 HorizontalSumAvx2(__m256 values) noexcept
+{
+    __m128 sums = _mm_add_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+    sums = _mm_add_ps(sums, _mm_movehl_ps(sums, sums));
+    sums = _mm_add_ss(sums, _mm_shuffle_ps(sums, sums, 1));
+    return _mm_cvtss_f32(sums);
+}
+
+template <typename X, typename Y>
+RAD_TARGET_AVX2 std::size_t DotAvx2(const X* x, const Y* y, std::size_t size,
+                                    Float32& sum) noexcept
+{
+    // Named accumulators rather than an array, which GCC keeps in memory.
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    std::size_t offset = 0;
+    for (; size - offset >= 32; offset += 32)
+    {
+        sum0 = _mm256_fmadd_ps(LoadAvx2(x + offset), LoadAvx2(y + offset), sum0);
+        sum1 = _mm256_fmadd_ps(LoadAvx2(x + offset + 8), LoadAvx2(y + offset + 8), sum1);
+        sum2 = _mm256_fmadd_ps(LoadAvx2(x + offset + 16), LoadAvx2(y + offset + 16), sum2);
+        sum3 = _mm256_fmadd_ps(LoadAvx2(x + offset + 24), LoadAvx2(y + offset + 24), sum3);
+    }
+    for (; size - offset >= 8; offset += 8)
+    {
+        sum0 = _mm256_fmadd_ps(LoadAvx2(x + offset), LoadAvx2(y + offset), sum0);
+    }
+    sum += HorizontalSumAvx2(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+    return offset;
+}
+
+template <typename T>
+RAD_TARGET_AVX2 std::size_t AxpyAvx2(Float32 alpha, const T* x, Float32* y,
+                                     std::size_t size) noexcept
+{
+    const __m256 scale = _mm256_set1_ps(alpha);
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        _mm256_storeu_ps(y + offset,
+                         _mm256_fmadd_ps(scale, LoadAvx2(x + offset), _mm256_loadu_ps(y + offset)));
+    }
+    return offset;
+}
+
+template <typename T>
+RAD_TARGET_AVX2 std::size_t Dot4Avx2(const T* matrix, std::size_t stride, const Float32* x,
+                                     std::size_t size, Float32* sums) noexcept
+{
+    const T* row0 = matrix;
+    const T* row1 = matrix + stride;
+    const T* row2 = matrix + 2 * stride;
+    const T* row3 = matrix + 3 * stride;
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256 values = _mm256_loadu_ps(x + offset);
+        sum0 = _mm256_fmadd_ps(LoadAvx2(row0 + offset), values, sum0);
+        sum1 = _mm256_fmadd_ps(LoadAvx2(row1 + offset), values, sum1);
+        sum2 = _mm256_fmadd_ps(LoadAvx2(row2 + offset), values, sum2);
+        sum3 = _mm256_fmadd_ps(LoadAvx2(row3 + offset), values, sum3);
+    }
+    sums[0] += HorizontalSumAvx2(sum0);
+    sums[1] += HorizontalSumAvx2(sum1);
+    sums[2] += HorizontalSumAvx2(sum2);
+    sums[3] += HorizontalSumAvx2(sum3);
+    return offset;
+}
+
+// Loads of sixteen elements widened to Float32.
+RAD_TARGET_AVX512 inline __m512 LoadAvx512(const Float32* input) noexcept
+{
+    return _mm512_loadu_ps(input);
+}
+
+RAD_TARGET_AVX512 inline __m512 LoadAvx512(const BFloat16* input) noexcept
+{
+    const __m512i halves = _mm512_maskz_cvtepu16_epi32(
+        AllLanes32, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input)));
+    return _mm512_castsi512_ps(_mm512_maskz_slli_epi32(AllLanes32, halves, 16));
+}
+
+RAD_TARGET_AVX512 inline __m512 LoadAvx512(const Float16* input) noexcept
+{
+    return _mm512_maskz_cvtph_ps(AllLanes32,
+                                 _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input)));
+}
+
+RAD_TARGET_AVX512 inline __m512 LoadAvx512(const Float8E5M2* input) noexcept
+{
+    const __m256i bytes =
+        _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+    return _mm512_maskz_cvtph_ps(AllLanes32, _mm256_slli_epi16(bytes, 8));
+}
+
+RAD_TARGET_AVX512 inline __m512 LoadAvx512(const Float8E4M3* input) noexcept
+{
+    const __m256i shifted = _mm256_slli_epi16(
+        _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input))), 7);
+    const __m512 value = _mm512_mul_ps(
+        _mm512_maskz_cvtph_ps(AllLanes32,
+                              _mm256_and_si256(shifted, _mm256_set1_epi16(Sint16(0xBFFF)))),
+        _mm512_set1_ps(256.0f));
+    const __m256i magnitudeMask = _mm256_set1_epi16(0x3F80);
+    const __mmask16 isNaN =
+        _mm256_cmpeq_epi16_mask(_mm256_and_si256(shifted, magnitudeMask), magnitudeMask);
+    return _mm512_mask_mov_ps(value, isNaN,
+                              _mm512_set1_ps(std::numeric_limits<Float32>::quiet_NaN()));
+}
+
+RAD_TARGET_AVX512 inline Float32 HorizontalSumAvx512(__m512 values) noexcept
+{
+    const __m256 low = _mm512_maskz_extractf32x8_ps(0xFF, values, 0);
+    const __m256 high = _mm512_maskz_extractf32x8_ps(0xFF, values, 1);
+    return HorizontalSumAvx2(_mm256_add_ps(low, high));
+}
+
+template <typename X, typename Y>
+RAD_TARGET_AVX512 std::size_t DotAvx512(const X* x, const Y* y, std::size_t size,
+                                        Float32& sum) noexcept
+{
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+    std::size_t offset = 0;
+    for (; size - offset >= 64; offset += 64)
+    {
+        sum0 = _mm512_fmadd_ps(LoadAvx512(x + offset), LoadAvx512(y + offset), sum0);
+        sum1 = _mm512_fmadd_ps(LoadAvx512(x + offset + 16), LoadAvx512(y + offset + 16), sum1);
+        sum2 = _mm512_fmadd_ps(LoadAvx512(x + offset + 32), LoadAvx512(y + offset + 32), sum2);
+        sum3 = _mm512_fmadd_ps(LoadAvx512(x + offset + 48), LoadAvx512(y + offset + 48), sum3);
+    }
+    for (; size - offset >= 16; offset += 16)
+    {
+        sum0 = _mm512_fmadd_ps(LoadAvx512(x + offset), LoadAvx512(y + offset), sum0);
+    }
+    sum += HorizontalSumAvx512(
+        _mm512_add_ps(_mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3)));
+    return offset + DotAvx2(x + offset, y + offset, size - offset, sum);
+}
+
+template <typename T>
+RAD_TARGET_AVX512 std::size_t AxpyAvx512(Float32 alpha, const T* x, Float32* y,
+                                         std::size_t size) noexcept
+{
+    const __m512 scale = _mm512_set1_ps(alpha);
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        _mm512_storeu_ps(y + offset, _mm512_fmadd_ps(scale, LoadAvx512(x + offset),
+                                                     _mm512_loadu_ps(y + offset)));
+    }
+    return offset + AxpyAvx2(alpha, x + offset, y + offset, size - offset);
+}
+
+template <typename T>
+RAD_TARGET_AVX512 std::size_t Dot4Avx512(const T* matrix, std::size_t stride, const Float32* x,
+                                         std::size_t size, Float32* sums) noexcept
+{
+    const T* row0 = matrix;
+    const T* row1 = matrix + stride;
+    const T* row2 = matrix + 2 * stride;
+    const T* row3 = matrix + 3 * stride;
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512 values = _mm512_loadu_ps(x + offset);
+        sum0 = _mm512_fmadd_ps(LoadAvx512(row0 + offset), values, sum0);
+        sum1 = _mm512_fmadd_ps(LoadAvx512(row1 + offset), values, sum1);
+        sum2 = _mm512_fmadd_ps(LoadAvx512(row2 + offset), values, sum2);
+        sum3 = _mm512_fmadd_ps(LoadAvx512(row3 + offset), values, sum3);
+    }
+    sums[0] += HorizontalSumAvx512(sum0);
+    sums[1] += HorizontalSumAvx512(sum1);
+    sums[2] += HorizontalSumAvx512(sum2);
+    sums[3] += HorizontalSumAvx512(sum3);
+    return offset + Dot4Avx2(matrix + offset, stride, x + offset, size - offset, sums);
+}
+
+// AVX512_BF16 is not part of the AVX512 tier; Cooper Lake, Sapphire Rapids and Zen 4 have it.
+[[nodiscard]] bool IsAvx512Bf16Supported() noexcept
+{
+    return GetX86Info().features.avx512_bf16;
+}
+
+RAD_TARGET_AVX512_BF16 inline __m512bh LoadAvx512Bf16(const BFloat16* input) noexcept
+{
+    __m512bh values;
+    std::memcpy(&values, input, sizeof(values));
+    return values;
+}
+
+// VDPBF16PS multiplies pairs of BFloat16 and adds both products to a Float32 lane, 32 products
+// per instruction with no widening. It treats denormal inputs and results as zero.
+RAD_TARGET_AVX512_BF16 std::size_t DotBFloat16Avx512Bf16(const BFloat16* x, const BFloat16* y,
+                                                         std::size_t size, Float32& sum) noexcept
+{
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+    std::size_t offset = 0;
+    for (; size - offset >= 128; offset += 128)
+    {
+        sum0 = _mm512_dpbf16_ps(sum0, LoadAvx512Bf16(x + offset), LoadAvx512Bf16(y + offset));
+        sum1 = _mm512_dpbf16_ps(sum1, LoadAvx512Bf16(x + offset + 32),
+                                LoadAvx512Bf16(y + offset + 32));
+        sum2 = _mm512_dpbf16_ps(sum2, LoadAvx512Bf16(x + offset + 64),
+                                LoadAvx512Bf16(y + offset + 64));
+        sum3 = _mm512_dpbf16_ps(sum3, LoadAvx512Bf16(x + offset + 96),
+                                LoadAvx512Bf16(y + offset + 96));
+    }
+    for (; size - offset >= 32; offset += 32)
+    {
+        sum0 = _mm512_dpbf16_ps(sum0, LoadAvx512Bf16(x + offset), LoadAvx512Bf16(y + offset));
+    }
+    sum += HorizontalSumAvx512(
+        _mm512_add_ps(_mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3)));
+    return offset + DotAvx512(x + offset, y + offset, size - offset, sum);
+}
+
+#elif defined(RAD_ARCH_AARCH64)
+
+// Loads of eight elements widened to two vectors of Float32.
+
+inline void LoadNeon(const Float32* input, float32x4_t& low, float32x4_t& high) noexcept
+{
+    low = vld1q_f32(input);
+    high = vld1q_f32(input + 4);
+}
+
+inline void LoadNeon(const BFloat16* input, float32x4_t& low, float32x4_t& high) noexcept
+{
+    const uint16x8_t halves = vld1q_u16(reinterpret_cast<const Uint16*>(input));
+    low = vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(halves), 16));
+    high = vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(halves), 16));
+}
+
+inline void WidenFloat16Neon(uint16x8_t halves, float32x4_t& low, float32x4_t& high) noexcept
+{
+    low = vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(halves)));
+    high = vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(halves)));
+}
+
+inline void LoadNeon(const Float16* input, float32x4_t& low, float32x4_t& high) noexcept
+{
+    WidenFloat16Neon(vld1q_u16(reinterpret_cast<const Uint16*>(input)), low, high);
+}
+
+// Float8E5M2 is the upper byte of a Float16.
+inline void LoadNeon(const Float8E5M2* input, float32x4_t& low, float32x4_t& high) noexcept
+{
+    WidenFloat16Neon(vshll_n_u8(vld1_u8(reinterpret_cast<const Uint8*>(input)), 8), low, high);
+}
+
+// The Float8E4M3 magnitude bits placed in a Float16 give the value divided by 2^8, denormals
+// included; only the NaN encoding needs a fix-up. Shifting the sign-extended byte left by 7
+// leaves the magnitude in bits 7-13 and the sign in bits 14 and 15, of which 14 is cleared.
+inline void LoadNeon(const Float8E4M3* input, float32x4_t& low, float32x4_t& high) noexcept
+{
+    const uint16x8_t shifted = vreinterpretq_u16_s16(
+        vshlq_n_s16(vmovl_s8(vld1_s8(reinterpret_cast<const Sint8*>(input))), 7));
+    WidenFloat16Neon(vandq_u16(shifted, vdupq_n_u16(0xBFFF)), low, high);
+    low = vmulq_n_f32(low, 256.0f);
+    high = vmulq_n_f32(high, 256.0f);
+    const uint16x8_t magnitudeMask = vdupq_n_u16(0x3F80);
+    const int16x8_t isNaN =
+        vreinterpretq_s16_u16(vceqq_u16(vandq_u16(shifted, magnitudeMask), magnitudeMask));
+    low = vreinterpretq_f32_s32(
+        vorrq_s32(vreinterpretq_s32_f32(low), vmovl_s16(vget_low_s16(isNaN))));
+    high = vreinterpretq_f32_s32(
+        vorrq_s32(vreinterpretq_s32_f32(high), vmovl_s16(vget_high_s16(isNaN))));
+}
+
+template <typename X, typename Y>
+std::size_t DotNeon(const X* x, const Y* y, std::size_t size, Float32& sum) noexcept
+{
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    float32x4_t sum2 = vdupq_n_f32(0.0f);
+    float32x4_t sum3 = vdupq_n_f32(0.0f);
+    float32x4_t xLow, xHigh, yLow, yHigh;
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        LoadNeon(x + offset, xLow, xHigh);
+        LoadNeon(y + offset, yLow, yHigh);
+        sum0 = vfmaq_f32(sum0, xLow, yLow);
+        sum1 = vfmaq_f32(sum1, xHigh, yHigh);
+        LoadNeon(x + offset + 8, xLow, xHigh);
+        LoadNeon(y + offset + 8, yLow, yHigh);
+        sum2 = vfmaq_f32(sum2, xLow, yLow);
+        sum3 = vfmaq_f32(sum3, xHigh, yHigh);
+    }
+    for (; size - offset >= 8; offset += 8)
+    {
+        LoadNeon(x + offset, xLow, xHigh);
+        LoadNeon(y + offset, yLow, yHigh);
+        sum0 = vfmaq_f32(sum0, xLow, yLow);
+        sum1 = vfmaq_f32(sum1, xHigh, yHigh);
+    }
+    sum += vaddvq_f32(vaddq_f32(vaddq_f32(sum0, sum1), vaddq_f32(sum2, sum3)));
+    return offset;
+}
+
+template <typename T>
+std::size_t AxpyNeon(Float32 alpha, const T* x, Float32* y, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        float32x4_t low, high;
+        LoadNeon(x + offset, low, high);
+        vst1q_f32(y + offset, vfmaq_n_f32(vld1q_f32(y + offset), low, alpha));
+        vst1q_f32(y + offset + 4, vfmaq_n_f32(vld1q_f32(y + offset + 4), high, alpha));
+    }
+    return offset;
+}
+
+template <typename T>
+std::size_t Dot4Neon(const T* matrix, std::size_t stride, const Float32* x, std::size_t size,
+                     Float32* sums) noexcept
+{
+    const T* rows[4] = {matrix, matrix + stride, matrix + 2 * stride, matrix + 3 * stride};
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    float32x4_t sum2 = vdupq_n_f32(0.0f);
+    float32x4_t sum3 = vdupq_n_f32(0.0f);
+    float32x4_t low, high;
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const float32x4_t valuesLow = vld1q_f32(x + offset);
+        const float32x4_t valuesHigh = vld1q_f32(x + offset + 4);
+        LoadNeon(rows[0] + offset, low, high);
+        sum0 = vfmaq_f32(vfmaq_f32(sum0, low, valuesLow), high, valuesHigh);
+        LoadNeon(rows[1] + offset, low, high);
+        sum1 = vfmaq_f32(vfmaq_f32(sum1, low, valuesLow), high, valuesHigh);
+        LoadNeon(rows[2] + offset, low, high);
+        sum2 = vfmaq_f32(vfmaq_f32(sum2, low, valuesLow), high, valuesHigh);
+        LoadNeon(rows[3] + offset, low, high);
+        sum3 = vfmaq_f32(vfmaq_f32(sum3, low, valuesLow), high, valuesHigh);
+    }
+    sums[0] += vaddvq_f32(sum0);
+    sums[1] += vaddvq_f32(sum1);
+    sums[2] += vaddvq_f32(sum2);
+    sums[3] += vaddvq_f32(sum3);
+    return offset;
+}
+
+#endif
+
+template <typename X, typename Y>
+[[nodiscard]] DotKernel<X, Y> SelectDotKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        if constexpr (std::is_same_v<X, BFloat16> && std::is_same_v<Y, BFloat16>)
+        {
+            if (IsAvx512Bf16Supported())
+            {
+                return DotBFloat16Avx512Bf16;
+            }
+        }
+        return DotAvx512<X, Y>;
+    case SimdLevel::AVX2:
+        return DotAvx2<X, Y>;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return DotNeon<X, Y>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <typename T>
+[[nodiscard]] AxpyKernel<T> SelectAxpyKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return AxpyAvx512<T>;
+    case SimdLevel::AVX2:
+        return AxpyAvx2<T>;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return AxpyNeon<T>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <typename T>
+[[nodiscard]] Dot4Kernel<T> SelectDot4Kernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return Dot4Avx512<T>;
+    case SimdLevel::AVX2:
+        return Dot4Avx2<T>;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return Dot4Neon<T>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <typename X, typename Y>
+[[nodiscard]] Float32 DotOf(const X* x, const Y* y, std::size_t size) noexcept
+{
+    Float32 sum = 0.0f;
+    std::size_t offset = 0;
+    if (const DotKernel<X, Y> kernel = SelectDotKernel<X, Y>())
+    {
+        offset = kernel(x, y, size, sum);
+    }
+    return sum + DotScalar(x + offset, y + offset, size - offset);
+}
+
+template <typename X, typename Y>
+[[nodiscard]] Float32 Dot(Span<const X> x, Span<const Y> y) noexcept
+{
+    assert(x.size() == y.size());
+    return DotOf(x.data(), y.data(), x.size());
+}
+
+template <typename T>
+void Axpy(Float32 alpha, Span<const T> x, Span<Float32> y) noexcept
+{
+    assert(y.size() >= x.size());
+    std::size_t offset = 0;
+    if (const AxpyKernel<T> kernel = SelectAxpyKernel<T>())
+    {
+        offset = kernel(alpha, x.data(), y.data(), x.size());
+    }
+    AxpyScalar(alpha, x.data() + offset, y.data() + offset, x.size() - offset);
+}
+
+template <typename T>
+void Gemv(Span<const T> matrix, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    const std::size_t columns = x.size();
+    assert(matrix.size() == y.size() * columns);
+    std::size_t row = 0;
+    if (const Dot4Kernel<T> kernel = SelectDot4Kernel<T>())
+    {
+        for (; y.size() - row >= 4; row += 4)
+        {
+            const T* rows = matrix.data() + row * columns;
+            Float32 sums[4] = {};
+            const std::size_t offset = kernel(rows, columns, x.data(), columns, sums);
+            for (std::size_t index = 0; index < 4; ++index)
+            {
+                y[row + index] = sums[index] + DotScalar(rows + index * columns + offset,
+                                                         x.data() + offset, columns - offset);
+            }
+        }
+    }
+    for (; row < y.size(); ++row)
+    {
+        y[row] = DotOf(matrix.data() + row * columns, x.data(), columns);
+    }
+}
+
+} // namespace
+
+Float32 Dot(Span<const Float32> x, Span<const Float32> y) noexcept
+{
+    return Dot<Float32, Float32>(x, y);
+}
+
+Float32 Dot(Span<const BFloat16> x, Span<const BFloat16> y) noexcept
+{
+    return Dot<BFloat16, BFloat16>(x, y);
+}
+
+Float32 Dot(Span<const Float16> x, Span<const Float16> y) noexcept
+{
+    return Dot<Float16, Float16>(x, y);
+}
+
+Float32 Dot(Span<const Float8E4M3> x, Span<const Float8E4M3> y) noexcept
+{
+    return Dot<Float8E4M3, Float8E4M3>(x, y);
+}
+
+Float32 Dot(Span<const Float8E5M2> x, Span<const Float8E5M2> y) noexcept
+{
+    return Dot<Float8E5M2, Float8E5M2>(x, y);
+}
+
+Float32 Dot(Span<const BFloat16> x, Span<const Float32> y) noexcept
+{
+    return Dot<BFloat16, Float32>(x, y);
+}
+
+Float32 Dot(Span<const Float16> x, Span<const Float32> y) noexcept
+{
+    return Dot<Float16, Float32>(x, y);
+}
+
+Float32 Dot(Span<const Float8E4M3> x, Span<const Float32> y) noexcept
+{
+    return Dot<Float8E4M3, Float32>(x, y);
+}
+
+Float32 Dot(Span<const Float8E5M2> x, Span<const Float32> y) noexcept
+{
+    return Dot<Float8E5M2, Float32>(x, y);
+}
+
+void Axpy(Float32 alpha, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    Axpy<Float32>(alpha, x, y);
+}
+
+void Axpy(Float32 alpha, Span<const BFloat16> x, Span<Float32> y) noexcept
+{
+    Axpy<BFloat16>(alpha, x, y);
+}
+
+void Axpy(Float32 alpha, Span<const Float16> x, Span<Float32> y) noexcept
+{
+    Axpy<Float16>(alpha, x, y);
+}
+
+void Axpy(Float32 alpha, Span<const Float8E4M3> x, Span<Float32> y) noexcept
+{
+    Axpy<Float8E4M3>(alpha, x, y);
+}
+
+void Axpy(Float32 alpha, Span<const Float8E5M2> x, Span<Float32> y) noexcept
+{
+    Axpy<Float8E5M2>(alpha, x, y);
+}
+
+void Gemv(Span<const Float32> matrix, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    Gemv<Float32>(matrix, x, y);
+}
+
+void Gemv(Span<const BFloat16> matrix, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    Gemv<BFloat16>(matrix, x, y);
+}
+
+void Gemv(Span<const Float16> matrix, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    Gemv<Float16>(matrix, x, y);
+}
+
+void Gemv(Span<const Float8E4M3> matrix, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    Gemv<Float8E4M3>(matrix, x, y);
+}
+
+void Gemv(Span<const Float8E5M2> matrix, Span<const Float32> x, Span<Float32> y) noexcept
+{
+    Gemv<Float8E5M2>(matrix, x, y);
+}
+
+} // namespace rad
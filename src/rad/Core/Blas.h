@@ -0,0 +1,45 @@
+#pragma once
+
+#include <rad/Core/BFloat16.h>
+#include <rad/Core/Float.h>
+#include <rad/Core/Float16.h>
+#include <rad/Core/Float8.h>
+#include <rad/Core/Span.h>
+
+namespace rad
+{
+
+// Level 1 and 2 BLAS over the reduced-precision formats. Elements are widened to Float32 in
+// registers and all arithmetic is Float32, so tensors stored as BFloat16, Float16 or Float8 are
+// used in place. Sums are accumulated in several lanes, so they can differ from a sequential
+// loop in the last bits, and between SIMD levels; the AVX512_BF16 kernel of the BFloat16 dot
+// product also treats denormal inputs as zero.
+
+// Returns the sum of x[i] * y[i]; x and y must have the same size.
+[[nodiscard]] Float32 Dot(Span<const Float32> x, Span<const Float32> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const BFloat16> x, Span<const BFloat16> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const Float16> x, Span<const Float16> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const Float8E4M3> x, Span<const Float8E4M3> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const Float8E5M2> x, Span<const Float8E5M2> y) noexcept;
+// Stored values against Float32 activations.
+[[nodiscard]] Float32 Dot(Span<const BFloat16> x, Span<const Float32> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const Float16> x, Span<const Float32> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const Float8E4M3> x, Span<const Float32> y) noexcept;
+[[nodiscard]] Float32 Dot(Span<const Float8E5M2> x, Span<const Float32> y) noexcept;
+
+// y[i] += alpha * x[i]; y must hold at least x.size() elements.
+void Axpy(Float32 alpha, Span<const Float32> x, Span<Float32> y) noexcept;
+void Axpy(Float32 alpha, Span<const BFloat16> x, Span<Float32> y) noexcept;
+void Axpy(Float32 alpha, Span<const Float16> x, Span<Float32> y) noexcept;
+void Axpy(Float32 alpha, Span<const Float8E4M3> x, Span<Float32> y) noexcept;
+void Axpy(Float32 alpha, Span<const Float8E5M2> x, Span<Float32> y) noexcept;
+
+// y = matrix * x for a row-major matrix of y.size() rows and x.size() columns. Rows are
+// processed four at a time so that each load of x serves four rows.
+void Gemv(Span<const Float32> matrix, Span<const Float32> x, Span<Float32> y) noexcept;
+void Gemv(Span<const BFloat16> matrix, Span<const Float32> x, Span<Float32> y) noexcept;
+void Gemv(Span<const Float16> matrix, Span<const Float32> x, Span<Float32> y) noexcept;
+void Gemv(Span<const Float8E4M3> matrix, Span<const Float32> x, Span<Float32> y) noexcept;
+void Gemv(Span<const Float8E5M2> matrix, Span<const Float32> x, Span<Float32> y) noexcept;
+
+} // namespace rad
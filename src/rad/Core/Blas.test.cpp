@@ -0,0 +1,185 @@
+#include <rad/Core/Blas.h>
+#include <rad/System/CpuInfo.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr rad::SimdLevel SimdLevels[] = {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                         rad::SimdLevel::AVX2, rad::SimdLevel::AVX512,
+                                         rad::SimdLevel::NEON};
+
+// Sizes around the vector widths and unroll factors of every kernel.
+constexpr std::size_t Sizes[] = {0, 1, 7, 8, 9, 31, 33, 64, 100, 1000, 4097};
+
+// Values in a range every format holds, rounded to T.
+template <typename T>
+std::vector<T> MakeValues(std::size_t size, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        values.push_back(T(distribution(random)));
+    }
+    return values;
+}
+
+// Each Float32 operation contributes at most one rounding error relative to sum |x * y|.
+template <typename X, typename Y>
+void ExpectDotNearReference(const std::vector<X>& x, const std::vector<Y>& y, float result)
+{
+    double sum = 0.0;
+    double magnitude = 0.0;
+    for (std::size_t index = 0; index < x.size(); ++index)
+    {
+        const double product =
+            static_cast<double>(static_cast<float>(x[index])) * static_cast<float>(y[index]);
+        sum += product;
+        magnitude += std::abs(product);
+    }
+    const double tolerance =
+        static_cast<double>(x.size() + 1) * std::numeric_limits<float>::epsilon() * magnitude;
+    EXPECT_NEAR(result, sum, tolerance) << "size " << x.size();
+}
+
+template <typename X, typename Y>
+void ExpectDotMatchesReference()
+{
+    for (const std::size_t size : Sizes)
+    {
+        const std::vector<X> x = MakeValues<X>(size, 1);
+        const std::vector<Y> y = MakeValues<Y>(size, 2);
+        ExpectDotNearReference(x, y, rad::Dot(rad::Span<const X>(x), rad::Span<const Y>(y)));
+    }
+}
+
+template <typename T>
+void ExpectAxpyMatchesReference()
+{
+    for (const std::size_t size : Sizes)
+    {
+        const std::vector<T> x = MakeValues<T>(size, 3);
+        const std::vector<float> initial = MakeValues<float>(size + 1, 4);
+        std::vector<float> y = initial;
+        rad::Axpy(0.75f, rad::Span<const T>(x), rad::Span<float>(y));
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            // A fused and an unfused multiply-add differ by at most one rounding.
+            const float expected = initial[index] + 0.75f * static_cast<float>(x[index]);
+            EXPECT_NEAR(y[index], expected, 8 * std::numeric_limits<float>::epsilon())
+                << "size " << size << " index " << index;
+        }
+        EXPECT_EQ(y[size], initial[size]);
+    }
+}
+
+template <typename T>
+void ExpectGemvMatchesReference()
+{
+    for (const std::size_t rows : {std::size_t(1), std::size_t(3), std::size_t(4), std::size_t(9)})
+    {
+        for (const std::size_t columns : Sizes)
+        {
+            const std::vector<T> matrix = MakeValues<T>(rows * columns, 5);
+            const std::vector<float> x = MakeValues<float>(columns, 6);
+            std::vector<float> y(rows, std::numeric_limits<float>::quiet_NaN());
+            rad::Gemv(rad::Span<const T>(matrix), rad::Span<const float>(x), rad::Span<float>(y));
+            for (std::size_t row = 0; row < rows; ++row)
+            {
+                const std::vector<T> values(matrix.begin() + row * columns,
+                                            matrix.begin() + (row + 1) * columns);
+                ExpectDotNearReference(values, x, y[row]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void ExpectDotPropagatesNaN()
+{
+    for (const std::size_t position : {std::size_t(0), std::size_t(37), std::size_t(99)})
+    {
+        std::vector<T> x = MakeValues<T>(100, 7);
+        const std::vector<T> y = MakeValues<T>(100, 8);
+        x[position] = T(std::numeric_limits<float>::quiet_NaN());
+        EXPECT_TRUE(std::isnan(rad::Dot(rad::Span<const T>(x), rad::Span<const T>(y))))
+            << "position " << position;
+    }
+}
+
+} // namespace
+
+TEST(Core, BlasDot)
+{
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        SCOPED_TRACE(static_cast<int>(level));
+        ExpectDotMatchesReference<float, float>();
+        ExpectDotMatchesReference<rad::BFloat16, rad::BFloat16>();
+        ExpectDotMatchesReference<rad::Float16, rad::Float16>();
+        ExpectDotMatchesReference<rad::Float8E4M3, rad::Float8E4M3>();
+        ExpectDotMatchesReference<rad::Float8E5M2, rad::Float8E5M2>();
+        ExpectDotMatchesReference<rad::BFloat16, float>();
+        ExpectDotMatchesReference<rad::Float16, float>();
+        ExpectDotMatchesReference<rad::Float8E4M3, float>();
+        ExpectDotMatchesReference<rad::Float8E5M2, float>();
+        ExpectDotPropagatesNaN<rad::BFloat16>();
+        ExpectDotPropagatesNaN<rad::Float16>();
+        ExpectDotPropagatesNaN<rad::Float8E4M3>();
+        ExpectDotPropagatesNaN<rad::Float8E5M2>();
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, BlasAxpy)
+{
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        SCOPED_TRACE(static_cast<int>(level));
+        ExpectAxpyMatchesReference<float>();
+        ExpectAxpyMatchesReference<rad::BFloat16>();
+        ExpectAxpyMatchesReference<rad::Float16>();
+        ExpectAxpyMatchesReference<rad::Float8E4M3>();
+        ExpectAxpyMatchesReference<rad::Float8E5M2>();
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, BlasGemv)
+{
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        SCOPED_TRACE(static_cast<int>(level));
+        ExpectGemvMatchesReference<float>();
+        ExpectGemvMatchesReference<rad::BFloat16>();
+        ExpectGemvMatchesReference<rad::Float16>();
+        ExpectGemvMatchesReference<rad::Float8E4M3>();
+        ExpectGemvMatchesReference<rad::Float8E5M2>();
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
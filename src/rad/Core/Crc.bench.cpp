@@ -0,0 +1,119 @@
+#include <rad/Core/Crc.h>
+#include <rad/System/CpuInfo.h>
+#include <rad/System/ParallelCrc.h>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/crc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// The argument selects the rad::SimdLevel limit; unsupported levels are skipped.
+bool ApplySimdLevel(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return false;
+    }
+    rad::SetSimdLevelLimit(level);
+    return true;
+}
+
+std::vector<std::uint8_t> MakePayload(std::size_t size)
+{
+    std::mt19937 random(1);
+    std::vector<std::uint8_t> payload(size);
+    for (std::uint8_t& value : payload)
+    {
+        value = static_cast<std::uint8_t>(random());
+    }
+    return payload;
+}
+
+// Typical block size; small enough to stay in L2 so the kernels rather than memory are measured.
+constexpr std::size_t PayloadSize = 64 * 1024;
+
+template <typename Crc>
+void BM_Crc(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<std::uint8_t> payload = MakePayload(PayloadSize);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Crc::Compute(payload.data(), payload.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(PayloadSize));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// The byte-at-a-time boost engine that rad::Crc used for every polynomial before.
+template <typename Engine>
+void BM_CrcBoost(benchmark::State& state)
+{
+    const std::vector<std::uint8_t> payload = MakePayload(PayloadSize);
+    for (auto _ : state)
+    {
+        Engine engine;
+        engine.process_bytes(payload.data(), payload.size());
+        benchmark::DoNotOptimize(engine.checksum());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(PayloadSize));
+}
+
+// Large enough that every worker gets a multi-megabyte segment; the argument is the thread count.
+void BM_Crc32ComputeParallel(benchmark::State& state)
+{
+    const std::vector<std::uint8_t> payload = MakePayload(64 * 1024 * 1024);
+    rad::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            rad::ComputeCrcParallel<rad::Crc32>(payload.data(), payload.size(), pool));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(payload.size()));
+}
+
+void BM_Crc32Combine(benchmark::State& state)
+{
+    std::uint32_t crc = 0;
+    for (auto _ : state)
+    {
+        crc = rad::Crc32::Combine(crc, 0x12345678u, std::uint64_t{1} << 30);
+        benchmark::DoNotOptimize(crc);
+    }
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                       rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+using BoostCrc32Iscsi = boost::crc_optimal<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, true>;
+using BoostCrc64Xz = boost::crc_optimal<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF,
+                                        0xFFFFFFFFFFFFFFFF, true, true>;
+
+} // namespace
+
+BENCHMARK(BM_CrcBoost<boost::crc_32_type>)->Name("BM_CrcBoost/Crc32IsoHdlc");
+BENCHMARK(BM_CrcBoost<BoostCrc32Iscsi>)->Name("BM_CrcBoost/Crc32Iscsi");
+BENCHMARK(BM_CrcBoost<BoostCrc64Xz>)->Name("BM_CrcBoost/Crc64Xz");
+BENCHMARK(BM_Crc<rad::Crc32IsoHdlc>)->Name("BM_Crc32IsoHdlc")->Apply(SimdLevels);
+BENCHMARK(BM_Crc<rad::Crc32Iscsi>)->Name("BM_Crc32Iscsi")->Apply(SimdLevels);
+BENCHMARK(BM_Crc<rad::Crc64Xz>)->Name("BM_Crc64Xz")->Apply(SimdLevels);
+BENCHMARK(BM_Crc32ComputeParallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_Crc32Combine);
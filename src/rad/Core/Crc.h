@@ -4,6 +4,7 @@
 
 #include <boost/crc.hpp>
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <ranges>
@@ -12,7 +13,85 @@
 namespace rad
 {
 
-// Generic, table-driven CRC calculator.
+namespace detail
+{
+
+// Fast paths for the common reflected polynomials, dispatched at run time to CRC instructions,
+// PCLMULQDQ folding or slicing-by-8 tables. They take and return the reflected remainder before
+// the final XOR, so they serve every initial remainder and final XOR of their polynomial.
+[[nodiscard]] Uint32 UpdateCrc32IsoHdlc(Uint32 remainder, const void* data,
+                                        std::size_t size) noexcept;
+[[nodiscard]] Uint32 UpdateCrc32Iscsi(Uint32 remainder, const void* data,
+                                      std::size_t size) noexcept;
+[[nodiscard]] Uint64 UpdateCrc64Xz(Uint64 remainder, const void* data, std::size_t size) noexcept;
+
+template <std::size_t Bits, Uint64 Polynomial, bool ReflectInput, bool ReflectRemainder>
+struct AcceleratedCrc
+{
+    static constexpr bool Enabled = false;
+};
+
+template <>
+struct AcceleratedCrc<32, 0x04C11DB7, true, true>
+{
+    static constexpr bool Enabled = true;
+    static constexpr auto Update = UpdateCrc32IsoHdlc;
+};
+
+template <>
+struct AcceleratedCrc<32, 0x1EDC6F41, true, true>
+{
+    static constexpr bool Enabled = true;
+    static constexpr auto Update = UpdateCrc32Iscsi;
+};
+
+template <>
+struct AcceleratedCrc<64, 0x42F0E1EBA9EA3693, true, true>
+{
+    static constexpr bool Enabled = true;
+    static constexpr auto Update = UpdateCrc64Xz;
+};
+
+// Product of two polynomials of degree below Bits, modulo Polynomial in normal form.
+template <std::size_t Bits, Uint64 Polynomial>
+[[nodiscard]] constexpr Uint64 CrcMultiplyModulo(Uint64 lhs, Uint64 rhs) noexcept
+{
+    constexpr Uint64 mask = (Bits == 64) ? ~Uint64{0} : (Uint64{1} << Bits) - 1;
+    constexpr Uint64 topBit = Uint64{1} << (Bits - 1);
+    Uint64 product = 0;
+    for (Uint64 bit = topBit; bit != 0; bit >>= 1)
+    {
+        const bool carry = (product & topBit) != 0;
+        product = (product << 1) & mask;
+        if (carry)
+        {
+            product ^= Polynomial;
+        }
+        if ((rhs & bit) != 0)
+        {
+            product ^= lhs;
+        }
+    }
+    return product;
+}
+
+// CrcPowersOfX[k] is x^(2^k) modulo Polynomial, enough to shift by any 64-bit byte count.
+template <std::size_t Bits, Uint64 Polynomial>
+inline constexpr std::array<Uint64, 67> CrcPowersOfX = []()
+{
+    std::array<Uint64, 67> powers = {};
+    powers[0] = (Bits == 1) ? (Polynomial & 1) : 2;
+    for (std::size_t index = 1; index < powers.size(); ++index)
+    {
+        powers[index] = CrcMultiplyModulo<Bits, Polynomial>(powers[index - 1], powers[index - 1]);
+    }
+    return powers;
+}();
+
+} // namespace detail
+
+// Generic, table-driven CRC calculator. Reflected CRC-32, CRC-32C and CRC-64/XZ polynomials use
+// the hardware-accelerated paths in detail.
 template <std::size_t Bits, Uint64 Polynomial, Uint64 InitialRemainder = 0,
           bool ReflectInput = false, bool ReflectRemainder = false, Uint64 FinalXor = 0>
 class Crc
@@ -21,20 +100,28 @@ class Crc
 
     using Engine = boost::crc_optimal<Bits, Polynomial, InitialRemainder, FinalXor, ReflectInput,
                                       ReflectRemainder>;
+    using Accelerated = detail::AcceleratedCrc<Bits, Polynomial, ReflectInput, ReflectRemainder>;
 
 public:
     using ValueType = std::conditional_t<(Bits <= 32), Uint32, Uint64>;
 
     Crc() noexcept = default;
 
-    void Reset() noexcept { m_engine.reset(); }
+    void Reset() noexcept { m_state = InitialState(); }
 
     void Update(const void* data, std::size_t size) noexcept
     {
         assert(data != nullptr || size == 0);
         if (size != 0)
         {
-            m_engine.process_bytes(data, size);
+            if constexpr (Accelerated::Enabled)
+            {
+                m_state = Accelerated::Update(m_state, data, size);
+            }
+            else
+            {
+                m_state.process_bytes(data, size);
+            }
         }
     }
 
@@ -59,7 +146,14 @@ public:
 
     [[nodiscard]] ValueType Value() const noexcept
     {
-        return static_cast<ValueType>(m_engine.checksum());
+        if constexpr (Accelerated::Enabled)
+        {
+            return static_cast<ValueType>(m_state ^ FinalXor);
+        }
+        else
+        {
+            return static_cast<ValueType>(m_state.checksum());
+        }
     }
 
     [[nodiscard]] static ValueType Compute(const void* data, std::size_t size) noexcept
@@ -78,8 +172,63 @@ public:
         return crc.Value();
     }
 
+    // Returns the CRC of A followed by B, given crcA, crcB and the size of B in bytes, without
+    // touching the data. Takes O(log sizeB) polynomial multiplications.
+    [[nodiscard]] static constexpr ValueType Combine(ValueType crcA, ValueType crcB,
+                                                     std::uint64_t sizeB) noexcept
+    {
+        // In the unreflected register domain, appending B shifts A's register by sizeB zero
+        // bytes. B's own register then adds on top, once the initial remainder that crcB already
+        // includes has been taken out.
+        const Uint64 registerA = ToRegister(crcA) ^ InitialRemainder;
+        const Uint64 registerB = ToRegister(crcB);
+        Uint64 shifted = registerA;
+        for (std::size_t power = 3; sizeB != 0; sizeB >>= 1, ++power)
+        {
+            if ((sizeB & 1) != 0)
+            {
+                shifted = detail::CrcMultiplyModulo<Bits, Polynomial>(
+                    shifted, detail::CrcPowersOfX<Bits, Polynomial>[power]);
+            }
+        }
+        return FromRegister(shifted ^ registerB);
+    }
+
 private:
-    Engine m_engine;
+    // Reverses the low Bits bits.
+    [[nodiscard]] static constexpr Uint64 Reflect(Uint64 value) noexcept
+    {
+        return ReverseBits(value) >> (64 - Bits);
+    }
+
+    // Maps a CRC value to the unreflected register that produced it, and back.
+    [[nodiscard]] static constexpr Uint64 ToRegister(ValueType value) noexcept
+    {
+        const Uint64 remainder = value ^ FinalXor;
+        return ReflectRemainder ? Reflect(remainder) : remainder;
+    }
+
+    [[nodiscard]] static constexpr ValueType FromRegister(Uint64 value) noexcept
+    {
+        return static_cast<ValueType>((ReflectRemainder ? Reflect(value) : value) ^ FinalXor);
+    }
+
+    // Accelerated CRCs keep the reflected remainder instead of a boost engine.
+    using State = std::conditional_t<Accelerated::Enabled, ValueType, Engine>;
+
+    [[nodiscard]] static State InitialState() noexcept
+    {
+        if constexpr (Accelerated::Enabled)
+        {
+            return ReverseBits(static_cast<ValueType>(InitialRemainder));
+        }
+        else
+        {
+            return Engine();
+        }
+    }
+
+    State m_state = InitialState();
 }; // class Crc
 
 using Crc8Smbus = Crc<8, 0x07>;
@@ -1,11 +1,131 @@
 #include <rad/Core/Crc.h>
+#include <rad/System/CpuInfo.h>
 
 #include <gtest/gtest.h>
 
+#include <boost/crc.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
 #include <string_view>
+#include <vector>
 
 TEST(Core, Crc)
 {
     constexpr std::string_view data = "123456789";
     EXPECT_EQ(rad::Crc32::Compute(data), 0xCBF43926u);
+    EXPECT_EQ(rad::Crc32Iscsi::Compute(data), 0xE3069283u);
+    EXPECT_EQ(rad::Crc32Bzip2::Compute(data), 0xFC891918u);
+    EXPECT_EQ(rad::Crc64Xz::Compute(data), 0x995DC9BBDF1939FAull);
+    EXPECT_EQ(rad::Crc64Ecma182::Compute(data), 0x6C40DF5F0B497347ull);
+}
+
+namespace
+{
+
+template <typename Crc, typename Reference>
+void ExpectCrcMatchesReference(const std::vector<std::uint8_t>& data)
+{
+    // Every length up to a few folding blocks, at every alignment, then split into pieces.
+    for (std::size_t offset = 0; offset < 16; ++offset)
+    {
+        for (std::size_t size = 0; offset + size <= 700; size += (size < 300) ? 1 : 37)
+        {
+            Reference reference;
+            reference.process_bytes(data.data() + offset, size);
+            ASSERT_EQ(Crc::Compute(data.data() + offset, size), reference.checksum())
+                << "offset " << offset << ", size " << size;
+        }
+    }
+
+    Reference reference;
+    reference.process_bytes(data.data(), data.size());
+    for (const std::size_t piece : {1, 7, 64, 129, 1000})
+    {
+        Crc crc;
+        for (std::size_t offset = 0; offset < data.size(); offset += piece)
+        {
+            crc.Update(data.data() + offset, std::min(piece, data.size() - offset));
+        }
+        EXPECT_EQ(crc.Value(), reference.checksum()) << "piece " << piece;
+    }
+}
+
+} // namespace
+
+TEST(Core, CrcAcceleratedMatchesReference)
+{
+    std::mt19937 random(3);
+    std::vector<std::uint8_t> data(4096);
+    for (std::uint8_t& value : data)
+    {
+        value = static_cast<std::uint8_t>(random());
+    }
+
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                       rad::SimdLevel::AVX2, rad::SimdLevel::NEON})
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        ExpectCrcMatchesReference<rad::Crc32IsoHdlc, boost::crc_32_type>(data);
+        ExpectCrcMatchesReference<rad::Crc32Iscsi,
+                                  boost::crc_optimal<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF,
+                                                     true, true>>(data);
+        ExpectCrcMatchesReference<rad::Crc64Xz,
+                                  boost::crc_optimal<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF,
+                                                     0xFFFFFFFFFFFFFFFF, true, true>>(data);
+        // Same polynomial as CRC-32 with a different initial remainder and final XOR.
+        ExpectCrcMatchesReference<rad::Crc<32, 0x04C11DB7, 0x12345678, true, true>,
+                                  boost::crc_optimal<32, 0x04C11DB7, 0x12345678, 0, true, true>>(
+            data);
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+namespace
+{
+
+template <typename Crc>
+void ExpectCombineMatchesCompute(const std::vector<std::uint8_t>& data)
+{
+    for (const std::size_t split : {0, 1, 3, 8, 100, 999, 1000})
+    {
+        const auto crcA = Crc::Compute(data.data(), split);
+        const auto crcB = Crc::Compute(data.data() + split, data.size() - split);
+        EXPECT_EQ(Crc::Combine(crcA, crcB, data.size() - split),
+                  Crc::Compute(data.data(), data.size()))
+            << "split " << split;
+    }
+}
+
+} // namespace
+
+TEST(Core, CrcCombine)
+{
+    std::mt19937 random(5);
+    std::vector<std::uint8_t> data(1000);
+    for (std::uint8_t& value : data)
+    {
+        value = static_cast<std::uint8_t>(random());
+    }
+
+    ExpectCombineMatchesCompute<rad::Crc8Smbus>(data);
+    ExpectCombineMatchesCompute<rad::Crc16Arc>(data);
+    ExpectCombineMatchesCompute<rad::Crc16Ibm3740>(data);
+    ExpectCombineMatchesCompute<rad::Crc16Usb>(data);
+    ExpectCombineMatchesCompute<rad::Crc24OpenPgp>(data);
+    ExpectCombineMatchesCompute<rad::Crc32Bzip2>(data);
+    ExpectCombineMatchesCompute<rad::Crc32IsoHdlc>(data);
+    ExpectCombineMatchesCompute<rad::Crc32Iscsi>(data);
+    ExpectCombineMatchesCompute<rad::Crc64Ecma182>(data);
+    ExpectCombineMatchesCompute<rad::Crc64Xz>(data);
+    // CRC-5/USB: narrower than a byte, reflected, with a final XOR.
+    ExpectCombineMatchesCompute<rad::Crc<5, 0x05, 0x1F, true, true, 0x1F>>(data);
+
+    static_assert(rad::Crc32::Combine(0xCBF43926u, 0, 0) == 0xCBF43926u);
 }
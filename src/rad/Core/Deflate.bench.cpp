@@ -0,0 +1,67 @@
+#include <rad/Core/Deflate.h>
+#include <rad/System/ThreadPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t PayloadSize = 8 * 1024 * 1024;
+
+// Slowly varying bytes with sparse noise, like the filtered rows of a photograph.
+std::vector<std::uint8_t> MakePayload()
+{
+    std::mt19937 random(1);
+    std::vector<std::uint8_t> payload(PayloadSize);
+    for (std::size_t index = 0; index < payload.size(); ++index)
+    {
+        const std::uint32_t noise = (random() % 4 == 0) ? random() % 8 : 0;
+        payload[index] = static_cast<std::uint8_t>((index % 3000) / 40 + noise);
+    }
+    return payload;
+}
+
+// The argument is the compression level.
+void BM_CompressZlib(benchmark::State& state)
+{
+    const std::vector<std::uint8_t> payload = MakePayload();
+    std::vector<std::uint8_t> compressed;
+    for (auto _ : state)
+    {
+        compressed.clear();
+        rad::CompressZlib(payload, compressed, static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(PayloadSize));
+    state.counters["ratio"] =
+        static_cast<double>(PayloadSize) / static_cast<double>(compressed.size());
+}
+
+// The arguments are the compression level and the pool's worker count.
+void BM_CompressZlibParallel(benchmark::State& state)
+{
+    const std::vector<std::uint8_t> payload = MakePayload();
+    rad::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+    std::vector<std::uint8_t> compressed;
+    for (auto _ : state)
+    {
+        compressed.clear();
+        rad::CompressZlibParallel(payload, compressed, static_cast<int>(state.range(0)), pool);
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(PayloadSize));
+    state.counters["ratio"] =
+        static_cast<double>(PayloadSize) / static_cast<double>(compressed.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_CompressZlib)->Arg(0)->Arg(1)->Arg(3)->Arg(6)->Arg(9);
+BENCHMARK(BM_CompressZlibParallel)
+    ->ArgsProduct({{1, 6}, {1, 3, 7}})
+    ->UseRealTime();
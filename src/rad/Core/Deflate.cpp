@@ -0,0 +1,625 @@
+#include <rad/Core/Deflate.h>
+#include <rad/System/ThreadPool.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace rad
+{
+namespace
+{
+
+constexpr std::uint32_t AdlerModulus = 65521;
+// The largest block whose sums cannot overflow 32 bits before they are reduced.
+constexpr std::size_t AdlerBlockSize = 5552;
+
+constexpr std::size_t WindowSize = 32768;
+constexpr std::size_t MinMatch = 3;
+constexpr std::size_t MaxMatch = 258;
+constexpr int HashBits = 15;
+constexpr std::size_t HashSize = std::size_t{1} << HashBits;
+constexpr std::size_t MaxStoredBlockSize = 65535;
+// Serial compression also works in segments, so that chain positions fit in 32 bits.
+constexpr std::size_t MaxSegmentSize = std::size_t{1} << 30;
+constexpr unsigned EndOfBlock = 256;
+
+// Search effort per level, following zlib's configuration table from level 4 on.
+struct LevelParameters
+{
+    // Candidates examined per position.
+    int maxChain;
+    // The lazy search of the next position examines a quarter of the candidates after a match
+    // at least this long.
+    std::size_t goodLength;
+    // Matches shorter than this are emitted only if the next position has no longer match; zero
+    // emits every match at once.
+    std::size_t lazyLength;
+    // A match this long ends the search.
+    std::size_t niceLength;
+};
+
+constexpr std::array<LevelParameters, 10> Levels = {{
+    {0, 0, 0, 0},
+    {4, 0, 0, 16},
+    {8, 0, 0, 32},
+    {16, 0, 0, 64},
+    {16, 4, 4, 16},
+    {32, 8, 16, 32},
+    {128, 8, 16, 128},
+    {256, 8, 32, 128},
+    {1024, 32, 128, MaxMatch},
+    {4096, 32, MaxMatch, MaxMatch},
+}};
+
+void ValidateLevel(int level)
+{
+    if ((level < 0) || (level > 9))
+    {
+        throw std::invalid_argument{"compression level must be between 0 and 9"};
+    }
+}
+
+// A Huffman code with its extra bits, ready to be written least significant bit first.
+struct Code
+{
+    std::uint32_t bits = 0;
+    int length = 0;
+};
+
+[[nodiscard]] constexpr std::uint32_t ReverseCode(std::uint32_t code, int length) noexcept
+{
+    std::uint32_t reversed = 0;
+    for (int bit = 0; bit < length; ++bit)
+    {
+        reversed = (reversed << 1) | ((code >> bit) & 1);
+    }
+    return reversed;
+}
+
+// The fixed literal/length code of RFC 1951 Section 3.2.6.
+[[nodiscard]] constexpr Code FixedLiteralCode(unsigned symbol) noexcept
+{
+    if (symbol < 144)
+    {
+        return {ReverseCode(0x30 + symbol, 8), 8};
+    }
+    if (symbol < 256)
+    {
+        return {ReverseCode(0x190 + symbol - 144, 9), 9};
+    }
+    if (symbol < 280)
+    {
+        return {ReverseCode(symbol - 256, 7), 7};
+    }
+    return {ReverseCode(0xC0 + symbol - 280, 8), 8};
+}
+
+constexpr std::array<std::uint16_t, 29> LengthBases = {
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+constexpr std::array<std::uint8_t, 29> LengthExtraBits = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+constexpr std::array<std::uint16_t, 30> DistanceBases = {
+    1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+    193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+
+[[nodiscard]] constexpr int DistanceExtraBits(std::size_t index) noexcept
+{
+    return index < 4 ? 0 : static_cast<int>(index / 2 - 1);
+}
+
+[[nodiscard]] constexpr std::array<Code, 288> MakeLiteralCodes() noexcept
+{
+    std::array<Code, 288> codes = {};
+    for (unsigned symbol = 0; symbol < codes.size(); ++symbol)
+    {
+        codes[symbol] = FixedLiteralCode(symbol);
+    }
+    return codes;
+}
+
+// Length symbol code and extra bits for every match length, indexed by length.
+[[nodiscard]] constexpr std::array<Code, MaxMatch + 1> MakeLengthCodes() noexcept
+{
+    std::array<Code, MaxMatch + 1> codes = {};
+    for (std::size_t length = MinMatch; length <= MaxMatch; ++length)
+    {
+        std::size_t index = LengthBases.size() - 1;
+        while (LengthBases[index] > length)
+        {
+            --index;
+        }
+        const Code symbol = FixedLiteralCode(static_cast<unsigned>(257 + index));
+        codes[length] = {symbol.bits | static_cast<std::uint32_t>((length - LengthBases[index])
+                                                                  << symbol.length),
+                         symbol.length + LengthExtraBits[index]};
+    }
+    return codes;
+}
+
+// Distance codes of distances 1 to 256 by distance - 1, then of larger distances by
+// 256 + (distance - 1) / 128, as zlib indexes them.
+[[nodiscard]] constexpr std::array<std::uint8_t, 512> MakeDistanceCodes() noexcept
+{
+    std::array<std::uint8_t, 512> codes = {};
+    std::size_t index = 0;
+    for (std::size_t distance = 1; distance <= WindowSize; ++distance)
+    {
+        while ((index + 1 < DistanceBases.size()) && (DistanceBases[index + 1] <= distance))
+        {
+            ++index;
+        }
+        const std::size_t slot = distance <= 256 ? distance - 1 : 256 + ((distance - 1) >> 7);
+        codes[slot] = static_cast<std::uint8_t>(index);
+    }
+    return codes;
+}
+
+// The fixed distance codes are the 5-bit symbol numbers.
+[[nodiscard]] constexpr std::array<std::uint8_t, 30> MakeDistanceSymbolCodes() noexcept
+{
+    std::array<std::uint8_t, 30> codes = {};
+    for (std::uint32_t symbol = 0; symbol < codes.size(); ++symbol)
+    {
+        codes[symbol] = static_cast<std::uint8_t>(ReverseCode(symbol, 5));
+    }
+    return codes;
+}
+
+constexpr std::array<Code, 288> LiteralCodes = MakeLiteralCodes();
+constexpr std::array<Code, MaxMatch + 1> LengthCodes = MakeLengthCodes();
+constexpr std::array<std::uint8_t, 512> DistanceCodes = MakeDistanceCodes();
+constexpr std::array<std::uint8_t, 30> DistanceSymbolCodes = MakeDistanceSymbolCodes();
+
+// Appends bits to a byte vector, least significant bit first.
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<std::uint8_t>& output) noexcept :
+        m_output(output),
+        m_size(output.size())
+    {
+    }
+
+    // count must not exceed 32.
+    void Put(std::uint32_t bits, int count)
+    {
+        m_buffer |= static_cast<std::uint64_t>(bits) << m_count;
+        m_count += count;
+        if (m_count >= 32)
+        {
+            Reserve(4);
+            for (int byte = 0; byte < 4; ++byte)
+            {
+                m_output[m_size++] = static_cast<std::uint8_t>(m_buffer >> (8 * byte));
+            }
+            m_buffer >>= 32;
+            m_count -= 32;
+        }
+    }
+
+    void PutCode(const Code& code) { Put(code.bits, code.length); }
+
+    void PutMatch(std::size_t length, std::size_t distance)
+    {
+        PutCode(LengthCodes[length]);
+        const std::size_t slot = distance <= 256 ? distance - 1 : 256 + ((distance - 1) >> 7);
+        const std::size_t index = DistanceCodes[slot];
+        Put(DistanceSymbolCodes[index] |
+                static_cast<std::uint32_t>((distance - DistanceBases[index]) << 5),
+            5 + DistanceExtraBits(index));
+    }
+
+    // Pads the last partial byte with zero bits.
+    void AlignToByte()
+    {
+        Reserve(8);
+        while (m_count > 0)
+        {
+            m_output[m_size++] = static_cast<std::uint8_t>(m_buffer);
+            m_buffer >>= 8;
+            m_count = std::max(m_count - 8, 0);
+        }
+        m_buffer = 0;
+    }
+
+    // Must follow AlignToByte.
+    void PutBytes(const std::uint8_t* data, std::size_t size)
+    {
+        if (size != 0)
+        {
+            Reserve(size);
+            std::memcpy(m_output.data() + m_size, data, size);
+            m_size += size;
+        }
+    }
+
+    // Aligns to a byte and trims the output to what was written.
+    void Finish()
+    {
+        AlignToByte();
+        m_output.resize(m_size);
+    }
+
+private:
+    void Reserve(std::size_t size)
+    {
+        if (m_size + size > m_output.size())
+        {
+            m_output.resize(std::max(m_size + size, m_output.size() * 2));
+        }
+    }
+
+    std::vector<std::uint8_t>& m_output;
+    // Bytes written; the vector is grown ahead of it.
+    std::size_t m_size;
+    std::uint64_t m_buffer = 0;
+    int m_count = 0;
+}; // class BitWriter
+
+struct Match
+{
+    std::size_t length = 0;
+    std::size_t distance = 0;
+};
+
+[[nodiscard]] std::size_t MatchLength(const std::uint8_t* lhs, const std::uint8_t* rhs,
+                                      std::size_t maxLength) noexcept
+{
+    std::size_t length = 0;
+    while (length + 8 <= maxLength)
+    {
+        std::uint64_t lhsWord;
+        std::uint64_t rhsWord;
+        std::memcpy(&lhsWord, lhs + length, sizeof(lhsWord));
+        std::memcpy(&rhsWord, rhs + length, sizeof(rhsWord));
+        if (const std::uint64_t difference = lhsWord ^ rhsWord; difference != 0)
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return length + static_cast<std::size_t>(std::countr_zero(difference) / 8);
+            }
+            else
+            {
+                return length + static_cast<std::size_t>(std::countl_zero(difference) / 8);
+            }
+        }
+        length += 8;
+    }
+    while ((length < maxLength) && (lhs[length] == rhs[length]))
+    {
+        ++length;
+    }
+    return length;
+}
+
+// Hash chains of 3-byte prefixes over one segment and the window before it. Slots hold positions
+// relative to the start of the window plus one, so that zero marks an empty slot.
+class Matcher
+{
+public:
+    Matcher(const std::uint8_t* data, std::size_t dataSize, std::size_t windowStart,
+            const LevelParameters& parameters) :
+        m_data(data),
+        m_dataSize(dataSize),
+        m_windowStart(windowStart),
+        m_parameters(parameters),
+        m_head(HashSize),
+        m_previous(WindowSize)
+    {
+    }
+
+    void Insert(std::size_t position) noexcept
+    {
+        if (position + MinMatch <= m_dataSize)
+        {
+            const std::uint32_t hash = Hash(position);
+            m_previous[position % WindowSize] = m_head[hash];
+            m_head[hash] = Slot(position);
+        }
+    }
+
+    // Inserts position and returns its longest match ending at or before end, or a zero length.
+    [[nodiscard]] Match Find(std::size_t position, std::size_t end, int maxChain) noexcept
+    {
+        if (position + MinMatch > m_dataSize)
+        {
+            return {};
+        }
+        const std::uint32_t hash = Hash(position);
+        std::uint32_t candidate = m_head[hash];
+        m_previous[position % WindowSize] = candidate;
+        m_head[hash] = Slot(position);
+
+        const std::size_t maxLength = std::min(MaxMatch, end - position);
+        if (maxLength < MinMatch)
+        {
+            return {};
+        }
+        const std::uint8_t* current = m_data + position;
+        Match best{MinMatch - 1, 0};
+        for (int chain = maxChain; (candidate != 0) && (chain > 0); --chain)
+        {
+            const std::size_t candidatePosition = m_windowStart + candidate - 1;
+            const std::size_t distance = position - candidatePosition;
+            if (distance >= WindowSize)
+            {
+                break;
+            }
+            const std::uint8_t* previous = m_data + candidatePosition;
+            if ((previous[best.length] == current[best.length]) && (previous[0] == current[0]))
+            {
+                const std::size_t length = MatchLength(previous, current, maxLength);
+                if (length > best.length)
+                {
+                    best = {length, distance};
+                    if ((length >= m_parameters.niceLength) || (length == maxLength))
+                    {
+                        break;
+                    }
+                }
+            }
+            const std::uint32_t next = m_previous[candidatePosition % WindowSize];
+            if (next >= candidate)
+            {
+                break;
+            }
+            candidate = next;
+        }
+        return best.length >= MinMatch ? best : Match{};
+    }
+
+private:
+    [[nodiscard]] std::uint32_t Hash(std::size_t position) const noexcept
+    {
+        const std::uint8_t* bytes = m_data + position;
+        const std::uint32_t value = static_cast<std::uint32_t>(bytes[0]) |
+                                    (static_cast<std::uint32_t>(bytes[1]) << 8) |
+                                    (static_cast<std::uint32_t>(bytes[2]) << 16);
+        return (value * 0x9E3779B1u) >> (32 - HashBits);
+    }
+
+    [[nodiscard]] std::uint32_t Slot(std::size_t position) const noexcept
+    {
+        return static_cast<std::uint32_t>(position - m_windowStart + 1);
+    }
+
+    const std::uint8_t* m_data;
+    std::size_t m_dataSize;
+    std::size_t m_windowStart;
+    const LevelParameters& m_parameters;
+    std::vector<std::uint32_t> m_head;
+    std::vector<std::uint32_t> m_previous;
+}; // class Matcher
+
+void WriteStoredBlocks(const std::uint8_t* data, std::size_t begin, std::size_t end, bool final,
+                       BitWriter& writer)
+{
+    do
+    {
+        const std::size_t blockSize = std::min(MaxStoredBlockSize, end - begin);
+        const bool lastBlock = final && (begin + blockSize == end);
+        writer.Put(lastBlock ? 1 : 0, 3);
+        writer.AlignToByte();
+        const auto length = static_cast<std::uint16_t>(blockSize);
+        const std::uint8_t header[4] = {
+            static_cast<std::uint8_t>(length),
+            static_cast<std::uint8_t>(length >> 8),
+            static_cast<std::uint8_t>(~length),
+            static_cast<std::uint8_t>(~length >> 8),
+        };
+        writer.PutBytes(header, sizeof(header));
+        writer.PutBytes(data + begin, blockSize);
+        begin += blockSize;
+    } while (begin < end);
+}
+
+void WriteFixedBlock(const std::uint8_t* data, std::size_t dataSize, std::size_t begin,
+                     std::size_t end, bool final, const LevelParameters& parameters,
+                     BitWriter& writer)
+{
+    Matcher matcher{data, dataSize, begin - std::min(begin, WindowSize), parameters};
+    for (std::size_t position = begin - std::min(begin, WindowSize); position < begin; ++position)
+    {
+        matcher.Insert(position);
+    }
+
+    writer.Put(final ? 0b011 : 0b010, 3);
+    std::size_t position = begin;
+    Match carried;
+    while (position < end)
+    {
+        Match match =
+            carried.length != 0 ? carried : matcher.Find(position, end, parameters.maxChain);
+        carried = {};
+        if (match.length == 0)
+        {
+            writer.PutCode(LiteralCodes[data[position]]);
+            ++position;
+            continue;
+        }
+        std::size_t inserted = position + 1;
+        if ((match.length < parameters.lazyLength) && (position + 1 < end))
+        {
+            // Emits a literal instead if the next position starts a longer match.
+            const int maxChain = match.length >= parameters.goodLength ? parameters.maxChain / 4
+                                                                       : parameters.maxChain;
+            const Match next = matcher.Find(position + 1, end, maxChain);
+            if (next.length > match.length)
+            {
+                writer.PutCode(LiteralCodes[data[position]]);
+                ++position;
+                carried = next;
+                continue;
+            }
+            ++inserted;
+        }
+        writer.PutMatch(match.length, match.distance);
+        position += match.length;
+        for (; inserted < position; ++inserted)
+        {
+            matcher.Insert(inserted);
+        }
+    }
+    writer.PutCode(LiteralCodes[EndOfBlock]);
+}
+
+// Compresses data[begin, end), which may refer back into the window before begin.
+void WriteSegment(const std::uint8_t* data, std::size_t dataSize, std::size_t begin,
+                  std::size_t end, bool final, int level, BitWriter& writer)
+{
+    if (level == 0)
+    {
+        if ((begin < end) || (final))
+        {
+            WriteStoredBlocks(data, begin, end, final, writer);
+        }
+        return;
+    }
+    WriteFixedBlock(data, dataSize, begin, end, final, Levels[static_cast<std::size_t>(level)],
+                    writer);
+}
+
+void WriteZlibHeader(std::vector<std::uint8_t>& output, int level)
+{
+    constexpr unsigned Deflate32KWindow = 0x78;
+    const unsigned levelFlag = level <= 1 ? 0 : level <= 5 ? 1 : level == 6 ? 2 : 3;
+    unsigned flags = levelFlag << 6;
+    flags += 31 - (Deflate32KWindow * 256 + flags) % 31;
+    output.push_back(static_cast<std::uint8_t>(Deflate32KWindow));
+    output.push_back(static_cast<std::uint8_t>(flags));
+}
+
+void WriteBigEndian(std::vector<std::uint8_t>& output, std::uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        output.push_back(static_cast<std::uint8_t>(value >> shift));
+    }
+}
+
+} // namespace
+
+std::uint32_t Adler32(Span<const std::uint8_t> data, std::uint32_t adler) noexcept
+{
+    std::uint32_t sum1 = adler & 0xFFFF;
+    std::uint32_t sum2 = adler >> 16;
+    const std::uint8_t* bytes = data.data();
+    std::size_t size = data.size();
+    while (size > 0)
+    {
+        const std::size_t blockSize = std::min(size, AdlerBlockSize);
+        for (std::size_t index = 0; index < blockSize; ++index)
+        {
+            sum1 += bytes[index];
+            sum2 += sum1;
+        }
+        sum1 %= AdlerModulus;
+        sum2 %= AdlerModulus;
+        bytes += blockSize;
+        size -= blockSize;
+    }
+    return (sum2 << 16) | sum1;
+}
+
+std::uint32_t CombineAdler32(std::uint32_t adlerA, std::uint32_t adlerB,
+                             std::uint64_t sizeB) noexcept
+{
+    // Appending B adds sizeB copies of A's first sum to the second sum; B's own sums then add on
+    // top, less the initial 1 that each of them already includes.
+    const auto remainder = static_cast<std::uint32_t>(sizeB % AdlerModulus);
+    std::uint32_t sum1 = adlerA & 0xFFFF;
+    std::uint32_t sum2 = static_cast<std::uint32_t>(
+        (static_cast<std::uint64_t>(remainder) * sum1) % AdlerModulus);
+    sum1 += (adlerB & 0xFFFF) + AdlerModulus - 1;
+    sum2 += (adlerA >> 16) + (adlerB >> 16) + AdlerModulus - remainder;
+    sum1 %= AdlerModulus;
+    sum2 %= AdlerModulus;
+    return (sum2 << 16) | sum1;
+}
+
+void CompressZlib(Span<const std::uint8_t> data, std::vector<std::uint8_t>& output, int level)
+{
+    ValidateLevel(level);
+    WriteZlibHeader(output, level);
+    BitWriter writer{output};
+    const std::size_t size = data.size();
+    std::size_t begin = 0;
+    do
+    {
+        const std::size_t end = begin + std::min(MaxSegmentSize, size - begin);
+        WriteSegment(data.data(), size, begin, end, end == size, level, writer);
+        begin = end;
+    } while (begin < size);
+    writer.Finish();
+    WriteBigEndian(output, Adler32(data));
+}
+
+void CompressZlibParallel(Span<const std::uint8_t> data, std::vector<std::uint8_t>& output,
+                          int level, ThreadPool& pool, std::size_t minSegmentSize)
+{
+    ValidateLevel(level);
+    const std::size_t size = data.size();
+    const std::size_t segmentCount =
+        std::max(std::clamp<std::size_t>(size / std::max<std::size_t>(minSegmentSize, 1), 1,
+                                         pool.GetThreadCount() + 1),
+                 (size + MaxSegmentSize - 1) / MaxSegmentSize);
+    if (segmentCount == 1)
+    {
+        CompressZlib(data, output, level);
+        return;
+    }
+
+    const std::size_t segmentSize = size / segmentCount;
+    std::vector<std::vector<std::uint8_t>> segments(segmentCount);
+    std::vector<std::uint32_t> adlers(segmentCount);
+    pool.ParallelFor(segmentCount,
+                     [&](std::size_t index)
+                     {
+                         const bool final = index + 1 == segmentCount;
+                         const std::size_t begin = index * segmentSize;
+                         const std::size_t end = final ? size : begin + segmentSize;
+                         BitWriter writer{segments[index]};
+                         WriteSegment(data.data(), size, begin, end, final, level, writer);
+                         if ((!final) && (level != 0))
+                         {
+                             // A sync flush: an empty stored block brings the segment to a byte
+                             // boundary without ending the stream.
+                             constexpr std::uint8_t EmptyStoredBlock[4] = {0x00, 0x00, 0xFF,
+                                                                           0xFF};
+                             writer.Put(0, 3);
+                             writer.AlignToByte();
+                             writer.PutBytes(EmptyStoredBlock, sizeof(EmptyStoredBlock));
+                         }
+                         writer.Finish();
+                         adlers[index] = Adler32({data.data() + begin, end - begin});
+                     });
+
+    std::size_t compressedSize = 0;
+    for (const std::vector<std::uint8_t>& segment : segments)
+    {
+        compressedSize += segment.size();
+    }
+    output.reserve(output.size() + compressedSize + 6);
+    WriteZlibHeader(output, level);
+    std::uint32_t adler = adlers[0];
+    for (std::size_t index = 0; index < segmentCount; ++index)
+    {
+        output.insert(output.end(), segments[index].begin(), segments[index].end());
+        if (index > 0)
+        {
+            const bool final = index + 1 == segmentCount;
+            adler = CombineAdler32(adler, adlers[index], final ? size - index * segmentSize
+                                                               : segmentSize);
+        }
+    }
+    WriteBigEndian(output, adler);
+}
+
+} // namespace rad
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <rad/Core/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rad
+{
+
+// Declared in rad/System/ThreadPool.h, which only CompressZlibParallel's callers need.
+class ThreadPool;
+[[nodiscard]] ThreadPool& GetGlobalThreadPool();
+
+// Adler-32 checksum of RFC 1950. Pass the previous result as adler to continue a running checksum.
+[[nodiscard]] std::uint32_t Adler32(Span<const std::uint8_t> data,
+                                    std::uint32_t adler = 1) noexcept;
+
+// Returns the Adler-32 of A followed by B, given adlerA, adlerB and the size of B in bytes.
+[[nodiscard]] std::uint32_t CombineAdler32(std::uint32_t adlerA, std::uint32_t adlerB,
+                                           std::uint64_t sizeB) noexcept;
+
+// Appends a zlib stream (RFC 1950) holding data to output, for PNG IDAT and similar containers.
+// Level 0 writes stored blocks. Levels 1 through 9 search hash chains of increasing length for
+// LZ77 matches, with lazy matching from level 4, and code them with the fixed Huffman tables of
+// RFC 1951; the output is comparable in size to stb_image_write's. Throws std::invalid_argument
+// for other levels.
+void CompressZlib(Span<const std::uint8_t> data, std::vector<std::uint8_t>& output, int level = 6);
+
+// Like CompressZlib, but compresses segments on the pool's workers and the calling thread. Each
+// segment is primed with the 32 KiB of data before it, so matches still reach across segment
+// boundaries, and ends on a byte boundary with an empty stored block, so the segments join into
+// one stream that any inflater reads. The output is a few bytes per segment larger than
+// CompressZlib's. Inputs too small to give each segment minSegmentSize bytes run serially.
+void CompressZlibParallel(Span<const std::uint8_t> data, std::vector<std::uint8_t>& output,
+                          int level = 6, ThreadPool& pool = GetGlobalThreadPool(),
+                          std::size_t minSegmentSize = 256 * 1024);
+
+} // namespace rad
@@ -0,0 +1,291 @@
+#include <rad/Core/Deflate.h>
+#include <rad/System/ThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+// Reads the zlib streams CompressZlib writes, which hold only stored and fixed Huffman blocks.
+class Inflater
+{
+public:
+    explicit Inflater(const std::vector<std::uint8_t>& stream) : m_stream(stream) {}
+
+    std::optional<std::vector<std::uint8_t>> Inflate()
+    {
+        if ((m_stream.size() < 6) || ((m_stream[0] & 0x0F) != 8) ||
+            (((m_stream[0] << 8) | m_stream[1]) % 31 != 0))
+        {
+            return std::nullopt;
+        }
+        m_position = 2;
+        std::vector<std::uint8_t> data;
+        bool final = false;
+        while (!final)
+        {
+            final = GetBits(1) != 0;
+            const std::uint32_t type = GetBits(2);
+            const bool inflated = (type == 0)   ? InflateStored(data)
+                                  : (type == 1) ? InflateFixed(data)
+                                                : false;
+            if ((m_failed) || (!inflated))
+            {
+                return std::nullopt;
+            }
+        }
+        m_bitCount = 0;
+        std::uint32_t adler = 0;
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            adler = (adler << 8) | GetByte();
+        }
+        if ((m_failed) || (m_position != m_stream.size()) || (adler != rad::Adler32(data)))
+        {
+            return std::nullopt;
+        }
+        return data;
+    }
+
+private:
+    std::uint32_t GetByte()
+    {
+        if (m_position == m_stream.size())
+        {
+            m_failed = true;
+            return 0;
+        }
+        return m_stream[m_position++];
+    }
+
+    std::uint32_t GetBits(int count)
+    {
+        std::uint32_t bits = 0;
+        for (int bit = 0; bit < count; ++bit)
+        {
+            if (m_bitCount == 0)
+            {
+                m_bits = GetByte();
+                m_bitCount = 8;
+            }
+            bits |= (m_bits & 1) << bit;
+            m_bits >>= 1;
+            --m_bitCount;
+        }
+        return bits;
+    }
+
+    // Reads a Huffman code, which is stored most significant bit first.
+    std::uint32_t GetCode(int length, std::uint32_t code = 0)
+    {
+        for (int bit = 0; bit < length; ++bit)
+        {
+            code = (code << 1) | GetBits(1);
+        }
+        return code;
+    }
+
+    std::uint32_t GetLiteralSymbol()
+    {
+        const std::uint32_t code7 = GetCode(7);
+        if (code7 <= 0x17)
+        {
+            return 256 + code7;
+        }
+        const std::uint32_t code8 = GetCode(1, code7);
+        if ((code8 >= 0x30) && (code8 <= 0xBF))
+        {
+            return code8 - 0x30;
+        }
+        if ((code8 >= 0xC0) && (code8 <= 0xC7))
+        {
+            return 280 + code8 - 0xC0;
+        }
+        return 144 + GetCode(1, code8) - 0x190;
+    }
+
+    bool InflateStored(std::vector<std::uint8_t>& data)
+    {
+        m_bitCount = 0;
+        const std::uint32_t length = GetByte() | (GetByte() << 8);
+        const std::uint32_t inverse = GetByte() | (GetByte() << 8);
+        if (length != (~inverse & 0xFFFF))
+        {
+            return false;
+        }
+        for (std::uint32_t index = 0; index < length; ++index)
+        {
+            data.push_back(static_cast<std::uint8_t>(GetByte()));
+        }
+        return true;
+    }
+
+    bool InflateFixed(std::vector<std::uint8_t>& data)
+    {
+        static constexpr std::uint16_t LengthBases[] = {
+            3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+            31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static constexpr std::uint16_t DistanceBases[] = {
+            1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+            193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        while (!m_failed)
+        {
+            const std::uint32_t symbol = GetLiteralSymbol();
+            if (symbol < 256)
+            {
+                data.push_back(static_cast<std::uint8_t>(symbol));
+                continue;
+            }
+            if (symbol == 256)
+            {
+                return true;
+            }
+            const std::uint32_t lengthIndex = symbol - 257;
+            if (lengthIndex >= 29)
+            {
+                return false;
+            }
+            const int lengthExtra = ((lengthIndex < 8) || (lengthIndex == 28))
+                                        ? 0
+                                        : static_cast<int>(lengthIndex / 4 - 1);
+            const std::size_t length = LengthBases[lengthIndex] + GetBits(lengthExtra);
+            const std::uint32_t distanceIndex = GetCode(5);
+            if (distanceIndex >= 30)
+            {
+                return false;
+            }
+            const int distanceExtra =
+                distanceIndex < 4 ? 0 : static_cast<int>(distanceIndex / 2 - 1);
+            const std::size_t distance = DistanceBases[distanceIndex] + GetBits(distanceExtra);
+            if (distance > data.size())
+            {
+                return false;
+            }
+            for (std::size_t index = 0; index < length; ++index)
+            {
+                data.push_back(data[data.size() - distance]);
+            }
+        }
+        return false;
+    }
+
+    const std::vector<std::uint8_t>& m_stream;
+    std::size_t m_position = 0;
+    std::uint32_t m_bits = 0;
+    int m_bitCount = 0;
+    bool m_failed = false;
+}; // class Inflater
+
+std::optional<std::vector<std::uint8_t>> Inflate(const std::vector<std::uint8_t>& stream)
+{
+    return Inflater{stream}.Inflate();
+}
+
+// Random bytes, text-like repetition, long runs, and repeats farther apart than the window.
+std::vector<std::vector<std::uint8_t>> MakeInputs()
+{
+    std::mt19937 random(5);
+    std::vector<std::vector<std::uint8_t>> inputs(6);
+    inputs[1] = {42};
+    for (int index = 0; index < 70000; ++index)
+    {
+        inputs[2].push_back(static_cast<std::uint8_t>(random()));
+    }
+    constexpr std::string_view words[] = {"deflate ", "zlib ", "window ", "match ", "literal\n"};
+    while (inputs[3].size() < 200000)
+    {
+        const std::string_view word = words[random() % 5];
+        inputs[3].insert(inputs[3].end(), word.begin(), word.end());
+    }
+    inputs[4].assign(100000, 7);
+    inputs[4].insert(inputs[4].end(), 1000, 9);
+    const std::vector<std::uint8_t> block(inputs[2].begin(), inputs[2].begin() + 40000);
+    for (int repeat = 0; repeat < 3; ++repeat)
+    {
+        inputs[5].insert(inputs[5].end(), block.begin(), block.end());
+    }
+    return inputs;
+}
+
+} // namespace
+
+TEST(Core, Adler32)
+{
+    constexpr std::string_view text = "Wikipedia";
+    const rad::Span<const std::uint8_t> bytes{reinterpret_cast<const std::uint8_t*>(text.data()),
+                                              text.size()};
+    EXPECT_EQ(rad::Adler32({}), 1u);
+    EXPECT_EQ(rad::Adler32(bytes), 0x11E60398u);
+    EXPECT_EQ(rad::Adler32(bytes.subspan(4), rad::Adler32(bytes.first(4))), 0x11E60398u);
+
+    std::mt19937 random(3);
+    std::vector<std::uint8_t> data(20000);
+    for (std::uint8_t& value : data)
+    {
+        value = static_cast<std::uint8_t>(random() | 0xF0);
+    }
+    const std::uint32_t whole = rad::Adler32(data);
+    for (const std::size_t split : {0, 1, 5552, 12345, 20000})
+    {
+        const rad::Span<const std::uint8_t> head{data.data(), split};
+        const rad::Span<const std::uint8_t> tail{data.data() + split, data.size() - split};
+        EXPECT_EQ(rad::CombineAdler32(rad::Adler32(head), rad::Adler32(tail), tail.size()), whole)
+            << "split " << split;
+    }
+}
+
+TEST(Core, CompressZlib)
+{
+    const std::vector<std::vector<std::uint8_t>> inputs = MakeInputs();
+    for (std::size_t input = 0; input < inputs.size(); ++input)
+    {
+        std::vector<std::size_t> sizes;
+        for (int level = 0; level <= 9; ++level)
+        {
+            // Appends after existing contents.
+            std::vector<std::uint8_t> output = {1, 2, 3};
+            rad::CompressZlib(inputs[input], output, level);
+            ASSERT_EQ(output[2], 3);
+            output.erase(output.begin(), output.begin() + 3);
+            EXPECT_EQ(Inflate(output), inputs[input]) << "input " << input << ", level " << level;
+            sizes.push_back(output.size());
+        }
+        // Text and runs compress well; random bytes and distant repeats do not.
+        if ((input == 3) || (input == 4))
+        {
+            EXPECT_LT(sizes[1], inputs[input].size() / 4) << "input " << input;
+            EXPECT_LE(sizes[9], sizes[1]) << "input " << input;
+        }
+    }
+    std::vector<std::uint8_t> output;
+    EXPECT_THROW(rad::CompressZlib(inputs[1], output, 10), std::invalid_argument);
+    EXPECT_THROW(rad::CompressZlib(inputs[1], output, -1), std::invalid_argument);
+}
+
+TEST(Core, CompressZlibParallel)
+{
+    rad::ThreadPool pool(4);
+    const std::vector<std::vector<std::uint8_t>> inputs = MakeInputs();
+    for (std::size_t input = 0; input < inputs.size(); ++input)
+    {
+        for (const int level : {0, 1, 6, 9})
+        {
+            std::vector<std::uint8_t> serial;
+            rad::CompressZlib(inputs[input], serial, level);
+            std::vector<std::uint8_t> parallel;
+            rad::CompressZlibParallel(inputs[input], parallel, level, pool, 1000);
+            EXPECT_EQ(Inflate(parallel), inputs[input]) << "input " << input << ", level " << level;
+            // Matches reach into the previous segment, so splitting costs little.
+            EXPECT_LE(parallel.size(), serial.size() + serial.size() / 50 + 64)
+                << "input " << input << ", level " << level;
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstdint>
@@ -142,6 +143,29 @@ namespace rad
     return static_cast<std::uint8_t>(result | sign);
 }
 
+namespace detail
+{
+
+template <float (*Decode)(std::uint8_t) noexcept>
+[[nodiscard]] consteval std::array<float, 256> MakeFloat8DecodeTable() noexcept
+{
+    std::array<float, 256> table = {};
+    for (std::uint32_t bits = 0; bits < table.size(); ++bits)
+    {
+        table[bits] = Decode(static_cast<std::uint8_t>(bits));
+    }
+    return table;
+}
+
+} // namespace detail
+
+// Every Float8 value as a float, indexed by its bits; a load is cheaper than decoding the bits,
+// and bulk decoders use the tables to build their shuffle operands.
+inline constexpr std::array<float, 256> Float8E4M3DecodeTable =
+    detail::MakeFloat8DecodeTable<fp8e4m3fn_to_fp32_value>();
+inline constexpr std::array<float, 256> Float8E5M2DecodeTable =
+    detail::MakeFloat8DecodeTable<fp8e5m2_to_fp32_value>();
+
 class alignas(1) Float8E4M3 final
 {
 public:
@@ -162,7 +186,7 @@ public:
 
     [[nodiscard]] constexpr operator float() const noexcept
     {
-        return fp8e4m3fn_to_fp32_value(m_bits);
+        return Float8E4M3DecodeTable[m_bits];
     }
 
     [[nodiscard]] constexpr bool IsNaN() const noexcept { return (m_bits & 0x7Fu) == 0x7Fu; }
@@ -193,7 +217,7 @@ public:
 
     [[nodiscard]] constexpr operator float() const noexcept
     {
-        return fp8e5m2_to_fp32_value(m_bits);
+        return Float8E5M2DecodeTable[m_bits];
     }
 
     [[nodiscard]] constexpr bool IsNaN() const noexcept { return (m_bits & 0x7Fu) > 0x7Cu; }
@@ -58,6 +58,22 @@ TEST(Core, Float8E5M2Conversion)
     EXPECT_EQ(rad::fp8e5m2_from_fp32_value(std::numeric_limits<float>::quiet_NaN()), 0x7F);
 }
 
+TEST(Core, Float8DecodeTables)
+{
+    static_assert(rad::Float8E4M3::FromBits(0x38) == 1.0f);
+    static_assert(rad::Float8E5M2::FromBits(0xBC) == -1.0f);
+    for (std::uint32_t bits = 0; bits < 256; ++bits)
+    {
+        const auto byte = static_cast<std::uint8_t>(bits);
+        EXPECT_EQ(std::bit_cast<std::uint32_t>(rad::Float8E4M3DecodeTable[bits]),
+                  std::bit_cast<std::uint32_t>(rad::fp8e4m3fn_to_fp32_value(byte)))
+            << bits;
+        EXPECT_EQ(std::bit_cast<std::uint32_t>(rad::Float8E5M2DecodeTable[bits]),
+                  std::bit_cast<std::uint32_t>(rad::fp8e5m2_to_fp32_value(byte)))
+            << bits;
+    }
+}
+
 TEST(Core, Float8ConversionRoundTrip)
 {
     for (std::uint32_t rawBits = 0; rawBits <= std::numeric_limits<std::uint8_t>::max(); ++rawBits)
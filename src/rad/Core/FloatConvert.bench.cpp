@@ -0,0 +1,188 @@
+#include <rad/Core/FloatConvert.h>
+#include <rad/System/CpuInfo.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t ElementCount = 1 << 20;
+
+// Values within the range of every format, so that no conversion saturates.
+std::vector<float> MakeValues()
+{
+    std::mt19937 random(3);
+    std::normal_distribution<float> distribution(0.0f, 10.0f);
+    std::vector<float> values(ElementCount);
+    for (float& value : values)
+    {
+        value = distribution(random);
+    }
+    return values;
+}
+
+bool ApplySimdLevel(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return false;
+    }
+    rad::SetSimdLevelLimit(level);
+    return true;
+}
+
+// Bytes read plus bytes written.
+void SetBytesProcessed(benchmark::State& state, std::size_t elementSize)
+{
+    const std::size_t bytes = (sizeof(float) + elementSize) * ElementCount;
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+}
+
+// The argument selects the rad::SimdLevel limit; Scalar runs the per-element constructors.
+template <typename T>
+void BM_ConvertFromFloat32(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<float> values = MakeValues();
+    std::vector<T> converted(ElementCount);
+    for (auto _ : state)
+    {
+        rad::Convert(values, converted);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state, sizeof(T));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+template <typename T>
+void BM_ConvertToFloat32(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<float> values = MakeValues();
+    std::vector<T> converted(ElementCount);
+    rad::Convert(values, converted);
+    std::vector<float> decoded(ElementCount);
+    for (auto _ : state)
+    {
+        rad::Convert(converted, decoded);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state, sizeof(T));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// Rounding selects rad::Float8Rounding; bytes are one read and one write per element.
+template <rad::Float8Rounding Rounding>
+void BM_QuantizeE4M3(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<float> values = MakeValues();
+    std::vector<rad::Float8E4M3> quantized(ElementCount);
+    rad::Float8QuantizeOptions options;
+    options.rounding = Rounding;
+    float scale = 1.0f;
+    for (auto _ : state)
+    {
+        const float absMax = rad::Quantize(values, scale, quantized, options);
+        scale = rad::Float8MaxFinite<rad::Float8E4M3> / absMax;
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state, sizeof(rad::Float8E4M3));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// The two-pass reference: AbsMax over the tensor, then a scalar scale-and-convert loop.
+void BM_QuantizeE4M3TwoPass(benchmark::State& state)
+{
+    const std::vector<float> values = MakeValues();
+    std::vector<rad::Float8E4M3> quantized(ElementCount);
+    for (auto _ : state)
+    {
+        float absMax = 0.0f;
+        for (const float value : values)
+        {
+            absMax = std::max(absMax, std::abs(value));
+        }
+        const float scale = rad::Float8MaxFinite<rad::Float8E4M3> / absMax;
+        for (std::size_t index = 0; index < ElementCount; ++index)
+        {
+            quantized[index] = rad::Float8E4M3(values[index] * scale);
+        }
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state, sizeof(rad::Float8E4M3));
+}
+
+// The argument after the SIMD level is the block size.
+void BM_QuantizeBlocksE4M3(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<float> values = MakeValues();
+    const auto blockSize = static_cast<std::size_t>(state.range(1));
+    std::vector<rad::Float8E4M3> quantized(ElementCount);
+    std::vector<float> scales((ElementCount + blockSize - 1) / blockSize);
+    for (auto _ : state)
+    {
+        rad::QuantizeBlocks(values, blockSize, quantized, scales);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state, sizeof(rad::Float8E4M3));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+void SimdLevelsAndBlockSizes(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        for (const std::int64_t blockSize : {32, 128, 1 << 20})
+        {
+            benchmark->Args({static_cast<std::int64_t>(level), blockSize});
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ConvertFromFloat32<rad::BFloat16>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertToFloat32<rad::BFloat16>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertFromFloat32<rad::Float16>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertToFloat32<rad::Float16>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertFromFloat32<rad::Float8E4M3>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertToFloat32<rad::Float8E4M3>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertFromFloat32<rad::Float8E5M2>)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertToFloat32<rad::Float8E5M2>)->Apply(SimdLevels);
+BENCHMARK(BM_QuantizeE4M3<rad::Float8Rounding::NearestEven>)->Apply(SimdLevels);
+BENCHMARK(BM_QuantizeE4M3<rad::Float8Rounding::Stochastic>)->Apply(SimdLevels);
+BENCHMARK(BM_QuantizeE4M3TwoPass);
+BENCHMARK(BM_QuantizeBlocksE4M3)->Apply(SimdLevelsAndBlockSizes);
@@ -0,0 +1,1370 @@
+#include <rad/Core/FloatConvert.h>
+#include <rad/Core/Hash.h>
+#include <rad/Core/Integer.h>
+#include <rad/Core/Platform.h>
+#include <rad/System/CpuInfo.h>
+
+#if defined(RAD_ARCH_X86)
+#include <immintrin.h>
+#define RAD_TARGET_AVX512_VBMI                                                                     \
+    RAD_TARGET("ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,avx512f,avx512bw,"           \
+               "avx512dq,avx512vl,avx512vbmi")
+#elif defined(RAD_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+
+namespace rad
+{
+
+namespace
+{
+
+// Kernels convert a prefix of whole vectors and return how many values they consumed; the
+// scalar types finish the rest.
+template <typename T>
+using EncodeKernel = std::size_t (*)(const Float32* input, T* output, std::size_t size) noexcept;
+template <typename T>
+using DecodeKernel = std::size_t (*)(const T* input, Float32* output, std::size_t size) noexcept;
+
+template <typename T>
+void EncodeScalar(const Float32* input, T* output, std::size_t size) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        output[index] = T(input[index]);
+    }
+}
+
+template <typename T>
+void DecodeScalar(const T* input, Float32* output, std::size_t size) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        output[index] = static_cast<Float32>(input[index]);
+    }
+}
+
+// Constants of fp8e4m3fn_from_fp32_value/fp8e5m2_from_fp32_value and their inverses.
+struct Float8E4M3Format
+{
+    static constexpr Uint32 MantissaBits = 3;
+    // Magnitudes at or above this encode NaN (E4M3 has no infinity).
+    static constexpr Uint32 SpecialMagnitude = 0x7F;
+    static constexpr Uint32 ExponentBias = 120;
+    static constexpr Float32 DenormalScale = 0x1p-9f;
+
+    static constexpr Uint32 OverflowThreshold = 1087u << 20;
+    static constexpr Uint32 MinimumNormal = 121u << 23;
+    static constexpr Uint32 DenormalBias = 141u << 23;
+    // Exponent rebias plus the round-to-nearest bias below the halfway point.
+    static constexpr Uint32 RoundingBias = 0xC4000000u + 0x7FFFFu;
+    static constexpr Uint32 OverflowResult = 0x7E;
+    // Rounding up to the NaN encoding saturates to the largest finite value instead.
+    static constexpr Uint32 MaximumNormalResult = 0x7E;
+
+    // Quantization: the largest finite value as Float32 bits and as a code, the code and the
+    // smallest Float32 magnitude of an overflow that is not saturated, and the factor that
+    // turns a denormal magnitude into 24-bit fixed point in units of the smallest denormal.
+    static constexpr Uint32 MaxFiniteBits = 0x43E00000u;
+    static constexpr Uint32 MaxFiniteCode = 0x7E;
+    static constexpr Uint32 OverflowCode = 0x7F;
+    static constexpr Uint32 OverflowBits = 0x43E80001u;
+    static constexpr Float32 DenormalFixedScale = 0x1p33f;
+    static constexpr auto FromFloat32 = fp8e4m3fn_from_fp32_value;
+    static constexpr const auto& DecodeTable = Float8E4M3DecodeTable;
+};
+
+struct Float8E5M2Format
+{
+    static constexpr Uint32 MantissaBits = 2;
+    static constexpr Uint32 SpecialMagnitude = 0x7C;
+    static constexpr Uint32 ExponentBias = 112;
+    static constexpr Float32 DenormalScale = 0x1p-16f;
+
+    static constexpr Uint32 OverflowThreshold = 143u << 23;
+    static constexpr Uint32 MinimumNormal = 113u << 23;
+    static constexpr Uint32 DenormalBias = 134u << 23;
+    static constexpr Uint32 RoundingBias = 0xC8000000u + 0xFFFFFu;
+    static constexpr Uint32 OverflowResult = 0x7C;
+    static constexpr Uint32 MaximumNormalResult = 0x7C;
+
+    static constexpr Uint32 MaxFiniteBits = 0x47600000u;
+    static constexpr Uint32 MaxFiniteCode = 0x7B;
+    static constexpr Uint32 OverflowCode = 0x7C;
+    static constexpr Uint32 OverflowBits = 0x47700000u;
+    static constexpr Float32 DenormalFixedScale = 0x1p40f;
+    static constexpr auto FromFloat32 = fp8e5m2_from_fp32_value;
+    static constexpr const auto& DecodeTable = Float8E5M2DecodeTable;
+};
+
+template <typename T>
+using Float8FormatOf =
+    std::conditional_t<std::is_same_v<T, Float8E4M3>, Float8E4M3Format, Float8E5M2Format>;
+
+// Bytes 2 and 3 of the Float32 encodings of the 128 Float8 magnitudes. Bytes 0 and 1 are zero
+// for every Float8 value and the sign is the top bit of byte 3, so two 128-entry byte lookups
+// decode Float8 exactly, NaN payloads included.
+struct Float8DecodePlanes
+{
+    alignas(64) Uint8 low[128];
+    alignas(64) Uint8 high[128];
+};
+
+template <typename Format>
+consteval Float8DecodePlanes MakeFloat8DecodePlanes() noexcept
+{
+    Float8DecodePlanes planes = {};
+    for (Uint32 magnitude = 0; magnitude < 128; ++magnitude)
+    {
+        const Uint32 bits = std::bit_cast<Uint32>(Format::DecodeTable[magnitude]);
+        planes.low[magnitude] = static_cast<Uint8>(bits >> 16);
+        planes.high[magnitude] = static_cast<Uint8>(bits >> 24);
+    }
+    return planes;
+}
+
+template <typename Format>
+consteval bool HasZeroLowHalves() noexcept
+{
+    return std::ranges::all_of(Format::DecodeTable, [](Float32 value)
+                               { return (std::bit_cast<Uint32>(value) & 0xFFFFu) == 0; });
+}
+
+static_assert(HasZeroLowHalves<Float8E4M3Format>() && HasZeroLowHalves<Float8E5M2Format>());
+
+template <typename Format>
+constexpr Float8DecodePlanes Float8DecodePlanesOf = MakeFloat8DecodePlanes<Format>();
+
+struct QuantizeParams
+{
+    Float32 scale;
+    bool saturate;
+    bool stochastic;
+    // Stochastic rounding draws pcg_hash32(index ^ key) with the low 32 bits of the element
+    // index; the key covers the seed and the high bits.
+    Uint32 key;
+    Uint32 firstIndex;
+};
+
+// Kernels quantize a prefix of whole vectors, fold |input| into absMax if TrackAbsMax and return
+// how many values they consumed; QuantizeFloat8Scalar finishes the rest.
+template <typename T>
+using QuantizeKernel = std::size_t (*)(const Float32* input, T* output, std::size_t size,
+                                       const QuantizeParams& params, Float32& absMax) noexcept;
+using AbsMaxKernel = std::size_t (*)(const Float32* input, std::size_t size,
+                                     Float32& absMax) noexcept;
+
+// NaNs fail the comparison and are ignored, as in the vector max instructions.
+inline Float32 MaxIgnoringNaN(Float32 maximum, Float32 value) noexcept
+{
+    return value > maximum ? value : maximum;
+}
+
+void AbsMaxScalar(const Float32* input, std::size_t size, Float32& absMax) noexcept
+{
+    // Four independent maxima hide the compare latency.
+    Float32 maxima[4] = {absMax, 0.0f, 0.0f, 0.0f};
+    std::size_t index = 0;
+    for (; size - index >= 4; index += 4)
+    {
+        for (std::size_t lane = 0; lane < 4; ++lane)
+        {
+            maxima[lane] = MaxIgnoringNaN(maxima[lane], Abs(input[index + lane]));
+        }
+    }
+    for (; index < size; ++index)
+    {
+        maxima[0] = MaxIgnoringNaN(maxima[0], Abs(input[index]));
+    }
+    absMax = std::max(std::max(maxima[0], maxima[1]), std::max(maxima[2], maxima[3]));
+}
+
+// Quantizes an already scaled value; the reference for the vector kernels.
+template <typename Format, bool Stochastic>
+Uint8 QuantizeScalar(Float32 value, Uint32 saturation, Uint32 key, Uint32 index) noexcept
+{
+    constexpr Uint32 shift = 23 - Format::MantissaBits;
+    const Uint32 bits = std::bit_cast<Uint32>(value);
+    const Uint32 sign = (bits >> 24) & 0x80u;
+    Uint32 magnitude = bits & 0x7FFFFFFFu;
+    if (magnitude > 0x7F800000u)
+    {
+        return static_cast<Uint8>(0x7Fu | sign);
+    }
+    magnitude = std::min(magnitude, saturation);
+
+    Uint32 code = 0;
+    if constexpr (Stochastic)
+    {
+        // Adding random bits below the kept precision and truncating rounds up with
+        // probability equal to the discarded fraction.
+        const Uint32 random = pcg_hash32(index ^ key);
+        if (magnitude < Format::MinimumNormal)
+        {
+            const auto fixed = static_cast<Uint32>(std::bit_cast<Float32>(magnitude) *
+                                                   Format::DenormalFixedScale);
+            code = (fixed + (random >> 8)) >> 24;
+        }
+        else
+        {
+            code = ((magnitude + (random >> (32 - shift))) >> shift) -
+                   (Format::ExponentBias << Format::MantissaBits);
+        }
+        code = code > Format::MaxFiniteCode ? Format::OverflowCode : code;
+    }
+    else
+    {
+        code = Format::FromFloat32(std::bit_cast<Float32>(magnitude));
+        code = magnitude >= Format::OverflowBits ? Format::OverflowCode : code;
+    }
+    return static_cast<Uint8>(code | sign);
+}
+
+// Scalar counterpart of the quantize kernels, used on its own and for their tails. The
+// parameters are read into locals once; the byte stores could otherwise alias them.
+template <typename Format, bool Stochastic, bool TrackAbsMax, typename T>
+void QuantizeFloat8Scalar(const Float32* input, T* output, std::size_t size,
+                          const QuantizeParams& params, Float32& absMax) noexcept
+{
+    const Float32 scale = params.scale;
+    const Uint32 saturation = params.saturate ? Format::MaxFiniteBits : ~0u;
+    const Uint32 key = params.key;
+    const Uint32 firstIndex = params.firstIndex;
+    Float32 maximum = absMax;
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        if constexpr (TrackAbsMax)
+        {
+            maximum = MaxIgnoringNaN(maximum, Abs(input[index]));
+        }
+        output[index] = T::FromBits(QuantizeScalar<Format, Stochastic>(
+            input[index] * scale, saturation, key, firstIndex + static_cast<Uint32>(index)));
+    }
+    absMax = maximum;
+}
+
+#if defined(RAD_ARCH_X86)
+
+constexpr int Float16Rounding = _MM_FROUND_TO_NEAREST_INT;
+
+// Vector form of bf16_from_fp32_round_to_nearest_even; results are in the low 16 bits of each
+// lane.
+RAD_TARGET_AVX2 inline __m256i EncodeBFloat16Avx2(__m256i bits) noexcept
+{
+    const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_srli_epi32(
+        _mm256_add_epi32(bits, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), odd)), 16);
+    const __m256i isNaN = _mm256_cmpgt_epi32(
+        _mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+    return _mm256_blendv_epi8(rounded, _mm256_set1_epi32(0x7FC0), isNaN);
+}
+
+RAD_TARGET_AVX2 std::size_t EncodeBFloat16Avx2(const Float32* input, BFloat16* output,
+                                               std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m256i low = EncodeBFloat16Avx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset)));
+        const __m256i high = EncodeBFloat16Avx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset + 8)));
+        // packus interleaves 128-bit lanes; the permute restores element order.
+        const __m256i packed =
+            _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset), packed);
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX2 std::size_t DecodeBFloat16Avx2(const BFloat16* input, Float32* output,
+                                               std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256i halves = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset),
+                            _mm256_slli_epi32(halves, 16));
+    }
+    return offset;
+}
+
+// F16C rounds exactly like Float16 but quiets NaNs, which Imath's software conversion does
+// not; vectors holding a NaN go through the scalar type.
+RAD_TARGET_AVX2 std::size_t EncodeFloat16Avx2(const Float32* input, Float16* output,
+                                              std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256 values = _mm256_loadu_ps(input + offset);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(values, values, _CMP_UNORD_Q)) != 0)
+        {
+            EncodeScalar(input + offset, output + offset, 8);
+            continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset),
+                         _mm256_cvtps_ph(values, Float16Rounding));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX2 std::size_t DecodeFloat16Avx2(const Float16* input, Float32* output,
+                                              std::size_t size) noexcept
+{
+    const __m128i magnitudeMask = _mm_set1_epi16(0x7FFF);
+    const __m128i infinity = _mm_set1_epi16(0x7C00);
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+        const __m128i isNaN = _mm_cmpgt_epi16(_mm_and_si128(halves, magnitudeMask), infinity);
+        if (_mm_movemask_epi8(isNaN) != 0)
+        {
+            DecodeScalar(input + offset, output + offset, 8);
+            continue;
+        }
+        _mm256_storeu_ps(output + offset, _mm256_cvtph_ps(halves));
+    }
+    return offset;
+}
+
+// Vector form of fp8e4m3fn_from_fp32_value and fp8e5m2_from_fp32_value; all three branches
+// are computed and blended.
+template <typename Format>
+RAD_TARGET_AVX2 inline __m256i EncodeFloat8Avx2(__m256 values) noexcept
+{
+    constexpr Uint32 shift = 23 - Format::MantissaBits;
+    const __m256i input = _mm256_castps_si256(values);
+    const __m256i sign = _mm256_and_si256(_mm256_srli_epi32(input, 24), _mm256_set1_epi32(0x80));
+    const __m256i bits = _mm256_and_si256(input, _mm256_set1_epi32(0x7FFFFFFF));
+
+    const __m256i isNaN = _mm256_cmpgt_epi32(bits, _mm256_set1_epi32(0x7F800000));
+    const __m256i overflow =
+        _mm256_blendv_epi8(_mm256_set1_epi32(Format::OverflowResult), _mm256_set1_epi32(0x7F),
+                           isNaN);
+    const __m256i isOverflow =
+        _mm256_cmpgt_epi32(bits, _mm256_set1_epi32(Format::OverflowThreshold - 1));
+
+    const __m256i denormalBias = _mm256_set1_epi32(Format::DenormalBias);
+    const __m256i denormal = _mm256_sub_epi32(
+        _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(bits),
+                                          _mm256_castsi256_ps(denormalBias))),
+        denormalBias);
+    const __m256i isDenormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(Format::MinimumNormal), bits);
+
+    const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, shift), _mm256_set1_epi32(1));
+    const __m256i bias = _mm256_set1_epi32(static_cast<int>(Format::RoundingBias));
+    const __m256i normal =
+        _mm256_min_epu32(_mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(bias, odd)),
+                                           shift),
+                         _mm256_set1_epi32(Format::MaximumNormalResult));
+
+    const __m256i result = _mm256_blendv_epi8(_mm256_blendv_epi8(normal, denormal, isDenormal),
+                                              overflow, isOverflow);
+    return _mm256_or_si256(result, sign);
+}
+
+// Vector form of fp8e4m3fn_to_fp32_value and fp8e5m2_to_fp32_value.
+template <typename Format>
+RAD_TARGET_AVX2 inline __m256 DecodeFloat8Avx2(__m256i bytes) noexcept
+{
+    constexpr Uint32 shift = 23 - Format::MantissaBits;
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(bytes, _mm256_set1_epi32(0x80)), 24);
+    const __m256i magnitude = _mm256_and_si256(bytes, _mm256_set1_epi32(0x7F));
+
+    const __m256i normal = _mm256_add_epi32(_mm256_slli_epi32(magnitude, shift),
+                                            _mm256_set1_epi32(Format::ExponentBias << 23));
+    const __m256i denormal = _mm256_castps_si256(_mm256_mul_ps(
+        _mm256_cvtepi32_ps(magnitude), _mm256_set1_ps(Format::DenormalScale)));
+    const __m256i isDenormal =
+        _mm256_cmpgt_epi32(_mm256_set1_epi32(1 << Format::MantissaBits), magnitude);
+    const __m256i special = _mm256_or_si256(
+        _mm256_set1_epi32(0x7F800000),
+        _mm256_slli_epi32(
+            _mm256_and_si256(magnitude, _mm256_set1_epi32((1 << Format::MantissaBits) - 1)),
+            shift));
+    const __m256i isSpecial =
+        _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(Format::SpecialMagnitude - 1));
+
+    const __m256i result = _mm256_blendv_epi8(_mm256_blendv_epi8(normal, denormal, isDenormal),
+                                              special, isSpecial);
+    return _mm256_castsi256_ps(_mm256_or_si256(result, sign));
+}
+
+// Stores the low byte of each 32-bit lane to 8 consecutive bytes.
+RAD_TARGET_AVX2 inline void StoreLowBytesAvx2(void* output, __m256i values) noexcept
+{
+    const __m256i gather = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, -1, -1);
+    const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(values, gather),
+                                                       _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    _mm_storel_epi64(static_cast<__m128i*>(output), _mm256_castsi256_si128(packed));
+}
+
+template <typename Format, typename T>
+RAD_TARGET_AVX2 std::size_t EncodeFloat8Avx2(const Float32* input, T* output,
+                                             std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        StoreLowBytesAvx2(output + offset,
+                          EncodeFloat8Avx2<Format>(_mm256_loadu_ps(input + offset)));
+    }
+    return offset;
+}
+
+template <typename Format, typename T>
+RAD_TARGET_AVX2 std::size_t DecodeFloat8Avx2(const T* input, Float32* output,
+                                             std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256i bytes = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + offset)));
+        _mm256_storeu_ps(output + offset, DecodeFloat8Avx2<Format>(bytes));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX2 inline Float32 HorizontalMaxAvx2(__m256 values) noexcept
+{
+    __m128 maxima = _mm_max_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+    maxima = _mm_max_ps(maxima, _mm_movehl_ps(maxima, maxima));
+    maxima = _mm_max_ss(maxima, _mm_shuffle_ps(maxima, maxima, 1));
+    return _mm_cvtss_f32(maxima);
+}
+
+// MAXPS returns the second operand when either is NaN, so NaN inputs leave the maxima alone.
+RAD_TARGET_AVX2 std::size_t AbsMaxAvx2(const Float32* input, std::size_t size,
+                                       Float32& absMax) noexcept
+{
+    const __m256 magnitudeMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 maxima[4] = {_mm256_set1_ps(absMax), _mm256_setzero_ps(), _mm256_setzero_ps(),
+                        _mm256_setzero_ps()};
+    std::size_t offset = 0;
+    for (; size - offset >= 32; offset += 32)
+    {
+        for (int index = 0; index < 4; ++index)
+        {
+            const __m256 values = _mm256_loadu_ps(input + offset + index * 8);
+            maxima[index] = _mm256_max_ps(_mm256_and_ps(values, magnitudeMask), maxima[index]);
+        }
+    }
+    for (; size - offset >= 8; offset += 8)
+    {
+        maxima[0] = _mm256_max_ps(_mm256_and_ps(_mm256_loadu_ps(input + offset), magnitudeMask),
+                                  maxima[0]);
+    }
+    absMax = HorizontalMaxAvx2(_mm256_max_ps(_mm256_max_ps(maxima[0], maxima[1]),
+                                             _mm256_max_ps(maxima[2], maxima[3])));
+    return offset;
+}
+
+// Vector form of pcg_hash32.
+RAD_TARGET_AVX2 inline __m256i Pcg32HashAvx2(__m256i values) noexcept
+{
+    const __m256i state =
+        _mm256_add_epi32(_mm256_mullo_epi32(values, _mm256_set1_epi32(747796405)),
+                         _mm256_set1_epi32(static_cast<int>(2891336453u)));
+    const __m256i shift = _mm256_add_epi32(_mm256_srli_epi32(state, 28), _mm256_set1_epi32(4));
+    const __m256i word = _mm256_mullo_epi32(
+        _mm256_xor_si256(_mm256_srlv_epi32(state, shift), state), _mm256_set1_epi32(277803737));
+    return _mm256_xor_si256(_mm256_srli_epi32(word, 22), word);
+}
+
+// Vector form of QuantizeScalar. Rounding is a template parameter and saturation an unsigned
+// min against MaxFiniteBits or ~0u, so the loops carry no branches and keep their constants
+// in registers.
+template <typename Format, bool Stochastic>
+RAD_TARGET_AVX2 inline __m256i QuantizeFloat8Avx2(__m256 values, __m256i random,
+                                                  __m256i saturation) noexcept
+{
+    constexpr int shift = 23 - Format::MantissaBits;
+    const __m256i bits = _mm256_castps_si256(values);
+    const __m256i sign = _mm256_and_si256(_mm256_srli_epi32(bits, 24), _mm256_set1_epi32(0x80));
+    __m256i magnitude = _mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF));
+    const __m256i isNaN = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x7F800000));
+    magnitude = _mm256_min_epu32(magnitude, saturation);
+
+    __m256i code;
+    if constexpr (Stochastic)
+    {
+        const __m256i fixed = _mm256_cvttps_epi32(_mm256_mul_ps(
+            _mm256_castsi256_ps(magnitude), _mm256_set1_ps(Format::DenormalFixedScale)));
+        const __m256i denormal =
+            _mm256_srli_epi32(_mm256_add_epi32(fixed, _mm256_srli_epi32(random, 8)), 24);
+        const __m256i normal = _mm256_sub_epi32(
+            _mm256_srli_epi32(
+                _mm256_add_epi32(magnitude, _mm256_srli_epi32(random, 32 - shift)), shift),
+            _mm256_set1_epi32(Format::ExponentBias << Format::MantissaBits));
+        const __m256i isDenormal =
+            _mm256_cmpgt_epi32(_mm256_set1_epi32(Format::MinimumNormal), magnitude);
+        code = _mm256_blendv_epi8(normal, denormal, isDenormal);
+        const __m256i isOverflow =
+            _mm256_cmpgt_epi32(code, _mm256_set1_epi32(Format::MaxFiniteCode));
+        code = _mm256_blendv_epi8(code, _mm256_set1_epi32(Format::OverflowCode), isOverflow);
+    }
+    else
+    {
+        code = EncodeFloat8Avx2<Format>(_mm256_castsi256_ps(magnitude));
+        const __m256i isOverflow =
+            _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(Format::OverflowBits - 1));
+        code = _mm256_blendv_epi8(code, _mm256_set1_epi32(Format::OverflowCode), isOverflow);
+    }
+    return _mm256_or_si256(_mm256_blendv_epi8(code, _mm256_set1_epi32(0x7F), isNaN), sign);
+}
+
+template <typename Format, bool Stochastic, bool TrackAbsMax, typename T>
+RAD_TARGET_AVX2 std::size_t QuantizeFloat8Avx2(const Float32* input, T* output, std::size_t size,
+                                               const QuantizeParams& params,
+                                               Float32& absMax) noexcept
+{
+    const __m256i saturation =
+        _mm256_set1_epi32(params.saturate ? static_cast<int>(Format::MaxFiniteBits) : -1);
+    const __m256 magnitudeMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 scale = _mm256_set1_ps(params.scale);
+    const __m256i key = _mm256_set1_epi32(static_cast<int>(params.key));
+    __m256i indices = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(params.firstIndex)),
+                                       _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256 maxima = _mm256_set1_ps(absMax);
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256 values = _mm256_loadu_ps(input + offset);
+        if constexpr (TrackAbsMax)
+        {
+            maxima = _mm256_max_ps(_mm256_and_ps(values, magnitudeMask), maxima);
+        }
+        const __m256i random = Stochastic ? Pcg32HashAvx2(_mm256_xor_si256(indices, key))
+                                          : _mm256_setzero_si256();
+        StoreLowBytesAvx2(output + offset,
+                          QuantizeFloat8Avx2<Format, Stochastic>(_mm256_mul_ps(values, scale),
+                                                                 random, saturation));
+        indices = _mm256_add_epi32(indices, _mm256_set1_epi32(8));
+    }
+    if constexpr (TrackAbsMax)
+    {
+        absMax = HorizontalMaxAvx2(maxima);
+    }
+    return offset;
+}
+
+template <typename Format, bool TrackAbsMax, typename T>
+RAD_TARGET_AVX2 std::size_t QuantizeFloat8Avx2(const Float32* input, T* output, std::size_t size,
+                                               const QuantizeParams& params,
+                                               Float32& absMax) noexcept
+{
+    return params.stochastic
+               ? QuantizeFloat8Avx2<Format, true, TrackAbsMax>(input, output, size, params, absMax)
+               : QuantizeFloat8Avx2<Format, false, TrackAbsMax>(input, output, size, params,
+                                                                absMax);
+}
+
+// AVX512_BF16 is not used: VCVTNEPS2BF16 flushes denormals and keeps NaN payloads, unlike
+// BFloat16. The integer rounding below is exact and no slower on memory-bound spans.
+RAD_TARGET_AVX512 std::size_t EncodeBFloat16Avx512(const Float32* input, BFloat16* output,
+                                                   std::size_t size) noexcept
+{
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i halfMinusOne = _mm512_set1_epi32(0x7FFF);
+    const __m512i magnitudeMask = _mm512_set1_epi32(0x7FFFFFFF);
+    const __m512i infinity = _mm512_set1_epi32(0x7F800000);
+    const __m512i quietNaN = _mm512_set1_epi32(0x7FC0);
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512i bits = _mm512_loadu_si512(input + offset);
+        const __m512i odd = _mm512_and_si512(_mm512_maskz_srli_epi32(AllLanes32, bits, 16), one);
+        const __m512i rounded = _mm512_maskz_srli_epi32(
+            AllLanes32, _mm512_add_epi32(bits, _mm512_add_epi32(halfMinusOne, odd)), 16);
+        const __mmask16 isNaN =
+            _mm512_cmpgt_epu32_mask(_mm512_and_si512(bits, magnitudeMask), infinity);
+        const __m512i encoded = _mm512_mask_mov_epi32(rounded, isNaN, quietNaN);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset),
+                            _mm512_maskz_cvtepi32_epi16(AllLanes32, encoded));
+    }
+    return offset + EncodeBFloat16Avx2(input + offset, output + offset, size - offset);
+}
+
+RAD_TARGET_AVX512 std::size_t DecodeBFloat16Avx512(const BFloat16* input, Float32* output,
+                                                   std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512i halves = _mm512_maskz_cvtepu16_epi32(
+            AllLanes32, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset)));
+        _mm512_storeu_si512(output + offset, _mm512_maskz_slli_epi32(AllLanes32, halves, 16));
+    }
+    return offset + DecodeBFloat16Avx2(input + offset, output + offset, size - offset);
+}
+
+RAD_TARGET_AVX512 std::size_t EncodeFloat16Avx512(const Float32* input, Float16* output,
+                                                  std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512 values = _mm512_loadu_ps(input + offset);
+        if (_mm512_cmp_ps_mask(values, values, _CMP_UNORD_Q) != 0)
+        {
+            EncodeScalar(input + offset, output + offset, 16);
+            continue;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset),
+                            _mm512_maskz_cvtps_ph(AllLanes32, values, Float16Rounding));
+    }
+    return offset + EncodeFloat16Avx2(input + offset, output + offset, size - offset);
+}
+
+RAD_TARGET_AVX512 std::size_t DecodeFloat16Avx512(const Float16* input, Float32* output,
+                                                  std::size_t size) noexcept
+{
+    const __m256i magnitudeMask = _mm256_set1_epi16(0x7FFF);
+    const __m256i infinity = _mm256_set1_epi16(0x7C00);
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m256i halves =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset));
+        if (_mm256_cmpgt_epi16_mask(_mm256_and_si256(halves, magnitudeMask), infinity) != 0)
+        {
+            DecodeScalar(input + offset, output + offset, 16);
+            continue;
+        }
+        _mm512_storeu_ps(output + offset, _mm512_maskz_cvtph_ps(AllLanes32, halves));
+    }
+    return offset + DecodeFloat16Avx2(input + offset, output + offset, size - offset);
+}
+
+template <typename Format>
+RAD_TARGET_AVX512 inline __m512i EncodeFloat8Avx512(__m512 values) noexcept
+{
+    constexpr unsigned shift = 23 - Format::MantissaBits;
+    const __m512i input = _mm512_castps_si512(values);
+    const __m512i sign = _mm512_and_si512(_mm512_maskz_srli_epi32(AllLanes32, input, 24),
+                                          _mm512_set1_epi32(0x80));
+    const __m512i bits = _mm512_and_si512(input, _mm512_set1_epi32(0x7FFFFFFF));
+
+    const __mmask16 isNaN = _mm512_cmpgt_epu32_mask(bits, _mm512_set1_epi32(0x7F800000));
+    const __mmask16 isOverflow =
+        _mm512_cmpge_epu32_mask(bits, _mm512_set1_epi32(Format::OverflowThreshold));
+    const __mmask16 isDenormal =
+        _mm512_cmplt_epu32_mask(bits, _mm512_set1_epi32(Format::MinimumNormal));
+
+    const __m512i odd = _mm512_and_si512(_mm512_maskz_srli_epi32(AllLanes32, bits, shift),
+                                         _mm512_set1_epi32(1));
+    const __m512i bias = _mm512_set1_epi32(static_cast<int>(Format::RoundingBias));
+    const __m512i rounded = _mm512_maskz_srli_epi32(
+        AllLanes32, _mm512_add_epi32(bits, _mm512_add_epi32(bias, odd)), shift);
+    __m512i result = _mm512_maskz_min_epu32(AllLanes32, rounded,
+                                            _mm512_set1_epi32(Format::MaximumNormalResult));
+
+    const __m512i denormalBias = _mm512_set1_epi32(Format::DenormalBias);
+    const __m512i denormal = _mm512_sub_epi32(
+        _mm512_castps_si512(_mm512_add_ps(_mm512_castsi512_ps(bits),
+                                          _mm512_castsi512_ps(denormalBias))),
+        denormalBias);
+    result = _mm512_mask_mov_epi32(result, isDenormal, denormal);
+    result = _mm512_mask_mov_epi32(result, isOverflow, _mm512_set1_epi32(Format::OverflowResult));
+    result = _mm512_mask_mov_epi32(result, isNaN, _mm512_set1_epi32(0x7F));
+    return _mm512_or_si512(result, sign);
+}
+
+template <typename Format>
+RAD_TARGET_AVX512 inline __m512 DecodeFloat8Avx512(__m512i bytes) noexcept
+{
+    constexpr unsigned shift = 23 - Format::MantissaBits;
+    const __m512i sign = _mm512_maskz_slli_epi32(
+        AllLanes32, _mm512_and_si512(bytes, _mm512_set1_epi32(0x80)), 24);
+    const __m512i magnitude = _mm512_and_si512(bytes, _mm512_set1_epi32(0x7F));
+
+    __m512i result = _mm512_add_epi32(_mm512_maskz_slli_epi32(AllLanes32, magnitude, shift),
+                                      _mm512_set1_epi32(Format::ExponentBias << 23));
+    const __m512i denormal = _mm512_castps_si512(_mm512_mul_ps(
+        _mm512_maskz_cvtepi32_ps(AllLanes32, magnitude), _mm512_set1_ps(Format::DenormalScale)));
+    result = _mm512_mask_mov_epi32(
+        result,
+        _mm512_cmplt_epu32_mask(magnitude, _mm512_set1_epi32(1 << Format::MantissaBits)),
+        denormal);
+    const __m512i special = _mm512_or_si512(
+        _mm512_set1_epi32(0x7F800000),
+        _mm512_maskz_slli_epi32(
+            AllLanes32,
+            _mm512_and_si512(magnitude, _mm512_set1_epi32((1 << Format::MantissaBits) - 1)),
+            shift));
+    result = _mm512_mask_mov_epi32(
+        result, _mm512_cmpge_epu32_mask(magnitude, _mm512_set1_epi32(Format::SpecialMagnitude)),
+        special);
+    return _mm512_castsi512_ps(_mm512_or_si512(result, sign));
+}
+
+template <typename Format, typename T>
+RAD_TARGET_AVX512 std::size_t EncodeFloat8Avx512(const Float32* input, T* output,
+                                                 std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512i encoded = EncodeFloat8Avx512<Format>(_mm512_loadu_ps(input + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset),
+                         _mm512_maskz_cvtepi32_epi8(AllLanes32, encoded));
+    }
+    return offset + EncodeFloat8Avx2<Format>(input + offset, output + offset, size - offset);
+}
+
+template <typename Format, typename T>
+RAD_TARGET_AVX512 std::size_t DecodeFloat8Avx512(const T* input, Float32* output,
+                                                 std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512i bytes = _mm512_maskz_cvtepu8_epi32(
+            AllLanes32, _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset)));
+        _mm512_storeu_ps(output + offset, DecodeFloat8Avx512<Format>(bytes));
+    }
+    return offset + DecodeFloat8Avx2<Format>(input + offset, output + offset, size - offset);
+}
+
+// VBMI is not part of the AVX512 tier; Ice Lake and Zen 4 have it, Skylake-X does not.
+[[nodiscard]] bool IsVbmiSupported() noexcept
+{
+    return GetX86Info().features.avx512vbmi;
+}
+
+// Byte permute operand that moves bytes first..first + 15 of the low and high planes into bytes
+// 2 and 3 of each 32-bit lane.
+RAD_TARGET_AVX512_VBMI inline __m512i Float8InterleaveIndexVbmi(int first) noexcept
+{
+    const __m512i lanes =
+        _mm512_add_epi32(_mm512_set1_epi32(first),
+                         _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    // Index bit 6 selects the second operand, the high plane.
+    return _mm512_or_si512(
+        _mm512_maskz_slli_epi32(AllLanes32, lanes, 16),
+        _mm512_maskz_slli_epi32(AllLanes32, _mm512_or_si512(lanes, _mm512_set1_epi32(64)), 24));
+}
+
+// Looks up 64 magnitudes at once in the 128-entry planes with VPERMI2B, which ignores index bit
+// 7 (the sign), then interleaves the two planes into four vectors of Float32 encodings.
+template <typename Format, typename T>
+RAD_TARGET_AVX512_VBMI std::size_t DecodeFloat8Vbmi(const T* input, Float32* output,
+                                                    std::size_t size) noexcept
+{
+    constexpr const Float8DecodePlanes& planes = Float8DecodePlanesOf<Format>;
+    const __m512i low0 = _mm512_load_si512(planes.low);
+    const __m512i low1 = _mm512_load_si512(planes.low + 64);
+    const __m512i high0 = _mm512_load_si512(planes.high);
+    const __m512i high1 = _mm512_load_si512(planes.high + 64);
+    const __m512i signMask = _mm512_set1_epi8(static_cast<char>(0x80));
+    const __m512i interleave[4] = {Float8InterleaveIndexVbmi(0), Float8InterleaveIndexVbmi(16),
+                                   Float8InterleaveIndexVbmi(32), Float8InterleaveIndexVbmi(48)};
+    constexpr __mmask64 upperBytes = 0xCCCC'CCCC'CCCC'CCCCull;
+    std::size_t offset = 0;
+    for (; size - offset >= 64; offset += 64)
+    {
+        const __m512i bytes = _mm512_loadu_si512(input + offset);
+        const __m512i low = _mm512_permutex2var_epi8(low0, bytes, low1);
+        const __m512i high = _mm512_or_si512(_mm512_permutex2var_epi8(high0, bytes, high1),
+                                             _mm512_and_si512(bytes, signMask));
+        for (int part = 0; part < 4; ++part)
+        {
+            _mm512_storeu_si512(output + offset + part * 16,
+                                _mm512_maskz_permutex2var_epi8(upperBytes, low, interleave[part],
+                                                               high));
+        }
+    }
+    return offset + DecodeFloat8Avx512<Format>(input + offset, output + offset, size - offset);
+}
+
+RAD_TARGET_AVX512 inline Float32 HorizontalMaxAvx512(__m512 values) noexcept
+{
+    const __m256 low = _mm512_maskz_extractf32x8_ps(0xFF, values, 0);
+    const __m256 high = _mm512_maskz_extractf32x8_ps(0xFF, values, 1);
+    return HorizontalMaxAvx2(_mm256_max_ps(low, high));
+}
+
+RAD_TARGET_AVX512 std::size_t AbsMaxAvx512(const Float32* input, std::size_t size,
+                                           Float32& absMax) noexcept
+{
+    __m512 maxima[4] = {_mm512_set1_ps(absMax), _mm512_setzero_ps(), _mm512_setzero_ps(),
+                        _mm512_setzero_ps()};
+    std::size_t offset = 0;
+    for (; size - offset >= 64; offset += 64)
+    {
+        for (int index = 0; index < 4; ++index)
+        {
+            const __m512 values = _mm512_abs_ps(_mm512_loadu_ps(input + offset + index * 16));
+            maxima[index] = _mm512_maskz_max_ps(AllLanes32, values, maxima[index]);
+        }
+    }
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512 values = _mm512_abs_ps(_mm512_loadu_ps(input + offset));
+        maxima[0] = _mm512_maskz_max_ps(AllLanes32, values, maxima[0]);
+    }
+    absMax = HorizontalMaxAvx512(
+        _mm512_maskz_max_ps(AllLanes32, _mm512_maskz_max_ps(AllLanes32, maxima[0], maxima[1]),
+                            _mm512_maskz_max_ps(AllLanes32, maxima[2], maxima[3])));
+    return offset + AbsMaxAvx2(input + offset, size - offset, absMax);
+}
+
+RAD_TARGET_AVX512 inline __m512i Pcg32HashAvx512(__m512i values) noexcept
+{
+    const __m512i state =
+        _mm512_add_epi32(_mm512_mullo_epi32(values, _mm512_set1_epi32(747796405)),
+                         _mm512_set1_epi32(static_cast<int>(2891336453u)));
+    const __m512i shift = _mm512_add_epi32(_mm512_maskz_srli_epi32(AllLanes32, state, 28),
+                                           _mm512_set1_epi32(4));
+    const __m512i word =
+        _mm512_mullo_epi32(_mm512_xor_si512(_mm512_maskz_srlv_epi32(AllLanes32, state, shift),
+                                            state),
+                           _mm512_set1_epi32(277803737));
+    return _mm512_xor_si512(_mm512_maskz_srli_epi32(AllLanes32, word, 22), word);
+}
+
+template <typename Format, bool Stochastic>
+RAD_TARGET_AVX512 inline __m512i QuantizeFloat8Avx512(__m512 values, __m512i random,
+                                                      __m512i saturation) noexcept
+{
+    constexpr unsigned shift = 23 - Format::MantissaBits;
+    const __m512i bits = _mm512_castps_si512(values);
+    const __m512i sign = _mm512_and_si512(_mm512_maskz_srli_epi32(AllLanes32, bits, 24),
+                                          _mm512_set1_epi32(0x80));
+    __m512i magnitude = _mm512_and_si512(bits, _mm512_set1_epi32(0x7FFFFFFF));
+    const __mmask16 isNaN = _mm512_cmpgt_epu32_mask(magnitude, _mm512_set1_epi32(0x7F800000));
+    magnitude = _mm512_maskz_min_epu32(AllLanes32, magnitude, saturation);
+
+    __m512i code;
+    if constexpr (Stochastic)
+    {
+        const __m512i fixed = _mm512_maskz_cvttps_epi32(
+            AllLanes32, _mm512_mul_ps(_mm512_castsi512_ps(magnitude),
+                                      _mm512_set1_ps(Format::DenormalFixedScale)));
+        const __m512i denormal = _mm512_maskz_srli_epi32(
+            AllLanes32,
+            _mm512_add_epi32(fixed, _mm512_maskz_srli_epi32(AllLanes32, random, 8)), 24);
+        const __m512i rounded = _mm512_add_epi32(
+            magnitude, _mm512_maskz_srli_epi32(AllLanes32, random, 32 - shift));
+        code = _mm512_sub_epi32(_mm512_maskz_srli_epi32(AllLanes32, rounded, shift),
+                                _mm512_set1_epi32(Format::ExponentBias << Format::MantissaBits));
+        code = _mm512_mask_mov_epi32(
+            code, _mm512_cmplt_epu32_mask(magnitude, _mm512_set1_epi32(Format::MinimumNormal)),
+            denormal);
+        code = _mm512_mask_mov_epi32(
+            code, _mm512_cmpgt_epu32_mask(code, _mm512_set1_epi32(Format::MaxFiniteCode)),
+            _mm512_set1_epi32(Format::OverflowCode));
+    }
+    else
+    {
+        code = EncodeFloat8Avx512<Format>(_mm512_castsi512_ps(magnitude));
+        code = _mm512_mask_mov_epi32(
+            code, _mm512_cmpge_epu32_mask(magnitude, _mm512_set1_epi32(Format::OverflowBits)),
+            _mm512_set1_epi32(Format::OverflowCode));
+    }
+    return _mm512_or_si512(_mm512_mask_mov_epi32(code, isNaN, _mm512_set1_epi32(0x7F)), sign);
+}
+
+template <typename Format, bool Stochastic, bool TrackAbsMax, typename T>
+RAD_TARGET_AVX512 std::size_t QuantizeFloat8Avx512(const Float32* input, T* output,
+                                                   std::size_t size, const QuantizeParams& params,
+                                                   Float32& absMax) noexcept
+{
+    const __m512i saturation =
+        _mm512_set1_epi32(params.saturate ? static_cast<int>(Format::MaxFiniteBits) : -1);
+    const __m512 scale = _mm512_set1_ps(params.scale);
+    const __m512i key = _mm512_set1_epi32(static_cast<int>(params.key));
+    __m512i indices =
+        _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(params.firstIndex)),
+                         _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    __m512 maxima = _mm512_set1_ps(absMax);
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512 values = _mm512_loadu_ps(input + offset);
+        if constexpr (TrackAbsMax)
+        {
+            maxima = _mm512_maskz_max_ps(AllLanes32, _mm512_abs_ps(values), maxima);
+        }
+        const __m512i random = Stochastic ? Pcg32HashAvx512(_mm512_xor_si512(indices, key))
+                                          : _mm512_setzero_si512();
+        const __m512i codes = QuantizeFloat8Avx512<Format, Stochastic>(
+            _mm512_mul_ps(values, scale), random, saturation);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset),
+                         _mm512_maskz_cvtepi32_epi8(AllLanes32, codes));
+        indices = _mm512_add_epi32(indices, _mm512_set1_epi32(16));
+    }
+    if constexpr (TrackAbsMax)
+    {
+        absMax = HorizontalMaxAvx512(maxima);
+    }
+    QuantizeParams rest = params;
+    rest.firstIndex += static_cast<Uint32>(offset);
+    return offset + QuantizeFloat8Avx2<Format, Stochastic, TrackAbsMax>(
+                        input + offset, output + offset, size - offset, rest, absMax);
+}
+
+template <typename Format, bool TrackAbsMax, typename T>
+RAD_TARGET_AVX512 std::size_t QuantizeFloat8Avx512(const Float32* input, T* output,
+                                                   std::size_t size, const QuantizeParams& params,
+                                                   Float32& absMax) noexcept
+{
+    return params.stochastic
+               ? QuantizeFloat8Avx512<Format, true, TrackAbsMax>(input, output, size, params,
+                                                                 absMax)
+               : QuantizeFloat8Avx512<Format, false, TrackAbsMax>(input, output, size, params,
+                                                                  absMax);
+}
+
+#elif defined(RAD_ARCH_AARCH64)
+
+inline uint16x4_t EncodeBFloat16Neon(uint32x4_t bits) noexcept
+{
+    const uint32x4_t odd = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    const uint16x4_t rounded =
+        vshrn_n_u32(vaddq_u32(bits, vaddq_u32(vdupq_n_u32(0x7FFF), odd)), 16);
+    const uint16x4_t isNaN = vmovn_u32(
+        vcgtq_u32(vandq_u32(bits, vdupq_n_u32(0x7FFFFFFF)), vdupq_n_u32(0x7F800000)));
+    return vbsl_u16(isNaN, vdup_n_u16(0x7FC0), rounded);
+}
+
+std::size_t EncodeBFloat16Neon(const Float32* input, BFloat16* output, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const Uint32* source = reinterpret_cast<const Uint32*>(input + offset);
+        const uint16x4_t low = EncodeBFloat16Neon(vld1q_u32(source));
+        const uint16x4_t high = EncodeBFloat16Neon(vld1q_u32(source + 4));
+        vst1q_u16(reinterpret_cast<Uint16*>(output + offset), vcombine_u16(low, high));
+    }
+    return offset;
+}
+
+std::size_t DecodeBFloat16Neon(const BFloat16* input, Float32* output, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const uint16x8_t halves = vld1q_u16(reinterpret_cast<const Uint16*>(input + offset));
+        Uint32* destination = reinterpret_cast<Uint32*>(output + offset);
+        vst1q_u32(destination, vshll_n_u16(vget_low_u16(halves), 16));
+        vst1q_u32(destination + 4, vshll_n_u16(vget_high_u16(halves), 16));
+    }
+    return offset;
+}
+
+// The FCVT conversions round exactly like Float16 but quiet NaNs; vectors holding a NaN go
+// through the scalar type.
+std::size_t EncodeFloat16Neon(const Float32* input, Float16* output, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 4; offset += 4)
+    {
+        const float32x4_t values = vld1q_f32(input + offset);
+        if (vminvq_u32(vceqq_f32(values, values)) == 0)
+        {
+            EncodeScalar(input + offset, output + offset, 4);
+            continue;
+        }
+        vst1_u16(reinterpret_cast<Uint16*>(output + offset),
+                 vreinterpret_u16_f16(vcvt_f16_f32(values)));
+    }
+    return offset;
+}
+
+std::size_t DecodeFloat16Neon(const Float16* input, Float32* output, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 4; offset += 4)
+    {
+        const uint16x4_t halves = vld1_u16(reinterpret_cast<const Uint16*>(input + offset));
+        if (vmaxv_u16(vcgt_u16(vand_u16(halves, vdup_n_u16(0x7FFF)), vdup_n_u16(0x7C00))) != 0)
+        {
+            DecodeScalar(input + offset, output + offset, 4);
+            continue;
+        }
+        vst1q_f32(output + offset, vcvt_f32_f16(vreinterpret_f16_u16(halves)));
+    }
+    return offset;
+}
+
+// Looks up 16 magnitudes in the 128-entry planes with two 64-byte TBL lookups: TBL yields zero
+// and TBX keeps the destination for indices past the table.
+inline uint8x16_t LookupFloat8PlaneNeon(const uint8x16x4_t& first, const uint8x16x4_t& second,
+                                        uint8x16_t magnitude) noexcept
+{
+    return vqtbx4q_u8(vqtbl4q_u8(first, magnitude), second,
+                      vsubq_u8(magnitude, vdupq_n_u8(64)));
+}
+
+template <typename Format, typename T>
+std::size_t DecodeFloat8Neon(const T* input, Float32* output, std::size_t size) noexcept
+{
+    constexpr const Float8DecodePlanes& planes = Float8DecodePlanesOf<Format>;
+    const uint8x16x4_t low0 = vld1q_u8_x4(planes.low);
+    const uint8x16x4_t low1 = vld1q_u8_x4(planes.low + 64);
+    const uint8x16x4_t high0 = vld1q_u8_x4(planes.high);
+    const uint8x16x4_t high1 = vld1q_u8_x4(planes.high + 64);
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const Uint8*>(input + offset));
+        const uint8x16_t magnitude = vandq_u8(bytes, vdupq_n_u8(0x7F));
+        const uint8x16_t low = LookupFloat8PlaneNeon(low0, low1, magnitude);
+        const uint8x16_t high = vorrq_u8(LookupFloat8PlaneNeon(high0, high1, magnitude),
+                                         vandq_u8(bytes, vdupq_n_u8(0x80)));
+        // Interleaving the planes gives the upper halves of the Float32 encodings.
+        const uint16x8_t first = vreinterpretq_u16_u8(vzip1q_u8(low, high));
+        const uint16x8_t second = vreinterpretq_u16_u8(vzip2q_u8(low, high));
+        Uint32* destination = reinterpret_cast<Uint32*>(output + offset);
+        vst1q_u32(destination, vshll_n_u16(vget_low_u16(first), 16));
+        vst1q_u32(destination + 4, vshll_n_u16(vget_high_u16(first), 16));
+        vst1q_u32(destination + 8, vshll_n_u16(vget_low_u16(second), 16));
+        vst1q_u32(destination + 12, vshll_n_u16(vget_high_u16(second), 16));
+    }
+    return offset;
+}
+
+#endif
+
+template <typename T>
+[[nodiscard]] EncodeKernel<T> SelectEncodeKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            return EncodeBFloat16Avx512;
+        }
+        else if constexpr (std::is_same_v<T, Float16>)
+        {
+            return EncodeFloat16Avx512;
+        }
+        else if constexpr (std::is_same_v<T, Float8E4M3>)
+        {
+            return EncodeFloat8Avx512<Float8E4M3Format, T>;
+        }
+        else
+        {
+            return EncodeFloat8Avx512<Float8E5M2Format, T>;
+        }
+    case SimdLevel::AVX2:
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            return EncodeBFloat16Avx2;
+        }
+        else if constexpr (std::is_same_v<T, Float16>)
+        {
+            return EncodeFloat16Avx2;
+        }
+        else if constexpr (std::is_same_v<T, Float8E4M3>)
+        {
+            return EncodeFloat8Avx2<Float8E4M3Format, T>;
+        }
+        else
+        {
+            return EncodeFloat8Avx2<Float8E5M2Format, T>;
+        }
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            return EncodeBFloat16Neon;
+        }
+        else if constexpr (std::is_same_v<T, Float16>)
+        {
+            return EncodeFloat16Neon;
+        }
+        else
+        {
+            return nullptr;
+        }
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <typename T>
+[[nodiscard]] DecodeKernel<T> SelectDecodeKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            return DecodeBFloat16Avx512;
+        }
+        else if constexpr (std::is_same_v<T, Float16>)
+        {
+            return DecodeFloat16Avx512;
+        }
+        else if (IsVbmiSupported())
+        {
+            return DecodeFloat8Vbmi<Float8FormatOf<T>, T>;
+        }
+        else
+        {
+            return DecodeFloat8Avx512<Float8FormatOf<T>, T>;
+        }
+    case SimdLevel::AVX2:
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            return DecodeBFloat16Avx2;
+        }
+        else if constexpr (std::is_same_v<T, Float16>)
+        {
+            return DecodeFloat16Avx2;
+        }
+        else if constexpr (std::is_same_v<T, Float8E4M3>)
+        {
+            return DecodeFloat8Avx2<Float8E4M3Format, T>;
+        }
+        else
+        {
+            return DecodeFloat8Avx2<Float8E5M2Format, T>;
+        }
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            return DecodeBFloat16Neon;
+        }
+        else if constexpr (std::is_same_v<T, Float16>)
+        {
+            return DecodeFloat16Neon;
+        }
+        else
+        {
+            return DecodeFloat8Neon<Float8FormatOf<T>, T>;
+        }
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+[[nodiscard]] AbsMaxKernel SelectAbsMaxKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return AbsMaxAvx512;
+    case SimdLevel::AVX2:
+        return AbsMaxAvx2;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <typename T, bool TrackAbsMax>
+[[nodiscard]] QuantizeKernel<T> SelectQuantizeKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return QuantizeFloat8Avx512<Float8FormatOf<T>, TrackAbsMax, T>;
+    case SimdLevel::AVX2:
+        return QuantizeFloat8Avx2<Float8FormatOf<T>, TrackAbsMax, T>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <typename T>
+void Encode(Span<const Float32> input, Span<T> output) noexcept
+{
+    assert(output.size() >= input.size());
+    std::size_t offset = 0;
+    if (const EncodeKernel<T> kernel = SelectEncodeKernel<T>())
+    {
+        offset = kernel(input.data(), output.data(), input.size());
+    }
+    EncodeScalar(input.data() + offset, output.data() + offset, input.size() - offset);
+}
+
+template <typename T>
+void Decode(Span<const T> input, Span<Float32> output) noexcept
+{
+    assert(output.size() >= input.size());
+    std::size_t offset = 0;
+    if (const DecodeKernel<T> kernel = SelectDecodeKernel<T>())
+    {
+        offset = kernel(input.data(), output.data(), input.size());
+    }
+    DecodeScalar(input.data() + offset, output.data() + offset, input.size() - offset);
+}
+
+Float32 AbsMaxOf(const Float32* input, std::size_t size, Float32 absMax) noexcept
+{
+    std::size_t offset = 0;
+    if (const AbsMaxKernel kernel = SelectAbsMaxKernel())
+    {
+        offset = kernel(input, size, absMax);
+    }
+    AbsMaxScalar(input + offset, size - offset, absMax);
+    return absMax;
+}
+
+// Quantizes elements [firstIndex, firstIndex + size) of a tensor and returns their AbsMax, or 0
+// unless TrackAbsMax.
+template <bool TrackAbsMax, typename T>
+Float32 QuantizeRange(const Float32* input, T* output, std::size_t size, Float32 scale,
+                      const Float8QuantizeOptions& options, Uint64 firstIndex) noexcept
+{
+    const QuantizeKernel<T> kernel = SelectQuantizeKernel<T, TrackAbsMax>();
+    Float32 absMax = 0.0f;
+    std::size_t offset = 0;
+    while (offset < size)
+    {
+        // Splits at multiples of 2^32 so that each part hashes 32-bit indices with one key.
+        const Uint64 index = firstIndex + offset;
+        const Uint64 indexLimit = (Uint64{1} << 32) - (index & 0xFFFFFFFFu);
+        const auto count = static_cast<std::size_t>(std::min<Uint64>(size - offset, indexLimit));
+        QuantizeParams params = {};
+        params.scale = scale;
+        params.saturate = options.overflow == Float8Overflow::Saturate;
+        params.stochastic = options.rounding == Float8Rounding::Stochastic;
+        params.key = static_cast<Uint32>(pcg_hash64(options.seed + (index >> 32)));
+        params.firstIndex = static_cast<Uint32>(index);
+
+        const std::size_t done =
+            kernel ? kernel(input + offset, output + offset, count, params, absMax) : 0;
+        params.firstIndex += static_cast<Uint32>(done);
+        if (params.stochastic)
+        {
+            QuantizeFloat8Scalar<Float8FormatOf<T>, true, TrackAbsMax>(
+                input + offset + done, output + offset + done, count - done, params, absMax);
+        }
+        else
+        {
+            QuantizeFloat8Scalar<Float8FormatOf<T>, false, TrackAbsMax>(
+                input + offset + done, output + offset + done, count - done, params, absMax);
+        }
+        offset += count;
+    }
+    return absMax;
+}
+
+template <typename T>
+Float32 Quantize(Span<const Float32> input, Float32 scale, Span<T> output,
+                 const Float8QuantizeOptions& options) noexcept
+{
+    assert(output.size() >= input.size());
+    return QuantizeRange<true>(input.data(), output.data(), input.size(), scale, options, 0);
+}
+
+template <typename T>
+void QuantizeBlocks(Span<const Float32> input, std::size_t blockSize, Span<T> output,
+                    Span<Float32> scales, const Float8QuantizeOptions& options) noexcept
+{
+    assert(blockSize > 0 || input.empty());
+    assert(output.size() >= input.size());
+    for (std::size_t offset = 0, block = 0; offset < input.size(); offset += blockSize, ++block)
+    {
+        assert(block < scales.size());
+        const std::size_t count = std::min(blockSize, input.size() - offset);
+        const Float32 absMax = AbsMaxOf(input.data() + offset, count, 0.0f);
+        Float32 scale = 1.0f;
+        if (absMax > 0.0f && absMax <= std::numeric_limits<Float32>::max())
+        {
+            // Tiny maxima would overflow the scale to infinity and turn zeros into NaNs.
+            scale = std::min(Float8MaxFinite<T> / absMax, std::numeric_limits<Float32>::max());
+        }
+        scales[block] = scale;
+        // The block's amax is already known, so the kernel skips folding it again.
+        QuantizeRange<false>(input.data() + offset, output.data() + offset, count, scale, options,
+                             offset);
+    }
+}
+
+} // namespace
+
+void Convert(Span<const Float32> input, Span<BFloat16> output) noexcept
+{
+    Encode(input, output);
+}
+
+void Convert(Span<const BFloat16> input, Span<Float32> output) noexcept
+{
+    Decode(input, output);
+}
+
+void Convert(Span<const Float32> input, Span<Float16> output) noexcept
+{
+    Encode(input, output);
+}
+
+void Convert(Span<const Float16> input, Span<Float32> output) noexcept
+{
+    Decode(input, output);
+}
+
+void Convert(Span<const Float32> input, Span<Float8E4M3> output) noexcept
+{
+    Encode(input, output);
+}
+
+void Convert(Span<const Float8E4M3> input, Span<Float32> output) noexcept
+{
+    Decode(input, output);
+}
+
+void Convert(Span<const Float32> input, Span<Float8E5M2> output) noexcept
+{
+    Encode(input, output);
+}
+
+void Convert(Span<const Float8E5M2> input, Span<Float32> output) noexcept
+{
+    Decode(input, output);
+}
+
+Float32 AbsMax(Span<const Float32> input) noexcept
+{
+    return AbsMaxOf(input.data(), input.size(), 0.0f);
+}
+
+Float32 Quantize(Span<const Float32> input, Float32 scale, Span<Float8E4M3> output,
+                 const Float8QuantizeOptions& options) noexcept
+{
+    return Quantize<Float8E4M3>(input, scale, output, options);
+}
+
+Float32 Quantize(Span<const Float32> input, Float32 scale, Span<Float8E5M2> output,
+                 const Float8QuantizeOptions& options) noexcept
+{
+    return Quantize<Float8E5M2>(input, scale, output, options);
+}
+
+void QuantizeBlocks(Span<const Float32> input, std::size_t blockSize, Span<Float8E4M3> output,
+                    Span<Float32> scales, const Float8QuantizeOptions& options) noexcept
+{
+    QuantizeBlocks<Float8E4M3>(input, blockSize, output, scales, options);
+}
+
+void QuantizeBlocks(Span<const Float32> input, std::size_t blockSize, Span<Float8E5M2> output,
+                    Span<Float32> scales, const Float8QuantizeOptions& options) noexcept
+{
+    QuantizeBlocks<Float8E5M2>(input, blockSize, output, scales, options);
+}
+
+} // namespace rad
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <rad/Core/BFloat16.h>
+#include <rad/Core/Float.h>
+#include <rad/Core/Float16.h>
+#include <rad/Core/Float8.h>
+#include <rad/Core/Integer.h>
+#include <rad/Core/Span.h>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+
+namespace rad
+{
+
+// Bulk conversions between Float32 and the reduced-precision formats. Each output element is
+// bit-identical to converting the input element with the scalar type, including rounding and
+// NaN encodings, whichever SIMD kernel runs. The output must hold at least input.size()
+// elements and must not partially overlap the input.
+
+void Convert(Span<const Float32> input, Span<BFloat16> output) noexcept;
+void Convert(Span<const BFloat16> input, Span<Float32> output) noexcept;
+void Convert(Span<const Float32> input, Span<Float16> output) noexcept;
+void Convert(Span<const Float16> input, Span<Float32> output) noexcept;
+void Convert(Span<const Float32> input, Span<Float8E4M3> output) noexcept;
+void Convert(Span<const Float8E4M3> input, Span<Float32> output) noexcept;
+void Convert(Span<const Float32> input, Span<Float8E5M2> output) noexcept;
+void Convert(Span<const Float8E5M2> input, Span<Float32> output) noexcept;
+
+template <typename T>
+concept ReducedFloat = std::same_as<T, BFloat16> || std::same_as<T, Float16> ||
+                       std::same_as<T, Float8E4M3> || std::same_as<T, Float8E5M2>;
+
+// Converts between two reduced-precision formats through Float32, which is exact for every
+// source format; matches To(static_cast<float>(from)).
+template <ReducedFloat From, ReducedFloat To>
+    requires(!std::same_as<From, To>)
+void Convert(Span<const From> input, Span<To> output) noexcept
+{
+    assert(output.size() >= input.size());
+    Float32 buffer[256];
+    for (std::size_t offset = 0; offset < input.size(); offset += std::size(buffer))
+    {
+        const std::size_t count = std::min(input.size() - offset, std::size(buffer));
+        Convert(input.subspan(offset, count), Span<Float32>(buffer, count));
+        Convert(Span<const Float32>(buffer, count), output.subspan(offset, count));
+    }
+}
+
+// Float8 quantization: output[i] = Float8(input[i] * scale), with control over overflow and
+// rounding.
+
+enum class Float8Overflow
+{
+    // Out-of-range values, infinities included, clamp to the largest finite magnitude.
+    Saturate,
+    // Out-of-range values become NaN for Float8E4M3 and infinity for Float8E5M2.
+    Propagate,
+};
+
+enum class Float8Rounding
+{
+    NearestEven,
+    // Rounds away from zero with probability equal to the remainder, so the error is zero on
+    // average. The random bits are pcg_hash32 of the element index and the seed, so results are
+    // reproducible and independent of the SIMD level and of block boundaries.
+    Stochastic,
+};
+
+struct Float8QuantizeOptions
+{
+    Float8Overflow overflow = Float8Overflow::Saturate;
+    Float8Rounding rounding = Float8Rounding::NearestEven;
+    Uint64 seed = 0;
+};
+
+// Largest finite magnitude of a Float8 format, the usual target of amax scaling.
+template <typename T>
+    requires(std::same_as<T, Float8E4M3> || std::same_as<T, Float8E5M2>)
+inline constexpr Float32 Float8MaxFinite = static_cast<Float32>(std::numeric_limits<T>::max());
+
+// Returns the largest |input[i]|, ignoring NaNs; 0 for an empty span.
+[[nodiscard]] Float32 AbsMax(Span<const Float32> input) noexcept;
+
+// Quantizes input * scale into output and returns AbsMax(input) from the same sweep, so delayed
+// scaling can derive the next scale without another pass over the tensor. This is the
+// single-pass path for per-tensor scaling.
+Float32 Quantize(Span<const Float32> input, Float32 scale, Span<Float8E4M3> output,
+                 const Float8QuantizeOptions& options = {}) noexcept;
+Float32 Quantize(Span<const Float32> input, Float32 scale, Span<Float8E5M2> output,
+                 const Float8QuantizeOptions& options = {}) noexcept;
+
+// Quantizes blocks of blockSize elements (the last may be shorter) with one scale each:
+// scales[b] = Float8MaxFinite / amax of block b, at most the largest Float32, or 1 when amax is 0
+// or infinite, i.e. for blocks of only zeros and NaNs and for blocks containing +-Inf.
+// Each block is reduced, then quantized while it is still in cache, so blocks that fit in cache
+// are read from memory once; larger blocks are read twice. Dequantize with
+// output[i] / scales[i / blockSize]. For per-tensor scaling, prefer Quantize with a delayed scale.
+void QuantizeBlocks(Span<const Float32> input, std::size_t blockSize, Span<Float8E4M3> output,
+                    Span<Float32> scales, const Float8QuantizeOptions& options = {}) noexcept;
+void QuantizeBlocks(Span<const Float32> input, std::size_t blockSize, Span<Float8E5M2> output,
+                    Span<Float32> scales, const Float8QuantizeOptions& options = {}) noexcept;
+
+} // namespace rad
@@ -0,0 +1,402 @@
+#include <rad/Core/FloatConvert.h>
+#include <rad/System/CpuInfo.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr rad::SimdLevel SimdLevels[] = {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                         rad::SimdLevel::AVX2, rad::SimdLevel::AVX512,
+                                         rad::SimdLevel::NEON};
+
+std::uint32_t BitsOf(float value)
+{
+    return std::bit_cast<std::uint32_t>(value);
+}
+
+std::uint32_t BitsOf(rad::BFloat16 value)
+{
+    return value.Bits();
+}
+
+std::uint32_t BitsOf(rad::Float16 value)
+{
+    return value.bits();
+}
+
+std::uint32_t BitsOf(rad::Float8E4M3 value)
+{
+    return value.Bits();
+}
+
+std::uint32_t BitsOf(rad::Float8E5M2 value)
+{
+    return value.Bits();
+}
+
+template <typename T>
+T FromBits(std::uint32_t bits)
+{
+    if constexpr (std::is_same_v<T, rad::Float16>)
+    {
+        rad::Float16 value;
+        value.setBits(static_cast<std::uint16_t>(bits));
+        return value;
+    }
+    else if constexpr (std::is_same_v<T, rad::BFloat16>)
+    {
+        return T::FromBits(static_cast<std::uint16_t>(bits));
+    }
+    else
+    {
+        return T::FromBits(static_cast<std::uint8_t>(bits));
+    }
+}
+
+// Every value one ulp around each multiple of 2^13 in the float encoding, which covers every
+// rounding boundary and halfway point of the narrower formats, plus random bit patterns.
+std::vector<float> MakeEncodeInputs()
+{
+    std::vector<float> inputs;
+    for (std::uint32_t high = 0; high < (1u << 19); ++high)
+    {
+        const std::uint32_t bits = high << 13;
+        for (const std::uint32_t value : {bits, bits + 1, bits - 1})
+        {
+            inputs.push_back(std::bit_cast<float>(value));
+        }
+    }
+    std::mt19937 random(11);
+    for (int index = 0; index < (1 << 18); ++index)
+    {
+        inputs.push_back(std::bit_cast<float>(static_cast<std::uint32_t>(random())));
+    }
+    return inputs;
+}
+
+template <typename T>
+void ExpectEncodeMatchesScalar(const std::vector<float>& inputs)
+{
+    std::vector<T> outputs(inputs.size());
+    rad::Convert(inputs, outputs);
+    for (std::size_t index = 0; index < inputs.size(); ++index)
+    {
+        ASSERT_EQ(BitsOf(outputs[index]), BitsOf(T(inputs[index])))
+            << std::hex << "input 0x" << BitsOf(inputs[index]);
+    }
+}
+
+template <typename T>
+void ExpectDecodeMatchesScalar()
+{
+    constexpr std::uint32_t count = 1u << (8 * sizeof(T));
+    std::vector<T> inputs(count);
+    for (std::uint32_t bits = 0; bits < count; ++bits)
+    {
+        inputs[bits] = FromBits<T>(bits);
+    }
+    std::vector<float> outputs(count);
+    rad::Convert(inputs, outputs);
+    for (std::uint32_t bits = 0; bits < count; ++bits)
+    {
+        ASSERT_EQ(BitsOf(outputs[bits]), BitsOf(static_cast<float>(inputs[bits])))
+            << std::hex << "input 0x" << bits;
+    }
+}
+
+} // namespace
+
+TEST(Core, FloatConvertMatchesScalar)
+{
+    const std::vector<float> inputs = MakeEncodeInputs();
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        SCOPED_TRACE(static_cast<int>(level));
+        ExpectEncodeMatchesScalar<rad::BFloat16>(inputs);
+        ExpectEncodeMatchesScalar<rad::Float16>(inputs);
+        ExpectEncodeMatchesScalar<rad::Float8E4M3>(inputs);
+        ExpectEncodeMatchesScalar<rad::Float8E5M2>(inputs);
+        ExpectDecodeMatchesScalar<rad::BFloat16>();
+        ExpectDecodeMatchesScalar<rad::Float16>();
+        ExpectDecodeMatchesScalar<rad::Float8E4M3>();
+        ExpectDecodeMatchesScalar<rad::Float8E5M2>();
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, FloatConvertPartialSpans)
+{
+    std::vector<float> inputs(150);
+    for (std::size_t index = 0; index < inputs.size(); ++index)
+    {
+        inputs[index] = static_cast<float>(index) * 0.37f - 9.0f;
+    }
+    inputs[21] = std::numeric_limits<float>::quiet_NaN();
+
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        // Unaligned starts and sizes around every vector width; elements past the end stay
+        // untouched.
+        for (std::size_t size = 0; size <= 140; ++size)
+        {
+            const rad::Span<const float> source(inputs.data() + 3, size);
+            std::vector<rad::Float16> halves(size + 1, rad::Float16(42.0f));
+            rad::Convert(source, rad::Span<rad::Float16>(halves.data(), size));
+            std::vector<float> decoded(size + 1, 42.0f);
+            rad::Convert(rad::Span<const rad::Float16>(halves.data(), size),
+                         rad::Span<float>(decoded.data(), size));
+            std::vector<rad::Float8E4M3> bytes(size + 1, rad::Float8E4M3(42.0f));
+            rad::Convert(source, rad::Span<rad::Float8E4M3>(bytes.data(), size));
+            std::vector<float> dequantized(size + 1, 42.0f);
+            rad::Convert(rad::Span<const rad::Float8E4M3>(bytes.data(), size),
+                         rad::Span<float>(dequantized.data(), size));
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                ASSERT_EQ(halves[index].bits(), rad::Float16(source[index]).bits()) << size;
+                ASSERT_EQ(BitsOf(decoded[index]), BitsOf(static_cast<float>(halves[index])));
+                ASSERT_EQ(bytes[index].Bits(), rad::Float8E4M3(source[index]).Bits()) << size;
+                ASSERT_EQ(BitsOf(dequantized[index]), BitsOf(static_cast<float>(bytes[index])));
+            }
+            EXPECT_EQ(dequantized[size], 42.0f);
+            EXPECT_EQ(static_cast<float>(halves[size]), 42.0f);
+            EXPECT_EQ(decoded[size], 42.0f);
+            EXPECT_EQ(static_cast<float>(bytes[size]), 40.0f);
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, FloatConvertBetweenFormats)
+{
+    std::vector<rad::Float16> halves(1u << 16);
+    for (std::uint32_t bits = 0; bits < halves.size(); ++bits)
+    {
+        halves[bits] = FromBits<rad::Float16>(bits);
+    }
+    std::vector<rad::BFloat16> brains(halves.size());
+    rad::Convert(rad::Span<const rad::Float16>(halves), rad::Span<rad::BFloat16>(brains));
+    std::vector<rad::Float8E5M2> bytes(halves.size());
+    rad::Convert(rad::Span<const rad::Float16>(halves), rad::Span<rad::Float8E5M2>(bytes));
+    for (std::size_t index = 0; index < halves.size(); ++index)
+    {
+        const float value = halves[index];
+        ASSERT_EQ(brains[index].Bits(), rad::BFloat16(value).Bits()) << index;
+        ASSERT_EQ(bytes[index].Bits(), rad::Float8E5M2(value).Bits()) << index;
+    }
+
+    std::vector<rad::Float16> roundTrip(bytes.size());
+    rad::Convert(rad::Span<const rad::Float8E5M2>(bytes), rad::Span<rad::Float16>(roundTrip));
+    for (std::size_t index = 0; index < bytes.size(); ++index)
+    {
+        ASSERT_EQ(roundTrip[index].bits(), rad::Float16(static_cast<float>(bytes[index])).bits());
+    }
+}
+
+namespace
+{
+
+// Float8(value) plus the quantization overflow rules.
+template <typename T>
+std::uint32_t QuantizeNearestReference(float value, rad::Float8Overflow overflow)
+{
+    constexpr float maxFinite = rad::Float8MaxFinite<T>;
+    if (overflow == rad::Float8Overflow::Saturate && !std::isnan(value))
+    {
+        value = std::clamp(value, -maxFinite, maxFinite);
+    }
+    // Float8E4M3 saturates on its own; past the halfway point to 480 it is out of range.
+    if (std::is_same_v<T, rad::Float8E4M3> && std::abs(value) > 464.0f)
+    {
+        return std::signbit(value) ? 0xFFu : 0x7Fu;
+    }
+    return T(value).Bits();
+}
+
+template <typename T>
+void ExpectQuantizeNearestMatchesReference(const std::vector<float>& inputs)
+{
+    std::vector<T> outputs(inputs.size());
+    for (const rad::Float8Overflow overflow :
+         {rad::Float8Overflow::Saturate, rad::Float8Overflow::Propagate})
+    {
+        for (const float scale : {1.0f, 3.0f})
+        {
+            rad::Float8QuantizeOptions options;
+            options.overflow = overflow;
+            rad::Quantize(inputs, scale, outputs, options);
+            for (std::size_t index = 0; index < inputs.size(); ++index)
+            {
+                ASSERT_EQ(outputs[index].Bits(),
+                          QuantizeNearestReference<T>(inputs[index] * scale, overflow))
+                    << std::hex << "input 0x" << BitsOf(inputs[index]) << ", scale " << scale;
+            }
+        }
+    }
+}
+
+// Stochastic rounding has no independent reference; every level must agree with the scalar
+// path.
+template <typename T>
+void ExpectQuantizeStochasticMatchesScalar(const std::vector<float>& inputs,
+                                           rad::SimdLevel level)
+{
+    for (const rad::Float8Overflow overflow :
+         {rad::Float8Overflow::Saturate, rad::Float8Overflow::Propagate})
+    {
+        rad::Float8QuantizeOptions options;
+        options.overflow = overflow;
+        options.rounding = rad::Float8Rounding::Stochastic;
+        options.seed = 0x1234'5678'9ABC'DEF0ull;
+        std::vector<T> expected(inputs.size());
+        rad::SetSimdLevelLimit(rad::SimdLevel::Scalar);
+        const float expectedAbsMax = rad::Quantize(inputs, 2.0f, expected, options);
+        std::vector<T> outputs(inputs.size());
+        rad::SetSimdLevelLimit(level);
+        EXPECT_EQ(BitsOf(rad::Quantize(inputs, 2.0f, outputs, options)), BitsOf(expectedAbsMax));
+        for (std::size_t index = 0; index < inputs.size(); ++index)
+        {
+            ASSERT_EQ(outputs[index].Bits(), expected[index].Bits())
+                << std::hex << "input 0x" << BitsOf(inputs[index]);
+        }
+    }
+}
+
+} // namespace
+
+TEST(Core, Float8QuantizeMatchesReference)
+{
+    const std::vector<float> inputs = MakeEncodeInputs();
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        SCOPED_TRACE(static_cast<int>(level));
+        rad::SetSimdLevelLimit(level);
+        ExpectQuantizeNearestMatchesReference<rad::Float8E4M3>(inputs);
+        ExpectQuantizeNearestMatchesReference<rad::Float8E5M2>(inputs);
+        ExpectQuantizeStochasticMatchesScalar<rad::Float8E4M3>(inputs, level);
+        ExpectQuantizeStochasticMatchesScalar<rad::Float8E5M2>(inputs, level);
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, Float8QuantizeStochasticIsUnbiased)
+{
+    rad::Float8QuantizeOptions options;
+    options.rounding = rad::Float8Rounding::Stochastic;
+    options.seed = 99;
+    // A normal value, a denormal one and one below the smallest denormal.
+    for (const float value : {1.1f, -3.7f, 0.0061f, 0.0013f})
+    {
+        const std::vector<float> inputs(1 << 16, value);
+        std::vector<rad::Float8E4M3> outputs(inputs.size());
+        rad::Quantize(inputs, 1.0f, outputs, options);
+        double sum = 0.0;
+        float lowest = std::numeric_limits<float>::infinity();
+        float highest = -lowest;
+        for (const rad::Float8E4M3 output : outputs)
+        {
+            const float decoded = output;
+            sum += decoded;
+            lowest = std::min(lowest, decoded);
+            highest = std::max(highest, decoded);
+        }
+        // Results are the two neighbours of the value, mixed so that the mean is the value.
+        EXPECT_LE(lowest, value);
+        EXPECT_GE(highest, value);
+        EXPECT_EQ(std::abs(rad::Float8E4M3(highest).Bits() - rad::Float8E4M3(lowest).Bits()), 1);
+        const double spread = static_cast<double>(highest) - lowest;
+        EXPECT_NEAR(sum / static_cast<double>(outputs.size()), value, spread * 0.01) << value;
+    }
+
+    // The seed selects the stream; the same seed reproduces it.
+    const std::vector<float> inputs(1000, 1.1f);
+    std::vector<rad::Float8E4M3> first(inputs.size());
+    std::vector<rad::Float8E4M3> second(inputs.size());
+    rad::Quantize(inputs, 1.0f, first, options);
+    rad::Quantize(inputs, 1.0f, second, options);
+    EXPECT_TRUE(std::equal(first.begin(), first.end(), second.begin(),
+                           [](auto lhs, auto rhs) { return lhs.Bits() == rhs.Bits(); }));
+    options.seed = 100;
+    rad::Quantize(inputs, 1.0f, second, options);
+    EXPECT_FALSE(std::equal(first.begin(), first.end(), second.begin(),
+                            [](auto lhs, auto rhs) { return lhs.Bits() == rhs.Bits(); }));
+}
+
+TEST(Core, Float8QuantizeBlocks)
+{
+    std::mt19937 random(5);
+    std::normal_distribution<float> distribution;
+    constexpr std::size_t blockSize = 100;
+    std::vector<float> inputs(10 * blockSize + 37);
+    for (std::size_t index = 0; index < inputs.size(); ++index)
+    {
+        // Blocks span magnitudes far outside the Float8 range.
+        inputs[index] = distribution(random) * std::ldexp(1.0f, static_cast<int>(index / 40) - 12);
+    }
+    std::fill_n(inputs.begin() + 3 * blockSize, blockSize, 0.0f);
+    inputs[5 * blockSize + 7] = std::numeric_limits<float>::quiet_NaN();
+    inputs[7 * blockSize + 3] = -std::numeric_limits<float>::infinity();
+
+    const float withNaN[] = {-2.0f, std::numeric_limits<float>::quiet_NaN(), 1.0f};
+    EXPECT_EQ(rad::AbsMax(withNaN), 2.0f);
+    EXPECT_EQ(rad::AbsMax(rad::Span<const float>()), 0.0f);
+
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        std::vector<rad::Float8E4M3> outputs(inputs.size());
+        std::vector<float> scales((inputs.size() + blockSize - 1) / blockSize);
+        rad::QuantizeBlocks(inputs, blockSize, outputs, scales);
+        for (std::size_t block = 0; block < scales.size(); ++block)
+        {
+            const auto values =
+                rad::Span<const float>(inputs).subspan(block * blockSize).first(
+                    std::min(blockSize, inputs.size() - block * blockSize));
+            const float absMax = rad::AbsMax(values);
+            EXPECT_EQ(scales[block],
+                      (absMax == 0.0f || std::isinf(absMax)) ? 1.0f : 448.0f / absMax)
+                << block;
+            for (std::size_t index = 0; index < values.size(); ++index)
+            {
+                const float restored =
+                    static_cast<float>(outputs[block * blockSize + index]) / scales[block];
+                if (std::isnan(values[index]))
+                {
+                    EXPECT_TRUE(std::isnan(restored));
+                    continue;
+                }
+                // Three mantissa bits: within half a step of 2^-3 relative to the block maximum.
+                ASSERT_LE(std::abs(restored - values[index]), absMax * 0x1p-4f) << block;
+            }
+        }
+        // The infinite block keeps scale 1, and the infinity saturates.
+        EXPECT_EQ(static_cast<float>(outputs[7 * blockSize + 3]), -448.0f);
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
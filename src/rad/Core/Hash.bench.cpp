@@ -0,0 +1,193 @@
+#include <rad/Core/Hash.h>
+#include <rad/System/CpuInfo.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// Large enough that the keys and hashes come from memory rather than cache.
+constexpr std::size_t BatchKeyCount = 1 << 22;
+
+// One pcg_hash call per key, as callers did before HashBatch.
+template <typename T>
+void BM_HashBatchScalarLoop(benchmark::State& state)
+{
+    std::vector<T> keys(BatchKeyCount);
+    std::iota(keys.begin(), keys.end(), T(0));
+    std::vector<T> hashes(BatchKeyCount);
+    for (auto _ : state)
+    {
+        for (std::size_t index = 0; index < keys.size(); ++index)
+        {
+            if constexpr (sizeof(T) == sizeof(std::uint32_t))
+            {
+                hashes[index] = rad::pcg_hash32(keys[index]);
+            }
+            else
+            {
+                hashes[index] = rad::pcg_hash64(keys[index]);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(sizeof(T) * 2) *
+                            static_cast<std::int64_t>(BatchKeyCount));
+}
+
+// The argument selects the rad::SimdLevel limit; unsupported levels are skipped.
+template <typename T>
+void BM_HashBatch(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return;
+    }
+    rad::SetSimdLevelLimit(level);
+    std::vector<T> keys(BatchKeyCount);
+    std::iota(keys.begin(), keys.end(), T(0));
+    std::vector<T> hashes(BatchKeyCount);
+    for (auto _ : state)
+    {
+        rad::HashBatch(rad::Span<const T>(keys), hashes);
+        benchmark::ClobberMemory();
+    }
+    // Bytes read plus bytes written.
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(sizeof(T) * 2) *
+                            static_cast<std::int64_t>(BatchKeyCount));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+std::string MakeText(std::size_t size)
+{
+    std::mt19937 random(1);
+    std::string text(size, '\0');
+    for (char& value : text)
+    {
+        value = static_cast<char>('a' + random() % 26);
+    }
+    return text;
+}
+
+template <typename Hasher>
+void BM_HashString(benchmark::State& state)
+{
+    const std::string text = MakeText(static_cast<std::size_t>(state.range(0)));
+    const Hasher hasher;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hasher(std::string_view(text)));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Build and probe side of a hash join on strided 64-bit keys, as produced by row ids or
+// aligned offsets.
+template <typename Hasher>
+void BM_HashJoin(benchmark::State& state)
+{
+    constexpr std::size_t KeyCount = 1 << 16;
+    std::vector<std::uint64_t> keys(KeyCount);
+    for (std::size_t index = 0; index < KeyCount; ++index)
+    {
+        keys[index] = index << 12;
+    }
+    std::vector<std::uint64_t> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(2));
+
+    for (auto _ : state)
+    {
+        std::unordered_map<std::uint64_t, std::uint32_t, Hasher> table;
+        table.reserve(KeyCount);
+        for (std::size_t index = 0; index < KeyCount; ++index)
+        {
+            table.emplace(keys[index], static_cast<std::uint32_t>(index));
+        }
+        std::uint64_t sum = 0;
+        for (const std::uint64_t probe : probes)
+        {
+            sum += table.find(probe)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(KeyCount));
+}
+
+// The same join on an open-addressing table indexed by the low hash bits, where an identity hash
+// sends strided keys to a handful of slots.
+template <typename Hasher>
+void BM_HashJoinPowerOfTwo(benchmark::State& state)
+{
+    constexpr std::size_t KeyCount = 1 << 12;
+    constexpr std::size_t SlotMask = KeyCount * 2 - 1;
+    std::vector<std::uint64_t> probes(KeyCount);
+    for (std::size_t index = 0; index < KeyCount; ++index)
+    {
+        probes[index] = index << 12;
+    }
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(2));
+
+    const Hasher hasher;
+    // Slots hold key + 1 so that zero marks an empty slot.
+    std::vector<std::uint64_t> slots(SlotMask + 1);
+    for (auto _ : state)
+    {
+        std::fill(slots.begin(), slots.end(), 0);
+        for (const std::uint64_t key : probes)
+        {
+            std::size_t slot = hasher(key) & SlotMask;
+            while (slots[slot] != 0)
+            {
+                slot = (slot + 1) & SlotMask;
+            }
+            slots[slot] = key + 1;
+        }
+        std::size_t sum = 0;
+        for (const std::uint64_t key : probes)
+        {
+            std::size_t slot = hasher(key) & SlotMask;
+            while (slots[slot] != key + 1)
+            {
+                slot = (slot + 1) & SlotMask;
+            }
+            sum += slot;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(KeyCount));
+}
+
+} // namespace
+
+BENCHMARK(BM_HashString<std::hash<std::string_view>>)->Arg(8)->Arg(64)->Arg(1024)->Arg(65536);
+BENCHMARK(BM_HashString<rad::StringHash>)->Arg(8)->Arg(64)->Arg(1024)->Arg(65536);
+BENCHMARK(BM_HashJoin<std::hash<std::uint64_t>>);
+BENCHMARK(BM_HashJoin<rad::Hash<std::uint64_t>>);
+BENCHMARK(BM_HashJoinPowerOfTwo<std::hash<std::uint64_t>>);
+BENCHMARK(BM_HashJoinPowerOfTwo<rad::Hash<std::uint64_t>>);
+BENCHMARK(BM_HashBatchScalarLoop<std::uint32_t>);
+BENCHMARK(BM_HashBatch<std::uint32_t>)->Apply(SimdLevels);
+BENCHMARK(BM_HashBatchScalarLoop<std::uint64_t>);
+BENCHMARK(BM_HashBatch<std::uint64_t>)->Apply(SimdLevels);
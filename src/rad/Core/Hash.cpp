@@ -1,6 +1,313 @@
 #include <rad/Core/Hash.h>
+#include <rad/Core/Platform.h>
+#include <rad/System/CpuInfo.h>
+
+// Exposes XXH3_state_t, which Hasher keeps inline.
+#define XXH_STATIC_LINKING_ONLY
+#include <xxhash.h>
+
+#include <new>
+
+#if defined(RAD_ARCH_X86)
+#include <immintrin.h>
+#elif defined(RAD_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif
 
 namespace rad
 {
 
+namespace
+{
+
+// Batch kernels hash a prefix of whole vectors and return how many values they consumed; the
+// scalar functions finish the rest.
+template <typename T>
+using HashBatchKernel = std::size_t (*)(const T* input, T* output, std::size_t size,
+                                        T seed) noexcept;
+
+// Constants shared with pcg_hash32 and pcg_hash64.
+constexpr Uint32 Pcg32Multiplier = 747796405u;
+constexpr Uint32 Pcg32Increment = 2891336453u;
+constexpr Uint32 Pcg32WordMultiplier = 277803737u;
+constexpr Uint64 Pcg64Multiplier = 6364136223846793005ull;
+constexpr Uint64 Pcg64Increment = 1442695040888963407ull;
+constexpr Uint64 Pcg64WordMultiplier = 12605985483714917081ull;
+
+[[nodiscard]] XXH3_state_t* GetXxh3State(unsigned char* storage) noexcept
+{
+    return std::launder(reinterpret_cast<XXH3_state_t*>(storage));
+}
+
+[[nodiscard]] const XXH3_state_t* GetXxh3State(const unsigned char* storage) noexcept
+{
+    return std::launder(reinterpret_cast<const XXH3_state_t*>(storage));
+}
+
+#if defined(RAD_ARCH_X86)
+
+RAD_TARGET_AVX2 std::size_t HashBatch32Avx2(const Uint32* input, Uint32* output,
+                                            std::size_t size, Uint32 seed) noexcept
+{
+    const __m256i seeds = _mm256_set1_epi32(static_cast<int>(seed));
+    const __m256i multiplier = _mm256_set1_epi32(static_cast<int>(Pcg32Multiplier));
+    const __m256i increment = _mm256_set1_epi32(static_cast<int>(Pcg32Increment));
+    const __m256i wordMultiplier = _mm256_set1_epi32(static_cast<int>(Pcg32WordMultiplier));
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256i values = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset)), seeds);
+        const __m256i state = _mm256_add_epi32(_mm256_mullo_epi32(values, multiplier), increment);
+        const __m256i shift = _mm256_add_epi32(_mm256_srli_epi32(state, 28), _mm256_set1_epi32(4));
+        const __m256i word = _mm256_mullo_epi32(
+            _mm256_xor_si256(_mm256_srlv_epi32(state, shift), state), wordMultiplier);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset),
+                            _mm256_xor_si256(_mm256_srli_epi32(word, 22), word));
+    }
+    return offset;
+}
+
+// Low 64 bits of a 64x64-bit product; AVX2 only multiplies 32-bit halves.
+RAD_TARGET_AVX2 inline __m256i MultiplyLow64(__m256i lhs, Uint64 rhs) noexcept
+{
+    const __m256i rhsLow = _mm256_set1_epi64x(static_cast<long long>(rhs));
+    const __m256i rhsHigh = _mm256_set1_epi64x(static_cast<long long>(rhs >> 32));
+    const __m256i low = _mm256_mul_epu32(lhs, rhsLow);
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), rhsLow),
+                                           _mm256_mul_epu32(lhs, rhsHigh));
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+RAD_TARGET_AVX2 std::size_t HashBatch64Avx2(const Uint64* input, Uint64* output,
+                                            std::size_t size, Uint64 seed) noexcept
+{
+    const __m256i seeds = _mm256_set1_epi64x(static_cast<long long>(seed));
+    const __m256i increment = _mm256_set1_epi64x(static_cast<long long>(Pcg64Increment));
+    std::size_t offset = 0;
+    for (; size - offset >= 4; offset += 4)
+    {
+        const __m256i values = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset)), seeds);
+        const __m256i state = _mm256_add_epi64(MultiplyLow64(values, Pcg64Multiplier), increment);
+        const __m256i shift = _mm256_add_epi64(_mm256_srli_epi64(state, 59), _mm256_set1_epi64x(5));
+        const __m256i word = MultiplyLow64(
+            _mm256_xor_si256(_mm256_srlv_epi64(state, shift), state), Pcg64WordMultiplier);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset),
+                            _mm256_xor_si256(_mm256_srli_epi64(word, 43), word));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX512 std::size_t HashBatch32Avx512(const Uint32* input, Uint32* output,
+                                                std::size_t size, Uint32 seed) noexcept
+{
+    const __m512i seeds = _mm512_set1_epi32(static_cast<int>(seed));
+    const __m512i multiplier = _mm512_set1_epi32(static_cast<int>(Pcg32Multiplier));
+    const __m512i increment = _mm512_set1_epi32(static_cast<int>(Pcg32Increment));
+    const __m512i wordMultiplier = _mm512_set1_epi32(static_cast<int>(Pcg32WordMultiplier));
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512i values = _mm512_xor_si512(_mm512_loadu_si512(input + offset), seeds);
+        const __m512i state = _mm512_add_epi32(_mm512_mullo_epi32(values, multiplier), increment);
+        const __m512i shift = _mm512_add_epi32(_mm512_maskz_srli_epi32(AllLanes32, state, 28),
+                                               _mm512_set1_epi32(4));
+        const __m512i shifted = _mm512_maskz_srlv_epi32(AllLanes32, state, shift);
+        const __m512i word =
+            _mm512_mullo_epi32(_mm512_xor_si512(shifted, state), wordMultiplier);
+        _mm512_storeu_si512(output + offset,
+                            _mm512_xor_si512(_mm512_maskz_srli_epi32(AllLanes32, word, 22), word));
+    }
+    return offset + HashBatch32Avx2(input + offset, output + offset, size - offset, seed);
+}
+
+RAD_TARGET_AVX512 std::size_t HashBatch64Avx512(const Uint64* input, Uint64* output,
+                                                std::size_t size, Uint64 seed) noexcept
+{
+    const __m512i seeds = _mm512_set1_epi64(static_cast<long long>(seed));
+    const __m512i multiplier = _mm512_set1_epi64(static_cast<long long>(Pcg64Multiplier));
+    const __m512i increment = _mm512_set1_epi64(static_cast<long long>(Pcg64Increment));
+    const __m512i wordMultiplier = _mm512_set1_epi64(static_cast<long long>(Pcg64WordMultiplier));
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m512i values = _mm512_xor_si512(_mm512_loadu_si512(input + offset), seeds);
+        const __m512i state = _mm512_add_epi64(_mm512_mullo_epi64(values, multiplier), increment);
+        const __m512i shift = _mm512_add_epi64(_mm512_maskz_srli_epi64(AllLanes64, state, 59),
+                                               _mm512_set1_epi64(5));
+        const __m512i shifted = _mm512_maskz_srlv_epi64(AllLanes64, state, shift);
+        const __m512i word =
+            _mm512_mullo_epi64(_mm512_xor_si512(shifted, state), wordMultiplier);
+        _mm512_storeu_si512(output + offset,
+                            _mm512_xor_si512(_mm512_maskz_srli_epi64(AllLanes64, word, 43), word));
+    }
+    return offset + HashBatch64Avx2(input + offset, output + offset, size - offset, seed);
+}
+
+#elif defined(RAD_ARCH_AARCH64)
+
+std::size_t HashBatch32Neon(const Uint32* input, Uint32* output, std::size_t size,
+                            Uint32 seed) noexcept
+{
+    const uint32x4_t seeds = vdupq_n_u32(seed);
+    const uint32x4_t increment = vdupq_n_u32(Pcg32Increment);
+    std::size_t offset = 0;
+    for (; size - offset >= 4; offset += 4)
+    {
+        const uint32x4_t values = veorq_u32(vld1q_u32(input + offset), seeds);
+        const uint32x4_t state = vmlaq_n_u32(increment, values, Pcg32Multiplier);
+        // NEON shifts right by negative left-shift counts.
+        const int32x4_t shift = vnegq_s32(
+            vreinterpretq_s32_u32(vaddq_u32(vshrq_n_u32(state, 28), vdupq_n_u32(4))));
+        const uint32x4_t word =
+            vmulq_n_u32(veorq_u32(vshlq_u32(state, shift), state), Pcg32WordMultiplier);
+        vst1q_u32(output + offset, veorq_u32(vshrq_n_u32(word, 22), word));
+    }
+    return offset;
+}
+
+// Low 64 bits of a 64x64-bit product; NEON only multiplies 32-bit halves.
+inline uint64x2_t MultiplyLow64(uint64x2_t lhs, Uint64 rhs) noexcept
+{
+    const uint32x2_t lhsLow = vmovn_u64(lhs);
+    const uint32x2_t lhsHigh = vshrn_n_u64(lhs, 32);
+    const uint32x2_t rhsLow = vdup_n_u32(static_cast<Uint32>(rhs));
+    const uint32x2_t rhsHigh = vdup_n_u32(static_cast<Uint32>(rhs >> 32));
+    const uint64x2_t cross = vmlal_u32(vmull_u32(lhsHigh, rhsLow), lhsLow, rhsHigh);
+    return vaddq_u64(vmull_u32(lhsLow, rhsLow), vshlq_n_u64(cross, 32));
+}
+
+std::size_t HashBatch64Neon(const Uint64* input, Uint64* output, std::size_t size,
+                            Uint64 seed) noexcept
+{
+    const uint64x2_t seeds = vdupq_n_u64(seed);
+    const uint64x2_t increment = vdupq_n_u64(Pcg64Increment);
+    std::size_t offset = 0;
+    for (; size - offset >= 2; offset += 2)
+    {
+        const uint64x2_t values = veorq_u64(vld1q_u64(input + offset), seeds);
+        const uint64x2_t state = vaddq_u64(MultiplyLow64(values, Pcg64Multiplier), increment);
+        const int64x2_t shift = vnegq_s64(
+            vreinterpretq_s64_u64(vaddq_u64(vshrq_n_u64(state, 59), vdupq_n_u64(5))));
+        const uint64x2_t word =
+            MultiplyLow64(veorq_u64(vshlq_u64(state, shift), state), Pcg64WordMultiplier);
+        vst1q_u64(output + offset, veorq_u64(vshrq_n_u64(word, 43), word));
+    }
+    return offset;
+}
+
+#endif
+
+[[nodiscard]] HashBatchKernel<Uint32> SelectHashBatch32Kernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return HashBatch32Avx512;
+    case SimdLevel::AVX2:
+        return HashBatch32Avx2;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return HashBatch32Neon;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+[[nodiscard]] HashBatchKernel<Uint64> SelectHashBatch64Kernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return HashBatch64Avx512;
+    case SimdLevel::AVX2:
+        return HashBatch64Avx2;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return HashBatch64Neon;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace
+
+void HashBatch(Span<const Uint32> input, Span<Uint32> output, Uint32 seed) noexcept
+{
+    assert(output.size() >= input.size());
+    std::size_t offset = 0;
+    if (const HashBatchKernel<Uint32> kernel = SelectHashBatch32Kernel())
+    {
+        offset = kernel(input.data(), output.data(), input.size(), seed);
+    }
+    for (; offset < input.size(); ++offset)
+    {
+        output[offset] = pcg_hash32(input[offset] ^ seed);
+    }
+}
+
+void HashBatch(Span<const Uint64> input, Span<Uint64> output, Uint64 seed) noexcept
+{
+    assert(output.size() >= input.size());
+    std::size_t offset = 0;
+    if (const HashBatchKernel<Uint64> kernel = SelectHashBatch64Kernel())
+    {
+        offset = kernel(input.data(), output.data(), input.size(), seed);
+    }
+    for (; offset < input.size(); ++offset)
+    {
+        output[offset] = pcg_hash64(input[offset] ^ seed);
+    }
+}
+
+Uint64 HashBytes64(const void* data, std::size_t size, Uint64 seed) noexcept
+{
+    assert(data != nullptr || size == 0);
+    return XXH3_64bits_withSeed(data, size, seed);
+}
+
+Hash128 HashBytes128(const void* data, std::size_t size, Uint64 seed) noexcept
+{
+    assert(data != nullptr || size == 0);
+    const XXH128_hash_t hash = XXH3_128bits_withSeed(data, size, seed);
+    return {hash.low64, hash.high64};
+}
+
+static_assert(sizeof(Hasher) >= sizeof(XXH3_state_t) && alignof(Hasher) >= alignof(XXH3_state_t),
+              "Hasher::m_state must hold an XXH3_state_t");
+
+Hasher::Hasher(Uint64 seed) noexcept
+{
+    ::new (m_state) XXH3_state_t;
+    Reset(seed);
+}
+
+void Hasher::Reset(Uint64 seed) noexcept
+{
+    // The 64-bit and 128-bit variants share the same state and reset.
+    XXH3_64bits_reset_withSeed(GetXxh3State(m_state), seed);
+}
+
+void Hasher::Update(const void* data, std::size_t size) noexcept
+{
+    assert(data != nullptr || size == 0);
+    XXH3_64bits_update(GetXxh3State(m_state), data, size);
+}
+
+Uint64 Hasher::Digest64() const noexcept
+{
+    return XXH3_64bits_digest(GetXxh3State(m_state));
+}
+
+Hash128 Hasher::Digest128() const noexcept
+{
+    const XXH128_hash_t hash = XXH3_128bits_digest(GetXxh3State(m_state));
+    return {hash.low64, hash.high64};
+}
+
 } // namespace rad
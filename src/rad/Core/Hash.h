@@ -1,8 +1,15 @@
 #pragma once
 
 #include <rad/Core/Integer.h>
+#include <rad/Core/Span.h>
 
-#include <xxhash.h>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace rad
 {
@@ -25,4 +32,151 @@ inline uint64_t pcg_hash64(uint64_t v)
     return (word >> 43u) ^ word;
 }
 
+// Writes pcg_hash32(input[i] ^ seed) to output[i] with SIMD kernels selected by GetSimdLevel;
+// results are bit-identical to the scalar function. output must be as large as input and may be
+// the same array.
+void HashBatch(Span<const Uint32> input, Span<Uint32> output, Uint32 seed = 0) noexcept;
+// Writes pcg_hash64(input[i] ^ seed) to output[i]; see the 32-bit overload.
+void HashBatch(Span<const Uint64> input, Span<Uint64> output, Uint64 seed = 0) noexcept;
+
+struct Hash128
+{
+    Uint64 low;
+    Uint64 high;
+
+    [[nodiscard]] bool operator==(const Hash128&) const noexcept = default;
+};
+
+// One-shot XXH3 of a byte range.
+[[nodiscard]] Uint64 HashBytes64(const void* data, std::size_t size, Uint64 seed = 0) noexcept;
+[[nodiscard]] Hash128 HashBytes128(const void* data, std::size_t size, Uint64 seed = 0) noexcept;
+
+// Bijective 64-bit finalizer (SplitMix64) that spreads every input bit over the whole word.
+[[nodiscard]] constexpr Uint64 MixBits64(Uint64 value) noexcept
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// Folds hash into seed. Order-dependent, so combining a then b differs from b then a.
+[[nodiscard]] constexpr Uint64 HashCombine(Uint64 seed, Uint64 hash) noexcept
+{
+    return MixBits64((seed * 0x9E3779B97F4A7C15ull) ^ hash);
+}
+
+// Streaming XXH3 state. The 64-bit and 128-bit digests of the same input match HashBytes64 and
+// HashBytes128, so data may arrive in any number of pieces.
+class Hasher
+{
+public:
+    explicit Hasher(Uint64 seed = 0) noexcept;
+
+    void Reset(Uint64 seed = 0) noexcept;
+
+    void Update(const void* data, std::size_t size) noexcept;
+
+    void Update(std::string_view value) noexcept { Update(value.data(), value.size()); }
+
+    // Processes each element's raw representation; use serialized bytes for portable hashes.
+    template <std::ranges::contiguous_range R>
+        requires std::is_trivially_copyable_v<std::ranges::range_value_t<R>>
+    void Update(const R& values) noexcept
+    {
+        using Element = std::ranges::range_value_t<R>;
+        Update(std::ranges::data(values), std::ranges::size(values) * sizeof(Element));
+    }
+
+    // Processes the object's raw representation; padding and byte order are platform-dependent.
+    template <typename T>
+        requires std::is_trivially_copyable_v<std::remove_cvref_t<T>> &&
+                 (!std::is_pointer_v<std::remove_cvref_t<T>>) &&
+                 (!std::ranges::range<std::remove_cvref_t<T>>)
+    void Update(const T& value) noexcept
+    {
+        Update(&value, sizeof(value));
+    }
+
+    [[nodiscard]] Uint64 Digest64() const noexcept;
+    [[nodiscard]] Hash128 Digest128() const noexcept;
+
+private:
+    // Holds an XXH3_state_t, whose layout only Hash.cpp sees.
+    alignas(64) unsigned char m_state[576];
+}; // class Hasher
+
+namespace detail
+{
+
+// Types whose equal values always have equal bytes, so their bytes can be hashed directly.
+template <typename T>
+concept BytewiseHashable =
+    std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>;
+
+template <typename T>
+concept BytewiseHashableRange =
+    std::ranges::contiguous_range<T> && BytewiseHashable<std::ranges::range_value_t<T>>;
+
+} // namespace detail
+
+// Seeded hash functor for std::unordered_map and friends. Integers, enums and pointers are mixed
+// inline with a bijective finalizer, so distinct keys never collide before bucket reduction.
+// Floating-point values hash +0.0 and -0.0 alike. Strings, contiguous ranges of bytewise-hashable
+// elements (spans, vectors, arrays) and other types without padding hash their bytes with XXH3.
+template <typename T>
+struct Hash
+{
+    Uint64 seed = 0;
+
+    [[nodiscard]] std::size_t operator()(const T& value) const noexcept
+    {
+        if constexpr (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>)
+        {
+            static_assert(sizeof(T) <= sizeof(Uint64));
+            Uint64 bits = 0;
+            if constexpr (std::is_pointer_v<T>)
+            {
+                bits = reinterpret_cast<std::uintptr_t>(value);
+            }
+            else
+            {
+                bits = static_cast<Uint64>(value);
+            }
+            return static_cast<std::size_t>(MixBits64(bits + seed * 0x9E3779B97F4A7C15ull));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            const T normalized = (value == T(0)) ? T(0) : value;
+            return static_cast<std::size_t>(HashBytes64(&normalized, sizeof(normalized), seed));
+        }
+        else if constexpr (detail::BytewiseHashableRange<T>)
+        {
+            using Element = std::ranges::range_value_t<T>;
+            return static_cast<std::size_t>(HashBytes64(
+                std::ranges::data(value), std::ranges::size(value) * sizeof(Element), seed));
+        }
+        else
+        {
+            static_assert(detail::BytewiseHashable<T>,
+                          "rad::Hash needs a type whose equal values have equal bytes");
+            return static_cast<std::size_t>(HashBytes64(&value, sizeof(value), seed));
+        }
+    }
+}; // struct Hash
+
+// Transparent string hash: std::string, std::string_view and C strings with the same characters
+// hash alike, so lookups need no temporary std::string. Pair with std::equal_to<> for
+// heterogeneous lookup, e.g. std::unordered_map<std::string, V, StringHash, std::equal_to<>>.
+struct StringHash
+{
+    using is_transparent = void;
+
+    Uint64 seed = 0;
+
+    [[nodiscard]] std::size_t operator()(std::string_view value) const noexcept
+    {
+        return static_cast<std::size_t>(HashBytes64(value.data(), value.size(), seed));
+    }
+}; // struct StringHash
+
 } // namespace rad
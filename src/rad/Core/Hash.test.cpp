@@ -0,0 +1,157 @@
+#include <rad/Core/Hash.h>
+#include <rad/Core/Span.h>
+#include <rad/System/CpuInfo.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+TEST(Core, Hasher)
+{
+    std::vector<std::uint8_t> data(1000);
+    for (std::size_t index = 0; index < data.size(); ++index)
+    {
+        data[index] = static_cast<std::uint8_t>(index * 7);
+    }
+
+    for (const std::uint64_t seed : {0ull, 42ull})
+    {
+        const std::uint64_t expected64 = rad::HashBytes64(data.data(), data.size(), seed);
+        const rad::Hash128 expected128 = rad::HashBytes128(data.data(), data.size(), seed);
+        EXPECT_NE(expected64, rad::HashBytes64(data.data(), data.size(), seed + 1));
+
+        for (const std::size_t piece : {1, 13, 64, 240, 1000})
+        {
+            rad::Hasher hasher(seed);
+            for (std::size_t offset = 0; offset < data.size(); offset += piece)
+            {
+                hasher.Update(data.data() + offset, std::min(piece, data.size() - offset));
+            }
+            EXPECT_EQ(hasher.Digest64(), expected64) << piece;
+            EXPECT_EQ(hasher.Digest128(), expected128) << piece;
+        }
+    }
+
+    rad::Hasher hasher;
+    hasher.Update(std::string_view("abc"));
+    hasher.Update(std::uint32_t{7});
+    hasher.Update(std::vector<std::uint16_t>{1, 2});
+    const std::uint64_t digest = hasher.Digest64();
+    hasher.Reset();
+    EXPECT_EQ(hasher.Digest64(), rad::HashBytes64(nullptr, 0));
+    EXPECT_NE(digest, hasher.Digest64());
+}
+
+TEST(Core, HashFunctor)
+{
+    // Integer keys with only high or low bits set must still spread over the low bits that
+    // power-of-two tables index with.
+    std::set<std::size_t> lowBits;
+    for (std::uint64_t key = 0; key < 4096; ++key)
+    {
+        lowBits.insert(rad::Hash<std::uint64_t>{}(key << 32) & 0xFFF);
+    }
+    EXPECT_GT(lowBits.size(), 2000u);
+    EXPECT_NE(rad::Hash<int>{}(1), rad::Hash<int>{.seed = 1}(1));
+
+    enum class Color
+    {
+        Red,
+        Green,
+    };
+    EXPECT_NE(rad::Hash<Color>{}(Color::Red), rad::Hash<Color>{}(Color::Green));
+    EXPECT_EQ(rad::Hash<double>{}(0.0), rad::Hash<double>{}(-0.0));
+
+    const std::string text = "heterogeneous";
+    EXPECT_EQ(rad::Hash<std::string>{}(text), rad::Hash<std::string_view>{}(text));
+    EXPECT_EQ(rad::Hash<std::string>{}(text), rad::StringHash{}(text));
+
+    const std::vector<std::uint32_t> values = {1, 2, 3};
+    const std::array<std::uint32_t, 3> array = {1, 2, 3};
+    EXPECT_EQ(rad::Hash<std::vector<std::uint32_t>>{}(values),
+              rad::Hash<rad::Span<const std::uint32_t>>{}(array));
+
+    struct Key
+    {
+        std::uint32_t a;
+        std::uint32_t b;
+    };
+    EXPECT_NE(rad::Hash<Key>{}(Key{1, 2}), rad::Hash<Key>{}(Key{2, 1}));
+
+    EXPECT_NE(rad::HashCombine(rad::HashCombine(0, 1), 2),
+              rad::HashCombine(rad::HashCombine(0, 2), 1));
+}
+
+TEST(Core, StringHash)
+{
+    std::unordered_map<std::string, int, rad::StringHash, std::equal_to<>> map;
+    map.emplace("alpha", 1);
+    map.emplace("beta", 2);
+
+    // Lookups by string_view and C string do not construct a std::string.
+    EXPECT_EQ(map.find(std::string_view("alpha"))->second, 1);
+    EXPECT_EQ(map.find("beta")->second, 2);
+    EXPECT_EQ(map.find(std::string_view("gamma")), map.end());
+}
+
+TEST(Core, HashBatch)
+{
+    std::mt19937_64 random(7);
+    std::vector<std::uint32_t> keys32(1000);
+    std::vector<std::uint64_t> keys64(1000);
+    for (std::size_t index = 0; index < keys32.size(); ++index)
+    {
+        keys64[index] = random();
+        keys32[index] = static_cast<std::uint32_t>(keys64[index]);
+    }
+
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                       rad::SimdLevel::AVX2, rad::SimdLevel::AVX512,
+                                       rad::SimdLevel::NEON})
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        // Sizes around every vector width exercise the scalar tails.
+        for (std::size_t size = 0; size <= keys32.size(); size += (size < 40) ? 1 : 97)
+        {
+            for (const std::uint64_t seed : {0ull, 0x9E3779B97F4A7C15ull})
+            {
+                const auto seed32 = static_cast<std::uint32_t>(seed);
+                std::vector<std::uint32_t> hashes32(size);
+                rad::HashBatch(rad::Span<const std::uint32_t>(keys32.data(), size), hashes32,
+                               seed32);
+                std::vector<std::uint64_t> hashes64(size);
+                rad::HashBatch(rad::Span<const std::uint64_t>(keys64.data(), size), hashes64,
+                               seed);
+                for (std::size_t index = 0; index < size; ++index)
+                {
+                    ASSERT_EQ(hashes32[index], rad::pcg_hash32(keys32[index] ^ seed32))
+                        << "level " << static_cast<int>(level) << ", size " << size;
+                    ASSERT_EQ(hashes64[index], rad::pcg_hash64(keys64[index] ^ seed))
+                        << "level " << static_cast<int>(level) << ", size " << size;
+                }
+            }
+        }
+
+        // Hashing in place.
+        std::vector<std::uint64_t> inPlace = keys64;
+        rad::HashBatch(inPlace, inPlace);
+        for (std::size_t index = 0; index < inPlace.size(); ++index)
+        {
+            ASSERT_EQ(inPlace[index], rad::pcg_hash64(keys64[index]));
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
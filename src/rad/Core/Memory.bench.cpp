@@ -0,0 +1,153 @@
+#include <rad/Core/Memory.h>
+
+#include <benchmark/benchmark.h>
+#include <boost/stacktrace/stacktrace.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+
+// Reference design the sharded tracker replaced: one mutex guarding one node-based map.
+class MutexMapTracker
+{
+public:
+    void RecordAllocation(void* ptr, std::size_t size, rad::AllocationKind kind)
+    {
+        rad::AllocationRecord allocation;
+        allocation.address = ptr;
+        allocation.size = size;
+        allocation.kind = kind;
+        std::lock_guard lock(m_mutex);
+        m_allocations.emplace(ptr, std::move(allocation));
+        ++m_statistics.activeAllocationCount;
+        m_statistics.activeBytes += size;
+    }
+
+    void RecordDeallocation(const void* ptr, rad::AllocationKind kind)
+    {
+        std::lock_guard lock(m_mutex);
+        const auto iterator = m_allocations.find(ptr);
+        if ((iterator != m_allocations.end()) && (iterator->second.kind == kind))
+        {
+            --m_statistics.activeAllocationCount;
+            m_statistics.activeBytes -= iterator->second.size;
+            m_allocations.erase(iterator);
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<const void*, rad::AllocationRecord> m_allocations;
+    rad::MemoryStatistics m_statistics;
+}; // class MutexMapTracker
+
+constexpr std::size_t BatchSize = 256;
+constexpr std::size_t BlockSize = 64;
+
+template <typename Tracker>
+void RecordBatch(benchmark::State& state, Tracker& tracker)
+{
+    // Each thread records distinct addresses inside its own buffer; nothing is dereferenced.
+    std::vector<std::byte> block(BatchSize * BlockSize);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < BatchSize; ++i)
+        {
+            tracker.RecordAllocation(block.data() + i * BlockSize, BlockSize,
+                                     rad::AllocationKind::Raw);
+        }
+        for (std::size_t i = 0; i < BatchSize; ++i)
+        {
+            tracker.RecordDeallocation(block.data() + i * BlockSize, rad::AllocationKind::Raw);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BatchSize));
+}
+
+void BM_MemoryTrackerSharded(benchmark::State& state)
+{
+    static rad::MemoryTracker tracker;
+    tracker.SetStackTraceDepth(0);
+    RecordBatch(state, tracker);
+}
+
+void BM_MemoryTrackerMutexMap(benchmark::State& state)
+{
+    static MutexMapTracker tracker;
+    RecordBatch(state, tracker);
+}
+
+// Records allocations with stack capture; frames are interned and symbolized only on demand.
+void BM_MemoryTrackerStackTrace(benchmark::State& state)
+{
+    static rad::MemoryTracker tracker;
+    tracker.SetStackTraceDepth(static_cast<std::size_t>(state.range(0)));
+    RecordBatch(state, tracker);
+}
+
+// Records with 16-frame stacks; a non-zero argument samples one allocation per that many bytes.
+void BM_MemoryTrackerSampled(benchmark::State& state)
+{
+    rad::MemoryTracker tracker;
+    tracker.SetStackTraceDepth(16);
+    tracker.SetSamplingInterval(static_cast<std::size_t>(state.range(0)));
+    RecordBatch(state, tracker);
+}
+
+// Random 8-byte reads over a 256 MiB buffer, where TLB reach dominates; argument 1 requests huge
+// pages.
+void BM_AllocateLargeRandomRead(benchmark::State& state)
+{
+    constexpr std::size_t Size = 256 * 1024 * 1024;
+    rad::LargeAllocationOptions options;
+    options.hugePages = state.range(0) != 0;
+    options.populate = true;
+    const rad::LargeAllocation allocation = rad::AllocateLarge(Size, options);
+    if (allocation.data == nullptr)
+    {
+        state.SkipWithError("AllocateLarge failed");
+        return;
+    }
+    const auto* words = static_cast<const std::uint64_t*>(allocation.data);
+    constexpr std::size_t WordMask = Size / sizeof(std::uint64_t) - 1;
+    std::uint64_t index = 1;
+    std::uint64_t sum = 0;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < 1024; ++i)
+        {
+            index = index * 6364136223846793005ull + 1442695040888963407ull;
+            sum += words[(index >> 20) & WordMask];
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 1024);
+    state.SetLabel(allocation.backing == rad::LargePageBacking::Normal ? "normal" : "huge");
+    rad::FreeLarge(allocation);
+}
+
+// Cost the tracker used to pay per allocation: capture and symbolize eagerly.
+void BM_EagerStackTraceSymbolization(benchmark::State& state)
+{
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::string text = boost::stacktrace::to_string(boost::stacktrace::stacktrace(0, depth));
+        benchmark::DoNotOptimize(text);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_MemoryTrackerSharded)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_MemoryTrackerMutexMap)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_MemoryTrackerStackTrace)->Arg(0)->Arg(16)->Arg(64);
+BENCHMARK(BM_MemoryTrackerSampled)->Arg(0)->Arg(64 * 1024)->Arg(512 * 1024);
+BENCHMARK(BM_AllocateLargeRandomRead)->Arg(0)->Arg(1);
+BENCHMARK(BM_EagerStackTraceSymbolization)->Arg(16)->Arg(64);
@@ -1,75 +1,510 @@
 #include <rad/Core/Memory.h>
 
+#include <rad/Core/Hash.h>
 #include <rad/Core/Integer.h>
 #include <rad/Core/Platform.h>
 
+#include <boost/stacktrace/safe_dump_to.hpp>
 #include <boost/stacktrace/stacktrace.hpp>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #if defined(RAD_OS_WINDOWS)
 #include <malloc.h>
 #endif
 
+#if defined(RAD_OS_LINUX)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace
 {
 
+constexpr std::size_t InvalidSlot = std::numeric_limits<std::size_t>::max();
+constexpr std::size_t MinimumSlotCount = 16;
+
+[[nodiscard]] std::uint64_t HashAddress(const void* ptr) noexcept
+{
+    return rad::pcg_hash64(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr)));
+}
+
 #if RAD_ENABLE_MEMORY_TRACKING
 
-[[nodiscard]] rad::AllocationRecord MakeAllocationRecord(void* ptr, std::size_t size,
-                                                         rad::AllocationKind kind,
-                                                         std::source_location location,
-                                                         std::size_t stackTraceDepth)
+// Only stores when value is a new maximum, so the common case is a load of a shared line.
+void UpdateMaximum(std::atomic<std::size_t>& maximum, std::size_t value) noexcept
+{
+    std::size_t current = maximum.load(std::memory_order_relaxed);
+    while ((current < value) &&
+           !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+// Bytes left before the calling thread records its next sampled allocation. Shared by every
+// tracker, which only matters for tests that run several trackers with sampling at once.
+thread_local std::int64_t t_bytesUntilSample = 0;
+thread_local bool t_samplerSeeded = false;
+thread_local std::uint64_t t_samplerState = 0;
+
+// Draws the gap to the next sample from an exponential distribution with the given mean, which
+// makes the chance of sampling an allocation 1 - exp(-size / mean) regardless of history.
+[[nodiscard]] std::int64_t NextSampleDistance(std::size_t meanBytes) noexcept
+{
+    if (t_samplerState == 0)
+    {
+        t_samplerState = HashAddress(&t_samplerState) | 1;
+    }
+    t_samplerState += 0x9E3779B97F4A7C15ull;
+    // 53 random bits mapped to (0, 1].
+    const double uniform =
+        static_cast<double>((rad::pcg_hash64(t_samplerState) >> 11) + 1) * 0x1.0p-53;
+    const double distance = -std::log(uniform) * static_cast<double>(meanBytes);
+    return static_cast<std::int64_t>(std::clamp(distance, 1.0, 0x1.0p62));
+}
+
+RAD_NOINLINE bool SampleSlow(std::size_t meanBytes) noexcept
+{
+    if (!t_samplerSeeded)
+    {
+        // Start each thread at a random point instead of sampling its first allocation.
+        t_samplerSeeded = true;
+        t_bytesUntilSample += NextSampleDistance(meanBytes);
+        if (t_bytesUntilSample > 0)
+        {
+            return false;
+        }
+    }
+    t_bytesUntilSample = NextSampleDistance(meanBytes);
+    return true;
+}
+
+// The fast path is a single thread-local decrement and compare.
+[[nodiscard]] inline bool ShouldSample(std::size_t size, std::size_t meanBytes) noexcept
+{
+    t_bytesUntilSample -= static_cast<std::int64_t>(size);
+    if (t_bytesUntilSample > 0) [[likely]]
+    {
+        return false;
+    }
+    return SampleSlow(meanBytes);
+}
+
+// Number of allocations of this size that one sample stands for.
+[[nodiscard]] double SampleWeight(std::size_t size, std::size_t meanBytes) noexcept
 {
-    rad::AllocationRecord allocation;
-    allocation.address = ptr;
-    allocation.size = size;
-    allocation.kind = kind;
-    allocation.location = location;
-    if (stackTraceDepth != 0)
+    if (meanBytes == 0 || size == 0)
+    {
+        return 1.0;
+    }
+    return 1.0 / -std::expm1(-static_cast<double>(size) / static_cast<double>(meanBytes));
+}
+
+#endif // RAD_ENABLE_MEMORY_TRACKING
+
+#if defined(RAD_OS_LINUX)
+
+// Returns the PMD-sized transparent huge page size, or zero when THP is unavailable or disabled.
+[[nodiscard]] std::size_t TransparentHugePageSize() noexcept
+{
+    static const std::size_t pageSize = []() noexcept -> std::size_t
     {
         try
         {
-#if defined(RAD_OS_WINDOWS)
-            constexpr std::size_t skipFrames = 4;
-#else
-            constexpr std::size_t skipFrames = 2;
-#endif
-            allocation.stackTrace = boost::stacktrace::to_string(
-                boost::stacktrace::stacktrace(skipFrames, stackTraceDepth));
+            std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+            std::string modes;
+            if (!std::getline(enabled, modes) || modes.find("[never]") != std::string::npos)
+            {
+                return 0;
+            }
+            std::ifstream pmdSize("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+            std::size_t bytes = 0;
+            return (pmdSize >> bytes) ? bytes : 0;
         }
         catch (...)
         {
+            return 0;
+        }
+    }();
+    return pageSize;
+}
+
+// Returns the default hugetlbfs page size, or zero if the kernel does not report one.
+[[nodiscard]] std::size_t ExplicitHugePageSize() noexcept
+{
+    static const std::size_t pageSize = []() noexcept -> std::size_t
+    {
+        try
+        {
+            std::ifstream meminfo("/proc/meminfo");
+            std::string line;
+            while (std::getline(meminfo, line))
+            {
+                if (line.starts_with("Hugepagesize:"))
+                {
+                    return std::strtoull(line.c_str() + 13, nullptr, 10) * 1024;
+                }
+            }
+        }
+        catch (...)
+        {
+        }
+        return 0;
+    }();
+    return pageSize;
+}
+
+// Reports whether the mapping starting at data is backed by any transparent huge pages.
+[[nodiscard]] bool HasAnonHugePages(const void* data) noexcept
+{
+    try
+    {
+        char start[32];
+        std::snprintf(start, sizeof(start), "%lx-", reinterpret_cast<unsigned long>(data));
+        std::ifstream smaps("/proc/self/smaps");
+        std::string line;
+        bool inMapping = false;
+        while (std::getline(smaps, line))
+        {
+            if (!inMapping)
+            {
+                inMapping = line.starts_with(start);
+            }
+            else if (line.starts_with("AnonHugePages:"))
+            {
+                return std::strtoull(line.c_str() + 14, nullptr, 10) != 0;
+            }
         }
     }
-    return allocation;
+    catch (...)
+    {
+    }
+    return false;
 }
 
-void UpdatePeaks(rad::MemoryStatistics& statistics) noexcept
+[[nodiscard]] void* MapAnonymous(std::size_t size, int extraFlags) noexcept
 {
-    statistics.peakAllocationCount =
-        std::max(statistics.peakAllocationCount, statistics.activeAllocationCount);
-    statistics.peakBytes = std::max(statistics.peakBytes, statistics.activeBytes);
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | extraFlags, -1, 0);
+    return (data != MAP_FAILED) ? data : nullptr;
 }
 
-#endif // RAD_ENABLE_MEMORY_TRACKING
+// Over-maps and trims so that the mapping starts on an alignment boundary, which THP needs.
+[[nodiscard]] void* MapAnonymousAligned(std::size_t size, std::size_t alignment) noexcept
+{
+    std::byte* raw = static_cast<std::byte*>(MapAnonymous(size + alignment, 0));
+    if (raw == nullptr)
+    {
+        return nullptr;
+    }
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw);
+    std::byte* aligned = raw + (rad::AlignUpToPowerOfTwo(address, alignment) - address);
+    if (aligned != raw)
+    {
+        munmap(raw, static_cast<std::size_t>(aligned - raw));
+    }
+    const std::size_t tail = static_cast<std::size_t>(raw + size + alignment - (aligned + size));
+    if (tail != 0)
+    {
+        munmap(aligned + size, tail);
+    }
+    return aligned;
+}
+
+[[nodiscard]] bool BindToNumaNode(void* data, std::size_t size, int node) noexcept
+{
+    // mbind through the raw syscall so that libnuma is not required.
+    constexpr std::size_t MaskBits = 1024;
+    constexpr std::size_t WordBits = sizeof(unsigned long) * 8;
+    if (node < 0 || static_cast<std::size_t>(node) >= MaskBits)
+    {
+        return false;
+    }
+    std::array<unsigned long, MaskBits / WordBits> mask = {};
+    const std::size_t bit = static_cast<std::size_t>(node);
+    mask[bit / WordBits] |= 1ul << (bit % WordBits);
+    return syscall(SYS_mbind, data, size, MPOL_BIND, mask.data(), MaskBits + 1, 0) == 0;
+}
+
+void Prefault(void* data, std::size_t size, std::size_t pageSize) noexcept
+{
+#if defined(MADV_POPULATE_WRITE)
+    if (madvise(data, size, MADV_POPULATE_WRITE) == 0)
+    {
+        return;
+    }
+#endif
+    // Older kernels: touch one byte per page. Anonymous pages are already zero.
+    for (std::size_t offset = 0; offset < size; offset += pageSize)
+    {
+        static_cast<volatile std::byte*>(data)[offset] = std::byte{0};
+    }
+}
+
+#endif // defined(RAD_OS_LINUX)
 
 } // namespace
 
 namespace rad
 {
 
+// Each shard is an open-addressing table (linear probing, backward-shift deletion) keyed by
+// address. A null address marks an empty slot; the capacity is zero or a power of two and the
+// load factor is kept at or below one half.
+struct alignas(64) MemoryTracker::Shard
+{
+    struct Entry
+    {
+        const void* address = nullptr;
+        std::size_t size = 0;
+        AllocationKind kind = AllocationKind::Unknown;
+        std::source_location location;
+        std::uint32_t stackTraceId = 0;
+        std::size_t samplingInterval = 0;
+    };
+
+    std::mutex mutex;
+    std::vector<Entry> slots;
+    std::size_t size = 0;
+    std::atomic<std::size_t> totalAllocationCount = 0;
+    std::atomic<std::size_t> totalAllocatedBytes = 0;
+
+    [[nodiscard]] std::size_t Find(const void* ptr, std::uint64_t hash) const noexcept
+    {
+        if (slots.empty())
+        {
+            return InvalidSlot;
+        }
+
+        const std::size_t mask = slots.size() - 1;
+        for (std::size_t index = hash & mask;; index = (index + 1) & mask)
+        {
+            if (slots[index].address == ptr)
+            {
+                return index;
+            }
+            if (slots[index].address == nullptr)
+            {
+                return InvalidSlot;
+            }
+        }
+    }
+
+    // Finds the allocation containing ptr when ptr is not its start address.
+    [[nodiscard]] std::size_t FindContaining(const void* ptr) const noexcept
+    {
+        for (std::size_t index = 0; index < slots.size(); ++index)
+        {
+            const Entry& entry = slots[index];
+            if (entry.address == nullptr)
+            {
+                continue;
+            }
+            const std::ptrdiff_t offset = PointerDiff(entry.address, ptr);
+            if (offset >= 0 && static_cast<std::size_t>(offset) < entry.size)
+            {
+                return index;
+            }
+        }
+        return InvalidSlot;
+    }
+
+    // entry.address must not be tracked yet.
+    void Insert(Entry&& entry)
+    {
+        if ((size + 1) * 2 > slots.size())
+        {
+            std::vector<Entry> grown(std::max(MinimumSlotCount, slots.size() * 2));
+            for (Entry& existing : slots)
+            {
+                if (existing.address != nullptr)
+                {
+                    Place(grown, std::move(existing));
+                }
+            }
+            slots.swap(grown);
+        }
+        Place(slots, std::move(entry));
+        ++size;
+    }
+
+    // Shifts later members of the probe run back so lookups never need tombstones.
+    void Erase(std::size_t index) noexcept
+    {
+        const std::size_t mask = slots.size() - 1;
+        std::size_t hole = index;
+        for (std::size_t next = (hole + 1) & mask; slots[next].address != nullptr;
+             next = (next + 1) & mask)
+        {
+            const std::size_t home = HashAddress(slots[next].address) & mask;
+            // Move next into the hole unless its home lies cyclically in (hole, next].
+            const bool homeAfterHole = ((next - home) & mask) < ((next - hole) & mask);
+            if (!homeAfterHole)
+            {
+                slots[hole] = slots[next];
+                hole = next;
+            }
+        }
+        slots[hole] = Entry{};
+        --size;
+    }
+
+    static void Place(std::vector<Entry>& table, Entry&& entry) noexcept
+    {
+        const std::size_t mask = table.size() - 1;
+        std::size_t index = HashAddress(entry.address) & mask;
+        while (table[index].address != nullptr)
+        {
+            index = (index + 1) & mask;
+        }
+        table[index] = entry;
+    }
+};
+
+// Interns raw call stacks so identical stacks are stored once. Ids encode the shard in their low
+// bits and a one-based index in the rest, keeping zero free to mean "no stack trace".
+struct MemoryTracker::StackTraceTable
+{
+    static constexpr std::size_t ShardBits = 4;
+    static constexpr std::size_t ShardCount = std::size_t{1} << ShardBits;
+    static_assert(MaxStackTraceCount % ShardCount == 0);
+
+    struct Entry
+    {
+        std::vector<const void*> frames;
+        std::optional<std::string> symbolized;
+    };
+
+    struct alignas(64) Shard
+    {
+        std::mutex mutex;
+        std::deque<Entry> entries;
+        std::unordered_multimap<std::uint64_t, std::uint32_t> indices;
+    };
+
+    std::array<Shard, ShardCount> shards;
+    std::atomic<std::size_t> count = 0;
+
+    [[nodiscard]] std::uint32_t Intern(std::span<const void* const> frames)
+    {
+        const std::uint64_t hash = HashBytes64(frames.data(), frames.size_bytes());
+        const std::size_t shardIndex = static_cast<std::size_t>(hash >> (64 - ShardBits));
+        Shard& shard = shards[shardIndex];
+
+        std::lock_guard lock(shard.mutex);
+        const auto [first, last] = shard.indices.equal_range(hash);
+        for (auto iterator = first; iterator != last; ++iterator)
+        {
+            if (std::ranges::equal(shard.entries[iterator->second].frames, frames))
+            {
+                return MakeId(shardIndex, iterator->second);
+            }
+        }
+
+        // Each shard takes an equal part of the cap, which also keeps ids within 32 bits.
+        const std::size_t index = shard.entries.size();
+        if (index >= MaxStackTraceCount / ShardCount)
+        {
+            return 0;
+        }
+        shard.entries.push_back(Entry{{frames.begin(), frames.end()}, std::nullopt});
+        shard.indices.emplace(hash, static_cast<std::uint32_t>(index));
+        count.fetch_add(1, std::memory_order_relaxed);
+        return MakeId(shardIndex, index);
+    }
+
+    [[nodiscard]] std::string Symbolize(std::uint32_t id)
+    {
+        if (id == 0)
+        {
+            return {};
+        }
+
+        Shard& shard = shards[id & (ShardCount - 1)];
+        const std::size_t index = (id >> ShardBits) - 1;
+        std::vector<const void*> frames;
+        {
+            std::lock_guard lock(shard.mutex);
+            if (index >= shard.entries.size())
+            {
+                return {};
+            }
+            const Entry& entry = shard.entries[index];
+            if (entry.symbolized)
+            {
+                return *entry.symbolized;
+            }
+            frames = entry.frames;
+        }
+
+        // Symbolization can be slow; do not hold the lock while resolving names.
+        frames.push_back(nullptr);
+        std::string text = boost::stacktrace::to_string(boost::stacktrace::stacktrace::from_dump(
+            frames.data(), frames.size() * sizeof(const void*)));
+
+        std::lock_guard lock(shard.mutex);
+        shard.entries[index].symbolized = text;
+        return text;
+    }
+
+    // Returns the raw frames for an id, innermost first.
+    [[nodiscard]] std::vector<const void*> Frames(std::uint32_t id)
+    {
+        if (id == 0)
+        {
+            return {};
+        }
+
+        Shard& shard = shards[id & (ShardCount - 1)];
+        const std::size_t index = (id >> ShardBits) - 1;
+        std::lock_guard lock(shard.mutex);
+        if (index >= shard.entries.size())
+        {
+            return {};
+        }
+        return shard.entries[index].frames;
+    }
+
+    [[nodiscard]] static std::uint32_t MakeId(std::size_t shardIndex, std::size_t index) noexcept
+    {
+        return static_cast<std::uint32_t>(((index + 1) << ShardBits) | shardIndex);
+    }
+};
+
 MemoryTracker& GetGlobalMemoryTracker() noexcept
 {
     static MemoryTracker tracker;
     return tracker;
 }
 
+MemoryTracker::MemoryTracker() :
+    m_shards(std::make_unique<Shard[]>(ShardCount)),
+    m_stackTraces(std::make_unique<StackTraceTable>())
+{
+}
+
+MemoryTracker::~MemoryTracker() = default;
+
 void MemoryTracker::SetStackTraceDepth(std::size_t depth) noexcept
 {
-    m_stackTraceDepth.store(depth, std::memory_order_relaxed);
+    m_stackTraceDepth.store(std::min(depth, MaxStackTraceDepth), std::memory_order_relaxed);
 }
 
 std::size_t MemoryTracker::StackTraceDepth() const noexcept
@@ -77,6 +512,83 @@ std::size_t MemoryTracker::StackTraceDepth() const noexcept
     return m_stackTraceDepth.load(std::memory_order_relaxed);
 }
 
+void MemoryTracker::SetSamplingInterval(std::size_t meanBytes) noexcept
+{
+    if (meanBytes != 0)
+    {
+        m_samplingEverEnabled.store(true, std::memory_order_relaxed);
+    }
+    m_samplingInterval.store(meanBytes, std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::SamplingInterval() const noexcept
+{
+    return m_samplingInterval.load(std::memory_order_relaxed);
+}
+
+MemoryTracker::Shard& MemoryTracker::GetShard(std::uint64_t hash) const noexcept
+{
+    // The slot index uses the low hash bits, so select the shard from the high bits.
+    constexpr int shardBits = std::countr_zero(ShardCount);
+    static_assert(std::has_single_bit(ShardCount));
+    return m_shards[static_cast<std::size_t>(hash >> (64 - shardBits))];
+}
+
+// Must not be inlined: the skip count below assumes this frame and RecordAllocation's.
+RAD_NOINLINE std::uint32_t MemoryTracker::CaptureStackTrace() noexcept
+{
+    const std::size_t depth = StackTraceDepth();
+    if (depth == 0)
+    {
+        return 0;
+    }
+
+#if defined(RAD_OS_WINDOWS)
+    constexpr std::size_t skipFrames = 4;
+#else
+    constexpr std::size_t skipFrames = 2;
+#endif
+    // Only raw return addresses are captured here, into an inline buffer with room for the
+    // terminating null frame that safe_dump_to appends.
+    std::array<const void*, MaxStackTraceDepth + 1> frames = {};
+    const std::size_t stored =
+        boost::stacktrace::safe_dump_to(skipFrames, frames.data(), (depth + 1) * sizeof(void*));
+    const std::size_t frameCount = stored != 0 ? stored - 1 : 0;
+    if (frameCount == 0)
+    {
+        return 0;
+    }
+
+    try
+    {
+        return m_stackTraces->Intern(std::span<const void* const>(frames.data(), frameCount));
+    }
+    catch (...)
+    {
+        return 0;
+    }
+}
+
+void MemoryTracker::AddActive(std::size_t bytes) noexcept
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    const std::size_t activeCount =
+        m_activeAllocationCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    const std::size_t activeBytes =
+        m_activeBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    UpdateMaximum(m_peakAllocationCount, activeCount);
+    UpdateMaximum(m_peakBytes, activeBytes);
+#else
+    static_cast<void>(bytes);
+#endif
+}
+
+void MemoryTracker::SubtractActive(std::size_t bytes) noexcept
+{
+    m_activeAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    m_activeBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
 void MemoryTracker::RecordAllocation(void* ptr, std::size_t size, AllocationKind kind,
                                      std::source_location location) noexcept
 {
@@ -86,25 +598,30 @@ void MemoryTracker::RecordAllocation(void* ptr, std::size_t size, AllocationKind
         return;
     }
 
+    const std::size_t samplingInterval = m_samplingInterval.load(std::memory_order_relaxed);
+    if (samplingInterval != 0 && !ShouldSample(size, samplingInterval))
+    {
+        return;
+    }
+
     try
     {
-        AllocationRecord allocation =
-            MakeAllocationRecord(ptr, size, kind, location, StackTraceDepth());
+        const std::uint32_t stackTraceId = CaptureStackTrace();
 
-        std::lock_guard lock(m_mutex);
-        const auto [iterator, inserted] = m_allocations.emplace(ptr, std::move(allocation));
-        static_cast<void>(iterator);
+        const std::uint64_t hash = HashAddress(ptr);
+        Shard& shard = GetShard(hash);
+        std::lock_guard lock(shard.mutex);
+        const bool inserted = shard.Find(ptr, hash) == InvalidSlot;
         assert(inserted && "MemoryTracker failed to record allocation");
         if (!inserted)
         {
             return;
         }
 
-        ++m_statistics.activeAllocationCount;
-        m_statistics.activeBytes += size;
-        ++m_statistics.totalAllocationCount;
-        m_statistics.totalAllocatedBytes += size;
-        UpdatePeaks(m_statistics);
+        shard.Insert(Shard::Entry{ptr, size, kind, location, stackTraceId, samplingInterval});
+        shard.totalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        shard.totalAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        AddActive(size);
     }
     catch (...)
     {
@@ -125,53 +642,55 @@ void MemoryTracker::RecordDeallocation(const void* ptr, AllocationKind kind) noe
     {
         return;
     }
-    try
-    {
-        std::lock_guard lock(m_mutex);
 
-        auto iterator = m_allocations.find(ptr);
-        // Object deletes may pass an adjusted base pointer; raw frees must match exactly.
-        if (iterator == m_allocations.end() &&
-            (kind == AllocationKind::Object || kind == AllocationKind::ObjectArray))
-        {
-            iterator = m_allocations.upper_bound(ptr);
-            if (iterator == m_allocations.begin())
-            {
-                iterator = m_allocations.end();
-            }
-            else
-            {
-                --iterator;
-                const void* allocationAddress = iterator->first;
-                const std::ptrdiff_t offset = PointerDiff(allocationAddress, ptr);
-                if (offset < 0 || static_cast<std::size_t>(offset) >= iterator->second.size)
-                {
-                    iterator = m_allocations.end();
-                }
-            }
-        }
-
-        assert(iterator != m_allocations.end() &&
-               "Deallocation of a pointer not tracked by MemoryTracker");
-        if (iterator == m_allocations.end())
+    const auto eraseLocked = [&](Shard& shard, std::size_t index)
+    {
+        const Shard::Entry& entry = shard.slots[index];
+        assert(entry.kind == kind && "AllocationKind mismatch on deallocation");
+        if (entry.kind != kind)
         {
             return;
         }
+        SubtractActive(entry.size);
+        shard.Erase(index);
+    };
 
-        assert(iterator->second.kind == kind && "AllocationKind mismatch on deallocation");
-        if (iterator->second.kind != kind)
+    const std::uint64_t hash = HashAddress(ptr);
+    {
+        Shard& shard = GetShard(hash);
+        std::lock_guard lock(shard.mutex);
+        const std::size_t index = shard.Find(ptr, hash);
+        if (index != InvalidSlot)
         {
+            eraseLocked(shard, index);
             return;
         }
+    }
 
-        --m_statistics.activeAllocationCount;
-        m_statistics.activeBytes -= iterator->second.size;
-        m_allocations.erase(iterator);
+    // Most pointers are never recorded while sampling, so a miss is expected and is not worth
+    // the interior-pointer scan below.
+    if (m_samplingEverEnabled.load(std::memory_order_relaxed))
+    {
+        return;
     }
-    catch (...)
+
+    // Object deletes may pass an adjusted base pointer; raw frees must match exactly.
+    if ((kind == AllocationKind::Object) || (kind == AllocationKind::ObjectArray))
     {
-        assert(false && "MemoryTracker failed to record deallocation");
+        for (std::size_t shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
+        {
+            Shard& shard = m_shards[shardIndex];
+            std::lock_guard lock(shard.mutex);
+            const std::size_t index = shard.FindContaining(ptr);
+            if (index != InvalidSlot)
+            {
+                eraseLocked(shard, index);
+                return;
+            }
+        }
     }
+
+    assert(false && "Deallocation of a pointer not tracked by MemoryTracker");
 #else
     static_cast<void>(ptr);
     static_cast<void>(kind);
@@ -187,81 +706,66 @@ void MemoryTracker::RecordReallocation(void* oldPtr, void* newPtr, std::size_t n
         return;
     }
 
+    // oldPtr must be nullptr (malloc-style) or already tracked. While sampling, the old block may
+    // not have been recorded and the new one is sampled afresh.
+    if (oldPtr == nullptr || m_samplingEverEnabled.load(std::memory_order_relaxed))
+    {
+        RecordDeallocation(oldPtr, kind);
+        RecordAllocation(newPtr, newSize, kind, location);
+        return;
+    }
+
     try
     {
-        AllocationRecord allocation =
-            MakeAllocationRecord(newPtr, newSize, kind, location, StackTraceDepth());
-        std::lock_guard lock(m_mutex);
+        const std::uint32_t stackTraceId = CaptureStackTrace();
 
-        // oldPtr must be nullptr (malloc-style) or already tracked.
-        if (oldPtr == nullptr)
+        // The old and new addresses may hash to different shards. Remove the old entry first; no
+        // other thread may legitimately use either pointer until realloc returns.
+        std::size_t oldSize = 0;
         {
-            const auto [iterator, inserted] = m_allocations.emplace(newPtr, std::move(allocation));
-            static_cast<void>(iterator);
-            assert(inserted && "MemoryTracker failed to record reallocation");
-            if (!inserted)
+            const std::uint64_t oldHash = HashAddress(oldPtr);
+            Shard& oldShard = GetShard(oldHash);
+            std::lock_guard lock(oldShard.mutex);
+            const std::size_t oldIndex = oldShard.Find(oldPtr, oldHash);
+            assert(oldIndex != InvalidSlot && "realloc of a pointer not tracked by MemoryTracker");
+            if (oldIndex == InvalidSlot)
             {
                 return;
             }
 
-            ++m_statistics.activeAllocationCount;
-            m_statistics.activeBytes += newSize;
-            ++m_statistics.totalAllocationCount;
-            m_statistics.totalAllocatedBytes += newSize;
-            UpdatePeaks(m_statistics);
-            return;
-        }
-
-        auto oldIterator = m_allocations.find(oldPtr);
-        assert(oldIterator != m_allocations.end() &&
-               "realloc of a pointer not tracked by MemoryTracker");
-        if (oldIterator == m_allocations.end())
-        {
-            return;
-        }
+            assert(oldShard.slots[oldIndex].kind == kind &&
+                   "AllocationKind mismatch on reallocation");
+            if (oldShard.slots[oldIndex].kind != kind)
+            {
+                return;
+            }
 
-        assert(oldIterator->second.kind == kind && "AllocationKind mismatch on reallocation");
-        if (oldIterator->second.kind != kind)
-        {
-            return;
+            oldSize = oldShard.slots[oldIndex].size;
+            oldShard.Erase(oldIndex);
+            SubtractActive(oldSize);
         }
 
-        const std::size_t oldSize = oldIterator->second.size;
-        if (newPtr == oldPtr)
+        const std::uint64_t newHash = HashAddress(newPtr);
+        Shard& newShard = GetShard(newHash);
+        std::lock_guard lock(newShard.mutex);
+        Shard::Entry entry{newPtr, newSize, kind, location, stackTraceId};
+        const std::size_t newIndex = newShard.Find(newPtr, newHash);
+        if (newIndex != InvalidSlot)
         {
-            oldIterator->second = std::move(allocation);
+            assert(false && "realloc moved onto an address still tracked (missed free?)");
+            SubtractActive(newShard.slots[newIndex].size);
+            newShard.slots[newIndex] = entry;
         }
         else
         {
-            m_allocations.erase(oldIterator);
-
-            auto newIterator = m_allocations.find(newPtr);
-            if (newIterator != m_allocations.end())
-            {
-                assert(false && "realloc moved onto an address still tracked (missed free?)");
-                m_statistics.activeBytes -= newIterator->second.size;
-                --m_statistics.activeAllocationCount;
-                newIterator->second = std::move(allocation);
-            }
-            else
-            {
-                const auto [iterator, inserted] =
-                    m_allocations.emplace(newPtr, std::move(allocation));
-                static_cast<void>(iterator);
-                assert(inserted && "MemoryTracker failed to record reallocation");
-                if (!inserted)
-                {
-                    return;
-                }
-            }
+            newShard.Insert(std::move(entry));
         }
 
-        m_statistics.activeBytes = m_statistics.activeBytes - oldSize + newSize;
         if (newSize > oldSize)
         {
-            m_statistics.totalAllocatedBytes += newSize - oldSize;
+            newShard.totalAllocatedBytes.fetch_add(newSize - oldSize, std::memory_order_relaxed);
         }
-        UpdatePeaks(m_statistics);
+        AddActive(newSize);
     }
     catch (...)
     {
@@ -276,11 +780,44 @@ void MemoryTracker::RecordReallocation(void* oldPtr, void* newPtr, std::size_t n
 #endif
 }
 
+void MemoryTracker::RecordArenaChunkAllocation(std::size_t size) noexcept
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    m_arenaChunkCount.fetch_add(1, std::memory_order_relaxed);
+    m_arenaChunkBytes.fetch_add(size, std::memory_order_relaxed);
+#else
+    static_cast<void>(size);
+#endif
+}
+
+void MemoryTracker::RecordArenaChunkDeallocation(std::size_t size) noexcept
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    m_arenaChunkCount.fetch_sub(1, std::memory_order_relaxed);
+    m_arenaChunkBytes.fetch_sub(size, std::memory_order_relaxed);
+#else
+    static_cast<void>(size);
+#endif
+}
+
 MemoryStatistics MemoryTracker::Statistics() const noexcept
 {
 #if RAD_ENABLE_MEMORY_TRACKING
-    std::lock_guard lock(m_mutex);
-    return m_statistics;
+    MemoryStatistics statistics;
+    statistics.activeAllocationCount = m_activeAllocationCount.load(std::memory_order_relaxed);
+    statistics.activeBytes = m_activeBytes.load(std::memory_order_relaxed);
+    statistics.peakAllocationCount = m_peakAllocationCount.load(std::memory_order_relaxed);
+    statistics.peakBytes = m_peakBytes.load(std::memory_order_relaxed);
+    statistics.arenaChunkCount = m_arenaChunkCount.load(std::memory_order_relaxed);
+    statistics.arenaChunkBytes = m_arenaChunkBytes.load(std::memory_order_relaxed);
+    for (std::size_t shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
+    {
+        const Shard& shard = m_shards[shardIndex];
+        statistics.totalAllocationCount +=
+            shard.totalAllocationCount.load(std::memory_order_relaxed);
+        statistics.totalAllocatedBytes += shard.totalAllocatedBytes.load(std::memory_order_relaxed);
+    }
+    return statistics;
 #else
     return {};
 #endif
@@ -288,12 +825,155 @@ MemoryStatistics MemoryTracker::Statistics() const noexcept
 
 std::map<const void*, AllocationRecord> MemoryTracker::ActiveAllocations() const
 {
+    std::map<const void*, AllocationRecord> allocations;
 #if RAD_ENABLE_MEMORY_TRACKING
-    std::lock_guard lock(m_mutex);
-    return m_allocations;
-#else
-    return {};
+    for (std::size_t shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
+    {
+        Shard& shard = m_shards[shardIndex];
+        std::lock_guard lock(shard.mutex);
+        for (const Shard::Entry& entry : shard.slots)
+        {
+            if (entry.address != nullptr)
+            {
+                AllocationRecord allocation;
+                allocation.address = entry.address;
+                allocation.size = entry.size;
+                allocation.kind = entry.kind;
+                allocation.location = entry.location;
+                allocation.stackTraceId = entry.stackTraceId;
+                allocation.samplingInterval = entry.samplingInterval;
+                allocations.emplace(entry.address, std::move(allocation));
+            }
+        }
+    }
+
+    // Symbolize after releasing the shard locks so other threads can keep recording.
+    for (auto& [address, allocation] : allocations)
+    {
+        static_cast<void>(address);
+        allocation.stackTrace = SymbolizeStackTrace(allocation.stackTraceId);
+    }
 #endif
+    return allocations;
+}
+
+std::string MemoryTracker::SymbolizeStackTrace(std::uint32_t stackTraceId) const
+{
+    return m_stackTraces->Symbolize(stackTraceId);
+}
+
+std::size_t MemoryTracker::StackTraceCount() const noexcept
+{
+    return m_stackTraces->count.load(std::memory_order_relaxed);
+}
+
+std::string MemoryTracker::HeapProfile(HeapProfileFormat format) const
+{
+    struct Bucket
+    {
+        std::size_t count = 0;
+        std::size_t bytes = 0;
+        double estimatedBytes = 0.0;
+        std::source_location location;
+    };
+
+    // Allocations without a stack trace are bucketed by source location instead.
+    std::map<std::pair<std::uint32_t, std::string>, Bucket> buckets;
+#if RAD_ENABLE_MEMORY_TRACKING
+    for (std::size_t shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
+    {
+        Shard& shard = m_shards[shardIndex];
+        std::lock_guard lock(shard.mutex);
+        for (const Shard::Entry& entry : shard.slots)
+        {
+            if (entry.address == nullptr)
+            {
+                continue;
+            }
+            std::string locationKey;
+            if (entry.stackTraceId == 0)
+            {
+                locationKey = std::string(entry.location.file_name()) + ':' +
+                              std::to_string(entry.location.line());
+            }
+            Bucket& bucket = buckets[{entry.stackTraceId, std::move(locationKey)}];
+            ++bucket.count;
+            bucket.bytes += entry.size;
+            bucket.estimatedBytes +=
+                static_cast<double>(entry.size) * SampleWeight(entry.size, entry.samplingInterval);
+            bucket.location = entry.location;
+        }
+    }
+#endif
+
+    std::ostringstream stream;
+    if (format == HeapProfileFormat::Folded)
+    {
+        for (const auto& [key, bucket] : buckets)
+        {
+            const std::vector<const void*> frames = m_stackTraces->Frames(key.first);
+            bool first = true;
+            for (auto frame = frames.rbegin(); frame != frames.rend(); ++frame)
+            {
+                std::string name = boost::stacktrace::frame(*frame).name();
+                if (name.empty())
+                {
+                    char address[2 + 16 + 1];
+                    std::snprintf(address, sizeof(address), "%p", *frame);
+                    name = address;
+                }
+                // ';' separates frames and the last space separates the value.
+                std::ranges::replace(name, ';', ',');
+                stream << (first ? "" : ";") << name;
+                first = false;
+            }
+            if (frames.empty())
+            {
+                stream << bucket.location.function_name() << " (" << key.second << ')';
+            }
+            stream << ' ' << std::llround(bucket.estimatedBytes) << '\n';
+        }
+        return stream.str();
+    }
+
+    std::size_t totalCount = 0;
+    std::size_t totalBytes = 0;
+    for (const auto& [key, bucket] : buckets)
+    {
+        if (key.first != 0)
+        {
+            totalCount += bucket.count;
+            totalBytes += bucket.bytes;
+        }
+    }
+    // pprof scales each sample by 1 / (1 - exp(-size / interval)); an interval of one leaves
+    // unsampled profiles as they are.
+    const std::size_t samplingInterval = std::max<std::size_t>(SamplingInterval(), 1);
+    stream << "heap profile: " << totalCount << ": " << totalBytes << " [" << totalCount << ": "
+           << totalBytes << "] @ heap_v2/" << samplingInterval << '\n';
+    for (const auto& [key, bucket] : buckets)
+    {
+        if (key.first == 0)
+        {
+            continue;
+        }
+        stream << ' ' << bucket.count << ": " << bucket.bytes << " [" << bucket.count << ": "
+               << bucket.bytes << "] @";
+        for (const void* frame : m_stackTraces->Frames(key.first))
+        {
+            stream << " 0x" << std::hex << reinterpret_cast<std::uintptr_t>(frame) << std::dec;
+        }
+        stream << '\n';
+    }
+#if defined(RAD_OS_LINUX) || defined(RAD_OS_ANDROID)
+    // pprof maps addresses back to binaries with the process memory map.
+    std::ifstream maps("/proc/self/maps");
+    if (maps)
+    {
+        stream << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#endif
+    return stream.str();
 }
 
 void* Allocate(std::size_t size, std::source_location location) noexcept
@@ -389,4 +1069,130 @@ void FreeAligned(void* ptr) noexcept
 #endif
 }
 
+LargeAllocation AllocateLarge(std::size_t size, const LargeAllocationOptions& options,
+                              std::source_location location) noexcept
+{
+    LargeAllocation allocation;
+#if defined(RAD_OS_LINUX)
+    const std::size_t basePageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    // Leave room for rounding up and for the alignment slack of the THP mapping.
+    constexpr std::size_t MaxPadding = std::size_t{1} << 31;
+    if (size == 0 || size > std::numeric_limits<std::size_t>::max() - MaxPadding)
+    {
+        return {};
+    }
+
+    if (options.hugePages)
+    {
+        const std::size_t transparentPageSize = TransparentHugePageSize();
+        if (transparentPageSize != 0 && transparentPageSize < MaxPadding)
+        {
+            const std::size_t mappedSize = AlignUpToPowerOfTwo(size, transparentPageSize);
+            void* data = MapAnonymousAligned(mappedSize, transparentPageSize);
+            if (data != nullptr && madvise(data, mappedSize, MADV_HUGEPAGE) == 0)
+            {
+                allocation = {data, mappedSize, transparentPageSize,
+                              LargePageBacking::Transparent};
+            }
+            else if (data != nullptr)
+            {
+                munmap(data, mappedSize);
+            }
+        }
+
+        const std::size_t explicitPageSize = ExplicitHugePageSize();
+        if (allocation.data == nullptr && explicitPageSize != 0 && explicitPageSize < MaxPadding)
+        {
+            // Fails immediately unless the administrator reserved enough hugetlbfs pages.
+            const std::size_t mappedSize = AlignUpToPowerOfTwo(size, explicitPageSize);
+            void* data = MapAnonymous(mappedSize, MAP_HUGETLB);
+            if (data != nullptr)
+            {
+                allocation = {data, mappedSize, explicitPageSize, LargePageBacking::Explicit};
+            }
+        }
+    }
+
+    if (allocation.data == nullptr)
+    {
+        const std::size_t mappedSize = AlignUpToPowerOfTwo(size, basePageSize);
+        void* data = MapAnonymous(mappedSize, 0);
+        if (data == nullptr)
+        {
+            return {};
+        }
+        allocation = {data, mappedSize, basePageSize, LargePageBacking::Normal};
+    }
+
+    // Bind before any page is faulted in, so that every page lands on the requested node.
+    if (options.numaNode >= 0 && BindToNumaNode(allocation.data, allocation.size, options.numaNode))
+    {
+        allocation.numaNode = options.numaNode;
+    }
+
+    if (options.populate)
+    {
+        Prefault(allocation.data, allocation.size, allocation.pageSize);
+        if ((allocation.backing == LargePageBacking::Transparent) &&
+            !HasAnonHugePages(allocation.data))
+        {
+            allocation.pageSize = basePageSize;
+            allocation.backing = LargePageBacking::Normal;
+        }
+    }
+#else
+    constexpr std::size_t basePageSize = 4096;
+    if (size == 0 || size > std::numeric_limits<std::size_t>::max() - basePageSize)
+    {
+        return {};
+    }
+    const std::size_t mappedSize = AlignUpToPowerOfTwo(size, basePageSize);
+    // Recorded below as a Large allocation instead of RawAligned.
+#if defined(RAD_OS_WINDOWS)
+    void* data = _aligned_malloc(mappedSize, basePageSize);
+#else
+    void* data = nullptr;
+    if (posix_memalign(&data, basePageSize, mappedSize) != 0)
+    {
+        data = nullptr;
+    }
+#endif
+    if (data == nullptr)
+    {
+        return {};
+    }
+    allocation = {data, mappedSize, basePageSize, LargePageBacking::Normal};
+    if (options.populate)
+    {
+        std::memset(data, 0, mappedSize);
+    }
+#endif
+
+#if RAD_ENABLE_MEMORY_TRACKING
+    GetGlobalMemoryTracker().RecordAllocation(allocation.data, allocation.size,
+                                              AllocationKind::Large, location);
+#else
+    static_cast<void>(location);
+#endif
+    return allocation;
+}
+
+void FreeLarge(const LargeAllocation& allocation) noexcept
+{
+    if (allocation.data == nullptr)
+    {
+        return;
+    }
+#if RAD_ENABLE_MEMORY_TRACKING
+    GetGlobalMemoryTracker().RecordDeallocation(allocation.data, AllocationKind::Large);
+#endif
+#if defined(RAD_OS_LINUX)
+    munmap(allocation.data, allocation.size);
+#elif defined(RAD_OS_WINDOWS)
+    _aligned_free(allocation.data);
+#else
+    std::free(allocation.data);
+#endif
+}
+
 } // namespace rad
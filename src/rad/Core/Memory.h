@@ -6,9 +6,10 @@
 #include <cstdint>
 #include <limits>
 #include <map>
-#include <mutex>
+#include <memory>
 #include <source_location>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <boost/align/aligned_allocator.hpp>
@@ -32,6 +33,10 @@ enum class AllocationKind
     RawAligned,
     Object,
     ObjectArray,
+    // Small blocks from rad::PoolAllocate.
+    Pooled,
+    // Page-granular mappings from rad::AllocateLarge.
+    Large,
 };
 
 struct AllocationRecord
@@ -40,6 +45,12 @@ struct AllocationRecord
     std::size_t size = 0;
     AllocationKind kind = AllocationKind::Unknown;
     std::source_location location;
+    // Allocations with identical call stacks share one interned id; zero means none was captured.
+    std::uint32_t stackTraceId = 0;
+    // Mean sampling interval in bytes in effect when the allocation was sampled; zero when every
+    // allocation was being recorded.
+    std::size_t samplingInterval = 0;
+    // Symbolized lazily; only filled in by snapshots such as MemoryTracker::ActiveAllocations.
     std::string stackTrace;
 };
 
@@ -47,30 +58,62 @@ struct MemoryStatistics
 {
     std::size_t activeAllocationCount = 0;
     std::size_t activeBytes = 0;
+    // Exact high-water marks of activeAllocationCount and activeBytes.
     std::size_t peakAllocationCount = 0;
     std::size_t peakBytes = 0;
     std::size_t totalAllocationCount = 0;
     // Cumulative bytes requested across allocations and realloc growth (shrinks do not subtract).
     std::size_t totalAllocatedBytes = 0;
+    // Chunks currently held by rad::Arena instances. Chunk memory is also counted above as
+    // RawAligned allocations.
+    std::size_t arenaChunkCount = 0;
+    std::size_t arenaChunkBytes = 0;
 };
 
-// Thread-safe registry of live allocations for debugging.
+enum class HeapProfileFormat
+{
+    // One "outer;...;inner bytes" line per call stack, for flamegraph.pl, inferno or speedscope.
+    // Byte counts are unsampled estimates.
+    Folded,
+    // gperftools legacy text heap profile (heap_v2) with raw sampled counts, readable by pprof.
+    Pprof,
+};
+
+// Thread-safe registry of live allocations for debugging. Allocations are sharded by address so
+// that threads recording unrelated pointers rarely contend on the same lock.
 class MemoryTracker
 {
 public:
-    MemoryTracker() = default;
+    MemoryTracker();
+    ~MemoryTracker();
     MemoryTracker(const MemoryTracker&) = delete;
     MemoryTracker& operator=(const MemoryTracker&) = delete;
 
-    // A depth of zero disables stack-trace capture.
+    static constexpr std::size_t MaxStackTraceDepth = 64;
+    // Interned call stacks live as long as the tracker. Past this many, allocations from new call
+    // stacks are recorded without a stack trace, as if the depth were zero.
+    static constexpr std::size_t MaxStackTraceCount = 65536;
+
+    // A depth of zero disables stack-trace capture. Depths are clamped to MaxStackTraceDepth.
+    // Recording only stores raw frame addresses; symbolization is deferred until a trace is read.
     void SetStackTraceDepth(std::size_t depth) noexcept;
     [[nodiscard]] std::size_t StackTraceDepth() const noexcept;
 
+    // Records only a size-proportional sample of allocations, on average one per meanBytes
+    // allocated, using a per-thread byte countdown like tcmalloc and jemalloc. Zero records every
+    // allocation. Once sampling has been enabled, frees of unrecorded pointers are ignored, and
+    // Statistics() and ActiveAllocations() describe the sampled allocations only. Frees must then
+    // pass the recorded address: an Object freed through a base-subobject pointer is not matched
+    // and stays live. rad::Delete passes the most-derived address of polymorphic types.
+    void SetSamplingInterval(std::size_t meanBytes) noexcept;
+    [[nodiscard]] std::size_t SamplingInterval() const noexcept;
+
     void RecordAllocation(void* ptr, std::size_t size,
                           AllocationKind kind = AllocationKind::Unknown,
                           std::source_location location = std::source_location::current()) noexcept;
     // Removes the allocation for ptr. For Object/ObjectArray, ptr may be an interior base
-    // subobject address; Raw/RawAligned require an exact pointer match.
+    // subobject address (found by a slow scan of every shard); Raw/RawAligned require an exact
+    // pointer match.
     // kind must match the recorded AllocationKind.
     void RecordDeallocation(const void* ptr, AllocationKind kind) noexcept;
     // oldPtr must be nullptr or a tracked Raw allocation; kind is stored on the new entry.
@@ -78,15 +121,47 @@ public:
         void* oldPtr, void* newPtr, std::size_t newSize, AllocationKind kind = AllocationKind::Raw,
         std::source_location location = std::source_location::current()) noexcept;
 
-    // Returns thread-safe snapshots of the current tracker state.
+    // Called by rad::Arena when it acquires or frees a chunk.
+    void RecordArenaChunkAllocation(std::size_t size) noexcept;
+    void RecordArenaChunkDeallocation(std::size_t size) noexcept;
+
+    // Returns thread-safe snapshots of the current tracker state. Statistics() does not lock;
+    // while other threads are recording, its fields may come from slightly different instants.
     [[nodiscard]] MemoryStatistics Statistics() const noexcept;
+    // Symbolizes every record's stack trace; expensive, intended for leak reports.
     [[nodiscard]] std::map<const void*, AllocationRecord> ActiveAllocations() const;
+    // Returns the symbolized trace for an id from AllocationRecord::stackTraceId, or an empty
+    // string for zero or unknown ids. Results are cached per id.
+    [[nodiscard]] std::string SymbolizeStackTrace(std::uint32_t stackTraceId) const;
+    // Number of distinct call stacks interned so far, at most MaxStackTraceCount.
+    [[nodiscard]] std::size_t StackTraceCount() const noexcept;
+    // Aggregates live (sampled) allocations by call stack. Allocations without a captured stack
+    // are keyed by their source location in Folded output and omitted from Pprof output.
+    [[nodiscard]] std::string HeapProfile(HeapProfileFormat format) const;
 
 private:
-    mutable std::mutex m_mutex;
-    std::map<const void*, AllocationRecord> m_allocations;
-    MemoryStatistics m_statistics;
-    std::atomic<std::size_t> m_stackTraceDepth = 32;
+    struct Shard;
+    struct StackTraceTable;
+    static constexpr std::size_t ShardCount = 64;
+
+    [[nodiscard]] Shard& GetShard(std::uint64_t hash) const noexcept;
+    [[nodiscard]] std::uint32_t CaptureStackTrace() noexcept;
+    void AddActive(std::size_t bytes) noexcept;
+    void SubtractActive(std::size_t bytes) noexcept;
+
+    std::unique_ptr<Shard[]> m_shards;
+    std::unique_ptr<StackTraceTable> m_stackTraces;
+    // The only counters shared by every record and free; an exact peak needs one running total.
+    // They sit on their own cache line, away from the read-mostly settings.
+    alignas(64) std::atomic<std::size_t> m_activeAllocationCount = 0;
+    std::atomic<std::size_t> m_activeBytes = 0;
+    std::atomic<std::size_t> m_peakAllocationCount = 0;
+    std::atomic<std::size_t> m_peakBytes = 0;
+    alignas(64) std::atomic<std::size_t> m_arenaChunkCount = 0;
+    std::atomic<std::size_t> m_arenaChunkBytes = 0;
+    alignas(64) std::atomic<std::size_t> m_stackTraceDepth = 32;
+    std::atomic<std::size_t> m_samplingInterval = 0;
+    std::atomic<bool> m_samplingEverEnabled = false;
 }; // class MemoryTracker
 
 [[nodiscard]] MemoryTracker& GetGlobalMemoryTracker() noexcept;
@@ -122,6 +197,47 @@ void Free(void* ptr) noexcept;
 // Frees memory returned by AllocateAligned; ptr may be nullptr.
 void FreeAligned(void* ptr) noexcept;
 
+enum class LargePageBacking
+{
+    // Base pages (typically 4 KiB).
+    Normal,
+    // Transparent huge pages requested with MADV_HUGEPAGE. Pages are only verified to be huge
+    // when the allocation was populated; otherwise the kernel may still fall back to base pages.
+    Transparent,
+    // Explicit huge pages from the hugetlbfs pool (MAP_HUGETLB).
+    Explicit,
+};
+
+struct LargeAllocationOptions
+{
+    // Try transparent huge pages first, then the hugetlbfs pool, before falling back to base pages.
+    bool hugePages = true;
+    // Fault every page in before returning, so the first pass over the buffer does not pay for it.
+    bool populate = false;
+    // Binds the pages to this NUMA node with mbind; negative leaves placement to the kernel.
+    int numaNode = -1;
+};
+
+struct LargeAllocation
+{
+    void* data = nullptr;
+    // Mapped size: the request rounded up to a multiple of pageSize.
+    std::size_t size = 0;
+    std::size_t pageSize = 0;
+    LargePageBacking backing = LargePageBacking::Normal;
+    // Node the pages are bound to, or -1 if no binding was requested or it failed.
+    int numaNode = -1;
+};
+
+// Allocates a page-aligned buffer for multi-megabyte working sets. On Linux the buffer is an
+// anonymous mapping that may use huge pages and NUMA binding; elsewhere it falls back to
+// AllocateAligned with base pages. Returns an empty allocation for zero size or failure.
+[[nodiscard]] LargeAllocation AllocateLarge(
+    std::size_t size, const LargeAllocationOptions& options = {},
+    std::source_location location = std::source_location::current()) noexcept;
+// Frees memory returned by AllocateLarge; an empty allocation is a no-op.
+void FreeLarge(const LargeAllocation& allocation) noexcept;
+
 template <typename T, typename... Args>
 [[nodiscard]] T* New(std::source_location location, Args&&... args)
 {
@@ -139,7 +255,17 @@ void Delete(T* ptr) noexcept(noexcept(delete ptr))
 {
     static_assert(requires { sizeof(T); }, "rad::Delete requires a complete type");
 #if RAD_ENABLE_MEMORY_TRACKING
-    GetGlobalMemoryTracker().RecordDeallocation(ptr, AllocationKind::Object);
+    // A base pointer may not be the address New recorded; the exact lookup is the only one left
+    // while sampling.
+    if constexpr (std::is_polymorphic_v<T>)
+    {
+        GetGlobalMemoryTracker().RecordDeallocation(dynamic_cast<const void*>(ptr),
+                                                    AllocationKind::Object);
+    }
+    else
+    {
+        GetGlobalMemoryTracker().RecordDeallocation(ptr, AllocationKind::Object);
+    }
 #endif
     delete ptr;
 }
@@ -1,10 +1,14 @@
 #include <rad/Core/Memory.h>
+#include <rad/Core/Integer.h>
 
 #include <gtest/gtest.h>
 
 #include <array>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST(Core, NewDelete)
 {
@@ -59,6 +63,211 @@ TEST(Core, MemoryTracker)
 #endif
 }
 
+TEST(Core, MemoryTrackerConcurrent)
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    rad::MemoryTracker tracker;
+    tracker.SetStackTraceDepth(0);
+
+    constexpr std::size_t threadCount = 4;
+    constexpr std::size_t allocationCount = 2048;
+    std::vector<std::thread> threads;
+    for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(
+            [&tracker]
+            {
+                std::vector<void*> pointers;
+                for (std::size_t i = 0; i < allocationCount; ++i)
+                {
+                    void* ptr = std::malloc(16 + i % 64);
+                    tracker.RecordAllocation(ptr, 16 + i % 64, rad::AllocationKind::Raw);
+                    pointers.push_back(ptr);
+                    // Free every other allocation early to exercise deletion between inserts.
+                    if (i % 2 == 1)
+                    {
+                        tracker.RecordDeallocation(pointers[i - 1], rad::AllocationKind::Raw);
+                        std::free(pointers[i - 1]);
+                        pointers[i - 1] = nullptr;
+                    }
+                }
+                for (void* ptr : pointers)
+                {
+                    if (ptr != nullptr)
+                    {
+                        tracker.RecordDeallocation(ptr, rad::AllocationKind::Raw);
+                        std::free(ptr);
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const rad::MemoryStatistics statistics = tracker.Statistics();
+    EXPECT_EQ(statistics.activeAllocationCount, 0u);
+    EXPECT_EQ(statistics.activeBytes, 0u);
+    EXPECT_EQ(statistics.totalAllocationCount, threadCount * allocationCount);
+    EXPECT_GE(statistics.peakAllocationCount, allocationCount / 2);
+    EXPECT_TRUE(tracker.ActiveAllocations().empty());
+#endif
+}
+
+TEST(Core, MemoryTrackerPeak)
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    // One block at a time, at addresses that hash to different shards, peaks at one block.
+    rad::MemoryTracker tracker;
+    constexpr std::size_t blockSize = 1024 * 1024;
+    std::vector<std::byte> storage(blockSize * 2);
+    for (std::size_t offset = 0; offset < 256; ++offset)
+    {
+        tracker.RecordAllocation(storage.data() + offset * 8, blockSize, rad::AllocationKind::Raw);
+        tracker.RecordDeallocation(storage.data() + offset * 8, rad::AllocationKind::Raw);
+    }
+    const rad::MemoryStatistics statistics = tracker.Statistics();
+    EXPECT_EQ(statistics.peakAllocationCount, 1u);
+    EXPECT_EQ(statistics.peakBytes, blockSize);
+    EXPECT_EQ(statistics.activeBytes, 0u);
+#endif
+}
+
+TEST(Core, MemoryTrackerInteriorPointer)
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    rad::MemoryTracker tracker;
+    std::array<std::byte, 64> object = {};
+    tracker.RecordAllocation(object.data(), object.size(), rad::AllocationKind::Object);
+    // A base subobject pointer resolves to the enclosing allocation.
+    tracker.RecordDeallocation(object.data() + 8, rad::AllocationKind::Object);
+    EXPECT_EQ(tracker.Statistics().activeAllocationCount, 0u);
+    EXPECT_TRUE(tracker.ActiveAllocations().empty());
+#endif
+}
+
+namespace
+{
+
+struct TrackedBase
+{
+    virtual ~TrackedBase() = default;
+    int base = 0;
+};
+
+struct TrackedSecondBase
+{
+    virtual ~TrackedSecondBase() = default;
+    int secondBase = 0;
+};
+
+struct TrackedDerived : TrackedBase, TrackedSecondBase
+{
+    int derived = 0;
+};
+
+} // namespace
+
+TEST(Core, DeleteThroughSecondaryBase)
+{
+    TrackedDerived* derived = RAD_NEW(TrackedDerived);
+    TrackedSecondBase* secondBase = derived;
+    ASSERT_NE(static_cast<void*>(secondBase), static_cast<void*>(derived));
+    RAD_DELETE(secondBase);
+#if RAD_ENABLE_MEMORY_TRACKING
+    EXPECT_FALSE(rad::GetGlobalMemoryTracker().ActiveAllocations().contains(derived));
+#endif
+}
+
+TEST(Core, MemoryTrackerStackTraces)
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    rad::MemoryTracker tracker;
+    tracker.SetStackTraceDepth(8);
+    EXPECT_EQ(tracker.StackTraceDepth(), 8u);
+
+    // Allocations recorded from the same call site share one interned stack.
+    std::array<std::byte, 4> objects = {};
+    for (std::byte& object : objects)
+    {
+        tracker.RecordAllocation(&object, 1, rad::AllocationKind::Raw);
+    }
+    EXPECT_EQ(tracker.StackTraceCount(), 1u);
+
+    const auto records = tracker.ActiveAllocations();
+    ASSERT_EQ(records.size(), objects.size());
+    const std::uint32_t stackTraceId = records.begin()->second.stackTraceId;
+    EXPECT_NE(stackTraceId, 0u);
+    for (const auto& [address, record] : records)
+    {
+        EXPECT_EQ(record.stackTraceId, stackTraceId) << address;
+        EXPECT_FALSE(record.stackTrace.empty());
+    }
+    EXPECT_EQ(tracker.SymbolizeStackTrace(stackTraceId), records.begin()->second.stackTrace);
+    EXPECT_TRUE(tracker.SymbolizeStackTrace(0).empty());
+
+    for (std::byte& object : objects)
+    {
+        tracker.RecordDeallocation(&object, rad::AllocationKind::Raw);
+    }
+
+    tracker.SetStackTraceDepth(rad::MemoryTracker::MaxStackTraceDepth + 1);
+    EXPECT_EQ(tracker.StackTraceDepth(), rad::MemoryTracker::MaxStackTraceDepth);
+#endif
+}
+
+TEST(Core, MemoryTrackerSampling)
+{
+#if RAD_ENABLE_MEMORY_TRACKING
+    rad::MemoryTracker tracker;
+    tracker.SetStackTraceDepth(8);
+    tracker.SetSamplingInterval(1024);
+    EXPECT_EQ(tracker.SamplingInterval(), 1024u);
+
+    // Each 100-byte allocation is sampled with probability 1 - exp(-100 / 1024), about 9.3%.
+    constexpr std::size_t AllocationCount = 10000;
+    constexpr std::size_t AllocationSize = 100;
+    std::vector<std::byte> block(AllocationCount * AllocationSize);
+    for (std::size_t i = 0; i < AllocationCount; ++i)
+    {
+        tracker.RecordAllocation(block.data() + i * AllocationSize, AllocationSize,
+                                 rad::AllocationKind::Raw);
+    }
+    const std::size_t sampled = tracker.Statistics().activeAllocationCount;
+    EXPECT_GT(sampled, 600u);
+    EXPECT_LT(sampled, 1300u);
+    for (const auto& [address, record] : tracker.ActiveAllocations())
+    {
+        EXPECT_EQ(record.samplingInterval, 1024u) << address;
+    }
+
+    // Folded output scales samples back up to an estimate of the true live bytes.
+    const std::string folded = tracker.HeapProfile(rad::HeapProfileFormat::Folded);
+    double estimatedBytes = 0.0;
+    std::size_t lineStart = 0;
+    while (lineStart < folded.size())
+    {
+        const std::size_t lineEnd = folded.find('\n', lineStart);
+        const std::size_t valueStart = folded.rfind(' ', lineEnd) + 1;
+        estimatedBytes += std::stod(folded.substr(valueStart, lineEnd - valueStart));
+        lineStart = lineEnd + 1;
+    }
+    EXPECT_NEAR(estimatedBytes, AllocationCount * AllocationSize, 250000.0);
+
+    const std::string pprof = tracker.HeapProfile(rad::HeapProfileFormat::Pprof);
+    EXPECT_EQ(pprof.rfind("heap profile: " + std::to_string(sampled) + ": ", 0), 0u);
+    EXPECT_NE(pprof.find("@ heap_v2/1024\n"), std::string::npos);
+
+    // Frees of allocations that were never sampled are ignored.
+    for (std::size_t i = 0; i < AllocationCount; ++i)
+    {
+        tracker.RecordDeallocation(block.data() + i * AllocationSize, rad::AllocationKind::Raw);
+    }
+    EXPECT_EQ(tracker.Statistics().activeAllocationCount, 0u);
+#endif
+}
+
 TEST(Core, AllocateAligned)
 {
     // Allocations satisfy the requested alignment, enforce pointer alignment, and remain writable.
@@ -89,3 +298,43 @@ TEST(Core, AllocateAligned)
         rad::FreeAligned(nullptr);
     }
 }
+
+TEST(Core, AllocateLarge)
+{
+    constexpr std::size_t Size = 8 * 1024 * 1024 + 123;
+
+    // Default options may pick huge pages; the reported page size must be consistent either way.
+    {
+        const rad::LargeAllocation allocation = rad::AllocateLarge(Size);
+        ASSERT_NE(allocation.data, nullptr);
+        EXPECT_GE(allocation.size, Size);
+        EXPECT_TRUE(rad::IsPowerOfTwo(allocation.pageSize));
+        EXPECT_EQ(allocation.size % allocation.pageSize, 0u);
+        EXPECT_TRUE(rad::IsAligned(allocation.data, allocation.pageSize));
+        EXPECT_EQ(allocation.numaNode, -1);
+#if RAD_ENABLE_MEMORY_TRACKING
+        EXPECT_TRUE(rad::GetGlobalMemoryTracker().ActiveAllocations().contains(allocation.data));
+#endif
+        std::memset(allocation.data, 0x3C, Size);
+        rad::FreeLarge(allocation);
+    }
+
+    // Base pages only, prefaulted, bound to node 0 where the system allows it.
+    {
+        rad::LargeAllocationOptions options;
+        options.hugePages = false;
+        options.populate = true;
+        options.numaNode = 0;
+        const rad::LargeAllocation allocation = rad::AllocateLarge(Size, options);
+        ASSERT_NE(allocation.data, nullptr);
+        EXPECT_EQ(allocation.backing, rad::LargePageBacking::Normal);
+        EXPECT_TRUE(allocation.numaNode == 0 || allocation.numaNode == -1);
+        const auto* bytes = static_cast<const unsigned char*>(allocation.data);
+        EXPECT_EQ(bytes[0], 0);
+        EXPECT_EQ(bytes[allocation.size - 1], 0);
+        rad::FreeLarge(allocation);
+    }
+
+    EXPECT_EQ(rad::AllocateLarge(0).data, nullptr);
+    rad::FreeLarge({});
+}
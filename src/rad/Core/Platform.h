@@ -386,6 +386,33 @@
 #define RAD_NOINLINE
 #endif
 
+// Compiles a function for additional instruction sets regardless of the global compiler flags.
+// Callers must check rad::IsSimdLevelSupported before calling such a function. MSVC accepts
+// intrinsics without per-function flags.
+#if defined(RAD_COMPILER_CLANG) || defined(RAD_COMPILER_GCC)
+#define RAD_TARGET(features) __attribute__((target(features)))
+#else
+#define RAD_TARGET(features)
+#endif
+
+// Targets matching rad::SimdLevel tiers.
+#define RAD_TARGET_SSE4_2 RAD_TARGET("ssse3,sse4.1,sse4.2,popcnt")
+#define RAD_TARGET_AVX2 RAD_TARGET("ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2")
+#define RAD_TARGET_AVX512                                                                          \
+    RAD_TARGET("ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,avx512f,avx512bw,"           \
+               "avx512dq,avx512vl")
+
+#if defined(__cplusplus)
+namespace rad
+{
+// Write masks selecting every lane of a 512-bit vector of 32-bit or 64-bit elements. GCC 12 warns
+// about the undefined passthrough operand of some unmasked AVX-512 intrinsics; their zero-masked
+// forms with these masks compile to the same instructions.
+inline constexpr unsigned short AllLanes32 = 0xFFFF;
+inline constexpr unsigned char AllLanes64 = 0xFF;
+} // namespace rad
+#endif
+
 // Communicates to the compiler that the block is unreachable
 #if defined(RAD_COMPILER_CLANG) || defined(RAD_COMPILER_GCC)
 #define RAD_UNREACHABLE() __builtin_unreachable()
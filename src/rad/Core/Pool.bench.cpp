@@ -0,0 +1,79 @@
+#include <rad/Core/Pool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <list>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t BatchSize = 1024;
+
+template <typename AllocateFn, typename FreeFn>
+void Churn(benchmark::State& state, AllocateFn allocate, FreeFn free)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<void*> pointers(BatchSize);
+    for (auto _ : state)
+    {
+        for (void*& ptr : pointers)
+        {
+            ptr = allocate(size);
+            benchmark::DoNotOptimize(ptr);
+        }
+        for (void* ptr : pointers)
+        {
+            free(ptr, size);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BatchSize));
+}
+
+void BM_PoolAllocate(benchmark::State& state)
+{
+    Churn(
+        state, [](std::size_t size) { return rad::PoolAllocate(size); },
+        [](void* ptr, std::size_t size) { rad::PoolFree(ptr, size); });
+}
+
+void BM_Malloc(benchmark::State& state)
+{
+    Churn(
+        state, [](std::size_t size) { return std::malloc(size); },
+        [](void* ptr, std::size_t) { std::free(ptr); });
+}
+
+void BM_PoolAllocatorList(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::list<int, rad::PoolAllocator<int>> list;
+        for (int i = 0; i < 1024; ++i)
+        {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.back());
+    }
+}
+
+void BM_StdAllocatorList(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::list<int> list;
+        for (int i = 0; i < 1024; ++i)
+        {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.back());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_PoolAllocate)->Arg(16)->Arg(64)->Arg(256)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Malloc)->Arg(16)->Arg(64)->Arg(256)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_PoolAllocatorList);
+BENCHMARK(BM_StdAllocatorList);
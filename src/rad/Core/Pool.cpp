@@ -0,0 +1,338 @@
+#include <rad/Core/Pool.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+
+namespace rad
+{
+
+namespace
+{
+
+constexpr std::size_t ClassCount = PoolMaxBlockSize / PoolBlockAlignment;
+constexpr std::size_t SlabSize = 64 * 1024;
+// Blocks move between a thread cache and the depot in batches of roughly this many bytes.
+constexpr std::size_t BatchBytes = 8 * 1024;
+
+// Every block is at least PoolBlockAlignment bytes, so a free block can hold both links.
+struct FreeBlock
+{
+    FreeBlock* next;
+    // Only meaningful on the first block of a batch parked in the depot.
+    FreeBlock* nextBatch;
+};
+
+static_assert(sizeof(FreeBlock) <= PoolBlockAlignment);
+
+[[nodiscard]] constexpr std::size_t SizeClassOf(std::size_t size) noexcept
+{
+    return (size - 1) / PoolBlockAlignment;
+}
+
+[[nodiscard]] constexpr std::size_t BlockSizeOf(std::size_t sizeClass) noexcept
+{
+    return (sizeClass + 1) * PoolBlockAlignment;
+}
+
+[[nodiscard]] constexpr std::uint32_t BatchCountOf(std::size_t sizeClass) noexcept
+{
+    return static_cast<std::uint32_t>(
+        std::clamp<std::size_t>(BatchBytes / BlockSizeOf(sizeClass), 8, 128));
+}
+
+struct FreeList
+{
+    FreeBlock* head = nullptr;
+    std::uint32_t count = 0;
+
+    void Push(FreeBlock* block) noexcept
+    {
+        block->next = head;
+        head = block;
+        ++count;
+    }
+
+    [[nodiscard]] FreeBlock* Pop() noexcept
+    {
+        FreeBlock* block = head;
+        head = block->next;
+        --count;
+        return block;
+    }
+};
+
+// Shared store of full batches per size class, plus the slabs they were carved from. Slabs are
+// never returned to the system; the pool only grows to the high-water mark of live blocks.
+class Depot
+{
+public:
+    // Moves one batch into list, carving a new slab if none is parked.
+    [[nodiscard]] bool Refill(std::size_t sizeClass, FreeList& list) noexcept
+    {
+        SizeClass& entry = m_classes[sizeClass];
+        std::lock_guard lock(entry.mutex);
+        if (entry.batches == nullptr && !CarveSlab(sizeClass, entry))
+        {
+            return false;
+        }
+        FreeBlock* batch = entry.batches;
+        entry.batches = batch->nextBatch;
+        for (FreeBlock* block = batch; block != nullptr;)
+        {
+            FreeBlock* next = block->next;
+            list.Push(block);
+            block = next;
+        }
+        return true;
+    }
+
+    // Parks a chain of blocks as one batch.
+    void Return(std::size_t sizeClass, FreeBlock* batch) noexcept
+    {
+        SizeClass& entry = m_classes[sizeClass];
+        std::lock_guard lock(entry.mutex);
+        batch->nextBatch = entry.batches;
+        entry.batches = batch;
+    }
+
+private:
+    struct Slab
+    {
+        Slab* next;
+    };
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        FreeBlock* batches = nullptr;
+        Slab* slabs = nullptr;
+    };
+
+    // Splits a fresh slab into full batches. The slab header takes the first block slot.
+    [[nodiscard]] static bool CarveSlab(std::size_t sizeClass, SizeClass& entry) noexcept
+    {
+        // Slabs bypass the MemoryTracker: they live for the whole process, and tracked pool
+        // blocks already account for the memory handed out.
+        void* memory = ::operator new(SlabSize, std::align_val_t{PoolBlockAlignment},
+                                      std::nothrow);
+        if (memory == nullptr)
+        {
+            return false;
+        }
+        Slab* slab = static_cast<Slab*>(memory);
+        slab->next = entry.slabs;
+        entry.slabs = slab;
+
+        const std::size_t blockSize = BlockSizeOf(sizeClass);
+        const std::uint32_t batchCount = BatchCountOf(sizeClass);
+        std::byte* cursor = static_cast<std::byte*>(memory) + blockSize;
+        std::byte* const end = static_cast<std::byte*>(memory) + SlabSize;
+        while (static_cast<std::size_t>(end - cursor) >= blockSize * batchCount)
+        {
+            FreeBlock* batch = nullptr;
+            for (std::uint32_t i = 0; i < batchCount; ++i)
+            {
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(cursor);
+                block->next = batch;
+                batch = block;
+                cursor += blockSize;
+            }
+            batch->nextBatch = entry.batches;
+            entry.batches = batch;
+        }
+        return true;
+    }
+
+    std::array<SizeClass, ClassCount> m_classes;
+}; // class Depot
+
+[[nodiscard]] Depot& GetDepot() noexcept
+{
+    // Intentionally leaked so that blocks freed during static destruction remain valid.
+    static Depot* depot = new Depot();
+    return *depot;
+}
+
+class ThreadCache
+{
+public:
+    ThreadCache() noexcept = default;
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+    ~ThreadCache();
+
+    [[nodiscard]] void* Allocate(std::size_t sizeClass) noexcept
+    {
+        FreeList& list = m_lists[sizeClass];
+        if (list.head == nullptr && !GetDepot().Refill(sizeClass, list))
+        {
+            return nullptr;
+        }
+        return list.Pop();
+    }
+
+    void Free(void* ptr, std::size_t sizeClass) noexcept
+    {
+        FreeList& list = m_lists[sizeClass];
+        list.Push(static_cast<FreeBlock*>(ptr));
+        const std::uint32_t batchCount = BatchCountOf(sizeClass);
+        // Keep up to two batches so that alternating alloc/free at a boundary does not thrash.
+        if (list.count >= batchCount * 2)
+        {
+            ReturnBatch(sizeClass, batchCount);
+        }
+    }
+
+    // Returns every cached block, including partial batches, to the depot.
+    void Flush() noexcept
+    {
+        for (std::size_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass)
+        {
+            const std::uint32_t batchCount = BatchCountOf(sizeClass);
+            while (m_lists[sizeClass].count >= batchCount)
+            {
+                ReturnBatch(sizeClass, batchCount);
+            }
+            // Partial batches are parked as-is; Refill tolerates short chains.
+            if (m_lists[sizeClass].count > 0)
+            {
+                ReturnBatch(sizeClass, m_lists[sizeClass].count);
+            }
+        }
+    }
+
+private:
+    void ReturnBatch(std::size_t sizeClass, std::uint32_t count) noexcept
+    {
+        FreeList& list = m_lists[sizeClass];
+        assert(count > 0 && count <= list.count);
+        FreeBlock* batch = list.head;
+        FreeBlock* last = batch;
+        for (std::uint32_t i = 1; i < count; ++i)
+        {
+            last = last->next;
+        }
+        list.head = last->next;
+        list.count -= count;
+        last->next = nullptr;
+        GetDepot().Return(sizeClass, batch);
+    }
+
+    std::array<FreeList, ClassCount> m_lists;
+}; // class ThreadCache
+
+// Set once the calling thread's cache has been destroyed; later frees go straight to the depot.
+thread_local bool t_threadCacheDestroyed = false;
+thread_local ThreadCache t_threadCache;
+
+ThreadCache::~ThreadCache()
+{
+    Flush();
+    t_threadCacheDestroyed = true;
+}
+
+[[nodiscard]] void* AllocateFromDepot(std::size_t sizeClass) noexcept
+{
+    FreeList list;
+    if (!GetDepot().Refill(sizeClass, list))
+    {
+        return nullptr;
+    }
+    FreeBlock* block = list.Pop();
+    if (list.head != nullptr)
+    {
+        GetDepot().Return(sizeClass, list.head);
+    }
+    return block;
+}
+
+} // namespace
+
+namespace detail
+{
+
+void* PoolAllocateBlock(std::size_t size) noexcept
+{
+    if (size == 0 || size > PoolMaxBlockSize)
+    {
+        return (size == 0) ? nullptr : ::operator new(size, std::nothrow);
+    }
+    const std::size_t sizeClass = SizeClassOf(size);
+    if (t_threadCacheDestroyed)
+    {
+        return AllocateFromDepot(sizeClass);
+    }
+    return t_threadCache.Allocate(sizeClass);
+}
+
+void PoolFreeBlock(void* ptr, std::size_t size) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    if (size > PoolMaxBlockSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    assert(size != 0);
+    const std::size_t sizeClass = SizeClassOf(size);
+    if (t_threadCacheDestroyed)
+    {
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = nullptr;
+        GetDepot().Return(sizeClass, block);
+        return;
+    }
+    t_threadCache.Free(ptr, sizeClass);
+}
+
+} // namespace detail
+
+void* PoolAllocate(std::size_t size, std::source_location location) noexcept
+{
+    if (size > PoolMaxBlockSize)
+    {
+        return Allocate(size, location);
+    }
+    void* ptr = detail::PoolAllocateBlock(size);
+#if RAD_ENABLE_MEMORY_TRACKING
+    if (ptr != nullptr)
+    {
+        GetGlobalMemoryTracker().RecordAllocation(ptr, size, AllocationKind::Pooled, location);
+    }
+#else
+    static_cast<void>(location);
+#endif
+    return ptr;
+}
+
+void PoolFree(void* ptr, std::size_t size) noexcept
+{
+    if (size > PoolMaxBlockSize)
+    {
+        Free(ptr);
+        return;
+    }
+#if RAD_ENABLE_MEMORY_TRACKING
+    if (ptr != nullptr)
+    {
+        GetGlobalMemoryTracker().RecordDeallocation(ptr, AllocationKind::Pooled);
+    }
+#endif
+    detail::PoolFreeBlock(ptr, size);
+}
+
+void TrimPoolThreadCache() noexcept
+{
+    if (!t_threadCacheDestroyed)
+    {
+        t_threadCache.Flush();
+    }
+}
+
+} // namespace rad
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <rad/Core/Memory.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <source_location>
+
+namespace rad
+{
+
+// Blocks up to PoolMaxBlockSize bytes are served from size classes spaced PoolBlockAlignment
+// apart; larger requests fall through to the general-purpose allocator.
+inline constexpr std::size_t PoolBlockAlignment = 16;
+inline constexpr std::size_t PoolMaxBlockSize = 256;
+
+// Allocates size bytes from the thread-caching small-object pool. Blocks are recorded in the
+// MemoryTracker as AllocationKind::Pooled. Returns nullptr for zero size or allocation failure.
+[[nodiscard]] void* PoolAllocate(
+    std::size_t size, std::source_location location = std::source_location::current()) noexcept;
+// Frees memory returned by PoolAllocate; size must match the allocation. ptr may be nullptr.
+void PoolFree(void* ptr, std::size_t size) noexcept;
+
+// Returns the calling thread's cached blocks to the shared depot.
+void TrimPoolThreadCache() noexcept;
+
+namespace detail
+{
+
+// Untracked variants used by PoolAllocated, whose objects are tracked by RAD_NEW instead.
+[[nodiscard]] void* PoolAllocateBlock(std::size_t size) noexcept;
+void PoolFreeBlock(void* ptr, std::size_t size) noexcept;
+
+static_assert(PoolBlockAlignment >= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+              "PoolAllocated relies on pool blocks meeting the default new alignment");
+
+} // namespace detail
+
+// Inherit to route every new/delete of a type (including RAD_NEW/RAD_DELETE and the deletes
+// issued by Ref<T>) through the pool. Types deleted through a base pointer need a virtual
+// destructor so that the sized delete sees the dynamic size. Types aligned beyond
+// __STDCPP_DEFAULT_NEW_ALIGNMENT__ bypass the pool, whose blocks are only PoolBlockAlignment
+// aligned.
+class PoolAllocated
+{
+public:
+    [[nodiscard]] static void* operator new(std::size_t size)
+    {
+        void* ptr = detail::PoolAllocateBlock(size);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    static void operator delete(void* ptr, std::size_t size) noexcept
+    {
+        detail::PoolFreeBlock(ptr, size);
+    }
+
+    [[nodiscard]] static void* operator new(std::size_t size, std::align_val_t alignment)
+    {
+        return ::operator new(size, alignment);
+    }
+
+    static void operator delete(void* ptr, std::size_t size, std::align_val_t alignment) noexcept
+    {
+        ::operator delete(ptr, size, alignment);
+    }
+}; // class PoolAllocated
+
+// Standard allocator over the pool, for node-based std containers and SmallVector.
+template <typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        void* ptr = (alignof(T) <= PoolBlockAlignment)
+                        ? PoolAllocate(ByteCount(n))
+                        : AllocateAligned(ByteCount(n), alignof(T));
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if constexpr (alignof(T) <= PoolBlockAlignment)
+        {
+            PoolFree(ptr, ByteCount(n));
+        }
+        else
+        {
+            FreeAligned(ptr);
+        }
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const PoolAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+    // Zero-element requests still get a distinct block.
+    [[nodiscard]] static std::size_t ByteCount(std::size_t n) noexcept
+    {
+        return std::max<std::size_t>(n * sizeof(T), 1);
+    }
+}; // class PoolAllocator
+
+} // namespace rad
@@ -0,0 +1,184 @@
+#include <rad/Core/Pool.h>
+#include <rad/Container/SmallVector.h>
+#include <rad/Core/RefCounted.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <list>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+class PooledNode : public rad::RefCounted<PooledNode>, public rad::PoolAllocated
+{
+public:
+    explicit PooledNode(int value) : value(value) {}
+
+    int value = 0;
+    char payload[40] = {};
+}; // class PooledNode
+
+class alignas(64) AlignedPooledNode : public rad::PoolAllocated
+{
+public:
+    float values[4] = {};
+}; // class AlignedPooledNode
+
+} // namespace
+
+TEST(Core, PoolAllocate)
+{
+    // Freed blocks are reused by the next allocation of the same size class.
+    void* first = rad::PoolAllocate(24);
+    ASSERT_NE(first, nullptr);
+    EXPECT_TRUE(rad::IsAligned(first, rad::PoolBlockAlignment));
+    std::memset(first, 0x5A, 24);
+    rad::PoolFree(first, 24);
+    void* second = rad::PoolAllocate(32);
+    EXPECT_EQ(second, first);
+    rad::PoolFree(second, 32);
+
+    EXPECT_EQ(rad::PoolAllocate(0), nullptr);
+    rad::PoolFree(nullptr, 16);
+
+    // Requests above the largest size class fall back to the general allocator.
+    void* large = rad::PoolAllocate(rad::PoolMaxBlockSize + 1);
+    ASSERT_NE(large, nullptr);
+    std::memset(large, 0, rad::PoolMaxBlockSize + 1);
+    rad::PoolFree(large, rad::PoolMaxBlockSize + 1);
+
+    // Enough blocks to spill batches into the depot and carve several slabs.
+    std::vector<void*> blocks;
+    for (int i = 0; i < 10000; ++i)
+    {
+        void* block = rad::PoolAllocate(48);
+        ASSERT_NE(block, nullptr);
+        std::memset(block, i & 0xFF, 48);
+        blocks.push_back(block);
+    }
+    for (void* block : blocks)
+    {
+        rad::PoolFree(block, 48);
+    }
+    rad::TrimPoolThreadCache();
+
+#if RAD_ENABLE_MEMORY_TRACKING
+    const rad::MemoryStatistics before = rad::GetGlobalMemoryTracker().Statistics();
+    void* tracked = rad::PoolAllocate(64);
+    const auto records = rad::GetGlobalMemoryTracker().ActiveAllocations();
+    const auto record = records.find(tracked);
+    ASSERT_NE(record, records.end());
+    EXPECT_EQ(record->second.kind, rad::AllocationKind::Pooled);
+    EXPECT_EQ(record->second.size, 64u);
+    rad::PoolFree(tracked, 64);
+    EXPECT_EQ(rad::GetGlobalMemoryTracker().Statistics().activeAllocationCount,
+              before.activeAllocationCount);
+#endif
+}
+
+TEST(Core, PoolAllocated)
+{
+    PooledNode* node = RAD_NEW(PooledNode, 7);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->value, 7);
+#if RAD_ENABLE_MEMORY_TRACKING
+    EXPECT_TRUE(rad::GetGlobalMemoryTracker().ActiveAllocations().contains(node));
+#endif
+    RAD_DELETE(node);
+
+    // Ref<T> releases through the class-level operator delete.
+    rad::Ref<PooledNode> ref{new PooledNode(3)};
+    rad::Ref<PooledNode> copy = ref;
+    ref.reset();
+    EXPECT_EQ(copy->value, 3);
+
+    // Over-aligned types take the aligned overloads instead of a 16-byte pool block.
+    std::vector<AlignedPooledNode*> alignedNodes;
+    for (int i = 0; i < 8; ++i)
+    {
+        alignedNodes.push_back(RAD_NEW(AlignedPooledNode));
+        EXPECT_TRUE(rad::IsAligned(alignedNodes.back(), 64));
+    }
+    for (AlignedPooledNode* alignedNode : alignedNodes)
+    {
+        RAD_DELETE(alignedNode);
+    }
+}
+
+TEST(Core, PoolAllocator)
+{
+    std::list<int, rad::PoolAllocator<int>> list;
+    std::map<int, int, std::less<int>, rad::PoolAllocator<std::pair<const int, int>>> map;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.push_back(i);
+        map.emplace(i, i * 2);
+    }
+    EXPECT_EQ(list.size(), 1000u);
+    EXPECT_EQ(map.at(500), 1000);
+
+    rad::SmallVector<int, 4, rad::PoolAllocator<int>> small;
+    for (int i = 0; i < 100; ++i)
+    {
+        small.push_back(i);
+    }
+    EXPECT_EQ(small[99], 99);
+
+    struct alignas(64) Overaligned
+    {
+        float values[16];
+    };
+    std::vector<Overaligned, rad::PoolAllocator<Overaligned>> overaligned(3);
+    EXPECT_TRUE(rad::IsAligned(overaligned.data(), 64));
+}
+
+TEST(Core, PoolConcurrent)
+{
+    // Blocks allocated on one thread and freed on another migrate through the depot.
+    constexpr int ThreadCount = 4;
+    constexpr int BlockCount = 5000;
+    std::vector<std::vector<void*>> blocks(ThreadCount);
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back(
+                [&blocks, t]
+                {
+                    for (int i = 0; i < BlockCount; ++i)
+                    {
+                        void* block = rad::PoolAllocate(16 + (i % 8) * 16);
+                        std::memset(block, t, 16);
+                        blocks[t].push_back(block);
+                    }
+                });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back(
+                [&blocks, t]
+                {
+                    const std::vector<void*>& owned = blocks[(t + 1) % ThreadCount];
+                    for (int i = 0; i < BlockCount; ++i)
+                    {
+                        rad::PoolFree(owned[i], 16 + (i % 8) * 16);
+                    }
+                });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
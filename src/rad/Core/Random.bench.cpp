@@ -0,0 +1,113 @@
+#include <rad/Core/Random.h>
+#include <rad/System/CpuInfo.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t SampleCount = 1 << 16;
+
+// The argument selects the rad::SimdLevel limit; unsupported levels are skipped.
+bool ApplySimdLevel(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return false;
+    }
+    rad::SetSimdLevelLimit(level);
+    return true;
+}
+
+// The per-sample pattern bulk generation replaces.
+template <typename Distribution>
+void BM_StdMt19937(benchmark::State& state)
+{
+    std::mt19937 engine(1);
+    Distribution distribution;
+    std::vector<float> values(SampleCount);
+    for (auto _ : state)
+    {
+        for (float& value : values)
+        {
+            value = distribution(engine);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(SampleCount));
+}
+
+template <typename Engine>
+void BM_EngineUniform(benchmark::State& state)
+{
+    Engine engine;
+    std::vector<float> values(SampleCount);
+    for (auto _ : state)
+    {
+        for (float& value : values)
+        {
+            value = rad::ToUnitFloat(static_cast<std::uint32_t>(engine() >> 32));
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(SampleCount));
+}
+
+void BM_BulkRandomUniform(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    rad::BulkRandom random(1);
+    std::vector<float> values(SampleCount);
+    for (auto _ : state)
+    {
+        random.FillUniform(values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(SampleCount));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void BM_BulkRandomNormal(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    rad::BulkRandom random(1);
+    std::vector<float> values(SampleCount);
+    for (auto _ : state)
+    {
+        random.FillNormal(values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(SampleCount));
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_StdMt19937<std::uniform_real_distribution<float>>);
+BENCHMARK(BM_StdMt19937<std::normal_distribution<float>>);
+BENCHMARK(BM_EngineUniform<rad::Pcg64>);
+BENCHMARK(BM_EngineUniform<rad::Xoshiro256pp>);
+BENCHMARK(BM_BulkRandomUniform)->Apply(SimdLevels);
+BENCHMARK(BM_BulkRandomNormal)->Apply(SimdLevels);
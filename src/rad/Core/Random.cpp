@@ -1,10 +1,552 @@
 #include <rad/Core/Random.h>
+#include <rad/Core/Platform.h>
+#include <rad/System/CpuInfo.h>
+#include <rad/System/OS.h>
 
-#include <pcg_extras.hpp>
-#include <pcg_random.hpp>
-#include <pcg_uint128.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(RAD_ARCH_X86)
+#include <immintrin.h>
+#elif defined(RAD_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif
 
 namespace rad
 {
 
+namespace
+{
+
+constexpr std::size_t LaneCount = BulkRandom::LaneCount;
+// Values produced by one lockstep step of all lanes.
+constexpr std::size_t BlockUint32Count = LaneCount * 2;
+
+// Advances every lane blockCount times and writes the outputs lane by lane, eight 64-bit values
+// per block, to output, which need not be aligned.
+using BlockKernel = void (*)(Uint64* state, void* output, std::size_t blockCount) noexcept;
+
+// Turn 32-bit values into floats; they return how many values they handled and the scalar
+// versions finish the rest.
+using UniformKernel = std::size_t (*)(const Uint32* bits, float* output, std::size_t count,
+                                      float scale, float offset, float limit) noexcept;
+using NormalKernel = std::size_t (*)(const Uint32* bits, float* output, std::size_t count,
+                                     float scale, float offset) noexcept;
+
+void NextBlocksScalar(Uint64* state, void* output, std::size_t blockCount) noexcept
+{
+    auto* bytes = static_cast<std::byte*>(output);
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        for (std::size_t lane = 0; lane < LaneCount; ++lane)
+        {
+            Xoshiro256pp engine({state[lane], state[LaneCount + lane], state[2 * LaneCount + lane],
+                                 state[3 * LaneCount + lane]});
+            const Uint64 value = engine();
+            std::memcpy(bytes, &value, sizeof(value));
+            bytes += sizeof(value);
+            const Xoshiro256pp::State& next = engine.GetState();
+            for (std::size_t word = 0; word < 4; ++word)
+            {
+                state[word * LaneCount + lane] = next[word];
+            }
+        }
+    }
+}
+
+// Uniform floats and the radius and angle of the Box-Muller transform all come from the top 24
+// bits of a 32-bit value, which convert to float exactly.
+constexpr int UniformBits = 24;
+
+[[nodiscard]] inline float UniformScalar(Uint32 bits, float scale, float offset,
+                                         float limit) noexcept
+{
+    return std::min(static_cast<float>(bits >> 8) * scale + offset, limit);
+}
+
+// Cephes logf for x in (0, 1]: x = m * 2^e with m in [sqrt(1/2), sqrt(2)), and a polynomial in
+// m - 1.
+constexpr float LogCoefficients[] = {7.0376836292e-2f,  -1.1514610310e-1f, 1.1676998740e-1f,
+                                     -1.2420140846e-1f, 1.4249322787e-1f,  -1.6668057665e-1f,
+                                     2.0000714765e-1f,  -2.4999993993e-1f, 3.3333331174e-1f};
+constexpr float LogLn2High = 0.693359375f;
+constexpr float LogLn2Low = -2.12194440e-4f;
+constexpr float SqrtHalf = 0.707106781186547524f;
+
+// Cephes sinf and cosf on [-pi/4, pi/4].
+constexpr float SinCoefficients[] = {-1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f};
+constexpr float CosCoefficients[] = {2.443315711809948e-5f, -1.388731625493765e-3f,
+                                     4.166664568298827e-2f};
+
+// The angle is 2 * pi * m / 2^24 for the 24-bit integer m. Rounding m to the nearest quarter turn
+// k leaves a remainder in [-2^21, 2^21), i.e. within pi/4, and k selects the quadrant.
+constexpr int QuarterTurnShift = UniformBits - 2;
+constexpr float RemainderToRadians = 1.57079632679489662f / (1 << QuarterTurnShift);
+
+[[nodiscard]] inline float LogScalar(float x) noexcept
+{
+    const auto bits = std::bit_cast<Uint32>(x);
+    auto exponent = static_cast<float>(static_cast<int>(bits >> 23) - 126);
+    float mantissa = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F000000u);
+    if (mantissa < SqrtHalf)
+    {
+        exponent -= 1.0f;
+        mantissa = mantissa + mantissa - 1.0f;
+    }
+    else
+    {
+        mantissa -= 1.0f;
+    }
+    const float squared = mantissa * mantissa;
+    float polynomial = LogCoefficients[0];
+    for (std::size_t index = 1; index < std::size(LogCoefficients); ++index)
+    {
+        polynomial = polynomial * mantissa + LogCoefficients[index];
+    }
+    float y = polynomial * mantissa * squared;
+    y += exponent * LogLn2Low;
+    y -= 0.5f * squared;
+    return mantissa + y + exponent * LogLn2High;
+}
+
+inline void NormalPairScalar(Uint32 radiusBits, Uint32 angleBits, float scale, float offset,
+                             float* output) noexcept
+{
+    const float uniform = static_cast<float>((radiusBits >> 8) + 1) * 0x1p-24f;
+    const float radius = std::sqrt(std::max(-2.0f * LogScalar(uniform), 0.0f));
+
+    const Uint32 turn = angleBits >> 8;
+    const Uint32 quadrant = (turn + (1u << (QuarterTurnShift - 1))) >> QuarterTurnShift;
+    const auto remainder = static_cast<Sint32>(turn - (quadrant << QuarterTurnShift));
+    const float angle = static_cast<float>(remainder) * RemainderToRadians;
+    const float squared = angle * angle;
+    float sine = ((SinCoefficients[0] * squared + SinCoefficients[1]) * squared +
+                  SinCoefficients[2]) *
+                     squared * angle +
+                 angle;
+    float cosine = ((CosCoefficients[0] * squared + CosCoefficients[1]) * squared +
+                    CosCoefficients[2]) *
+                       squared * squared -
+                   0.5f * squared + 1.0f;
+    if (quadrant & 1)
+    {
+        std::swap(sine, cosine);
+    }
+    if (quadrant & 2)
+    {
+        sine = -sine;
+    }
+    if ((quadrant + 1) & 2)
+    {
+        cosine = -cosine;
+    }
+    output[0] = radius * cosine * scale + offset;
+    output[1] = radius * sine * scale + offset;
+}
+
+#if defined(RAD_ARCH_X86)
+
+RAD_TARGET_AVX2 inline __m256i RotateLeft64Avx2(__m256i value, int count) noexcept
+{
+    return _mm256_or_si256(_mm256_slli_epi64(value, count), _mm256_srli_epi64(value, 64 - count));
+}
+
+RAD_TARGET_AVX2 void NextBlocksAvx2(Uint64* state, void* output, std::size_t blockCount) noexcept
+{
+    // Two registers of four lanes per state word.
+    __m256i s[4][2];
+    for (int word = 0; word < 4; ++word)
+    {
+        for (int half = 0; half < 2; ++half)
+        {
+            s[word][half] = _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(state + word * LaneCount + half * 4));
+        }
+    }
+    auto* destination = static_cast<__m256i*>(output);
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        for (int half = 0; half < 2; ++half)
+        {
+            const __m256i result = _mm256_add_epi64(
+                RotateLeft64Avx2(_mm256_add_epi64(s[0][half], s[3][half]), 23), s[0][half]);
+            _mm256_storeu_si256(destination++, result);
+            const __m256i shifted = _mm256_slli_epi64(s[1][half], 17);
+            s[2][half] = _mm256_xor_si256(s[2][half], s[0][half]);
+            s[3][half] = _mm256_xor_si256(s[3][half], s[1][half]);
+            s[1][half] = _mm256_xor_si256(s[1][half], s[2][half]);
+            s[0][half] = _mm256_xor_si256(s[0][half], s[3][half]);
+            s[2][half] = _mm256_xor_si256(s[2][half], shifted);
+            s[3][half] = RotateLeft64Avx2(s[3][half], 45);
+        }
+    }
+    for (int word = 0; word < 4; ++word)
+    {
+        for (int half = 0; half < 2; ++half)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(state + word * LaneCount + half * 4),
+                               s[word][half]);
+        }
+    }
+}
+
+RAD_TARGET_AVX2 std::size_t UniformAvx2(const Uint32* bits, float* output, std::size_t count,
+                                        float scale, float offset, float limit) noexcept
+{
+    const __m256 scales = _mm256_set1_ps(scale);
+    const __m256 offsets = _mm256_set1_ps(offset);
+    const __m256 limits = _mm256_set1_ps(limit);
+    std::size_t index = 0;
+    for (; count - index >= 8; index += 8)
+    {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + index));
+        const __m256 uniform = _mm256_cvtepi32_ps(_mm256_srli_epi32(values, 8));
+        _mm256_storeu_ps(output + index,
+                         _mm256_min_ps(_mm256_add_ps(_mm256_mul_ps(uniform, scales), offsets),
+                                       limits));
+    }
+    return index;
+}
+
+RAD_TARGET_AVX2 inline __m256 PolynomialAvx2(__m256 x, const float* coefficients,
+                                             std::size_t count) noexcept
+{
+    __m256 result = _mm256_set1_ps(coefficients[0]);
+    for (std::size_t index = 1; index < count; ++index)
+    {
+        result = _mm256_add_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(coefficients[index]));
+    }
+    return result;
+}
+
+RAD_TARGET_AVX2 inline __m256 LogAvx2(__m256 x) noexcept
+{
+    const __m256i bits = _mm256_castps_si256(x);
+    __m256 exponent = _mm256_cvtepi32_ps(
+        _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    __m256 mantissa = _mm256_castsi256_ps(
+        _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)),
+                        _mm256_set1_epi32(0x3F000000)));
+    const __m256 small = _mm256_cmp_ps(mantissa, _mm256_set1_ps(SqrtHalf), _CMP_LT_OQ);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    exponent = _mm256_sub_ps(exponent, _mm256_and_ps(small, one));
+    mantissa = _mm256_sub_ps(_mm256_add_ps(mantissa, _mm256_and_ps(small, mantissa)), one);
+
+    const __m256 squared = _mm256_mul_ps(mantissa, mantissa);
+    const __m256 polynomial =
+        PolynomialAvx2(mantissa, LogCoefficients, std::size(LogCoefficients));
+    __m256 y = _mm256_mul_ps(_mm256_mul_ps(polynomial, mantissa), squared);
+    y = _mm256_add_ps(y, _mm256_mul_ps(exponent, _mm256_set1_ps(LogLn2Low)));
+    y = _mm256_sub_ps(y, _mm256_mul_ps(_mm256_set1_ps(0.5f), squared));
+    return _mm256_add_ps(_mm256_add_ps(mantissa, y),
+                         _mm256_mul_ps(exponent, _mm256_set1_ps(LogLn2High)));
+}
+
+// Radius and angle bits are the even and odd 32-bit values; each pair yields two normals.
+RAD_TARGET_AVX2 std::size_t NormalAvx2(const Uint32* bits, float* output, std::size_t count,
+                                       float scale, float offset) noexcept
+{
+    const __m256 scales = _mm256_set1_ps(scale);
+    const __m256 offsets = _mm256_set1_ps(offset);
+    std::size_t index = 0;
+    for (; count - index >= 16; index += 16)
+    {
+        const __m256 first =
+            _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + index)));
+        const __m256 second = _mm256_castsi256_ps(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + index + 8)));
+        // Within each 128-bit lane: radius bits of pairs 0, 1 of first, then 0, 1 of second.
+        const __m256i radiusBits =
+            _mm256_castps_si256(_mm256_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m256i angleBits =
+            _mm256_castps_si256(_mm256_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+
+        const __m256 uniform = _mm256_mul_ps(
+            _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_srli_epi32(radiusBits, 8),
+                                                _mm256_set1_epi32(1))),
+            _mm256_set1_ps(0x1p-24f));
+        const __m256 radius = _mm256_sqrt_ps(_mm256_max_ps(
+            _mm256_mul_ps(_mm256_set1_ps(-2.0f), LogAvx2(uniform)), _mm256_setzero_ps()));
+
+        const __m256i turn = _mm256_srli_epi32(angleBits, 8);
+        const __m256i quadrant = _mm256_srli_epi32(
+            _mm256_add_epi32(turn, _mm256_set1_epi32(1 << (QuarterTurnShift - 1))),
+            QuarterTurnShift);
+        const __m256 angle = _mm256_mul_ps(
+            _mm256_cvtepi32_ps(_mm256_sub_epi32(turn, _mm256_slli_epi32(quadrant,
+                                                                        QuarterTurnShift))),
+            _mm256_set1_ps(RemainderToRadians));
+        const __m256 squared = _mm256_mul_ps(angle, angle);
+        __m256 sine = _mm256_add_ps(
+            _mm256_mul_ps(_mm256_mul_ps(PolynomialAvx2(squared, SinCoefficients, 3), squared),
+                          angle),
+            angle);
+        __m256 cosine = _mm256_add_ps(
+            _mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(PolynomialAvx2(squared, CosCoefficients,
+                                                                     3),
+                                                      squared),
+                                        squared),
+                          _mm256_mul_ps(_mm256_set1_ps(0.5f), squared)),
+            _mm256_set1_ps(1.0f));
+
+        const __m256 swap = _mm256_castsi256_ps(
+            _mm256_sub_epi32(_mm256_setzero_si256(),
+                             _mm256_and_si256(quadrant, _mm256_set1_epi32(1))));
+        const __m256 swappedSine = _mm256_blendv_ps(sine, cosine, swap);
+        cosine = _mm256_blendv_ps(cosine, sine, swap);
+        sine = _mm256_xor_ps(swappedSine,
+                             _mm256_castsi256_ps(_mm256_slli_epi32(
+                                 _mm256_and_si256(quadrant, _mm256_set1_epi32(2)), 30)));
+        cosine = _mm256_xor_ps(
+            cosine, _mm256_castsi256_ps(_mm256_slli_epi32(
+                        _mm256_and_si256(_mm256_add_epi32(quadrant, _mm256_set1_epi32(1)),
+                                         _mm256_set1_epi32(2)),
+                        30)));
+
+        const __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(radius, cosine), scales),
+                                       offsets);
+        const __m256 y =
+            _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(radius, sine), scales), offsets);
+        _mm256_storeu_ps(output + index, _mm256_unpacklo_ps(x, y));
+        _mm256_storeu_ps(output + index + 8, _mm256_unpackhi_ps(x, y));
+    }
+    return index;
+}
+
+RAD_TARGET_AVX512 void NextBlocksAvx512(Uint64* state, void* output,
+                                        std::size_t blockCount) noexcept
+{
+    __m512i s0 = _mm512_load_si512(state);
+    __m512i s1 = _mm512_load_si512(state + LaneCount);
+    __m512i s2 = _mm512_load_si512(state + 2 * LaneCount);
+    __m512i s3 = _mm512_load_si512(state + 3 * LaneCount);
+    auto* destination = static_cast<std::byte*>(output);
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        const __m512i result =
+            _mm512_add_epi64(_mm512_maskz_rol_epi64(AllLanes64, _mm512_add_epi64(s0, s3), 23), s0);
+        _mm512_storeu_si512(destination, result);
+        destination += sizeof(__m512i);
+        const __m512i shifted = _mm512_maskz_slli_epi64(AllLanes64, s1, 17);
+        s2 = _mm512_xor_si512(s2, s0);
+        s3 = _mm512_xor_si512(s3, s1);
+        s1 = _mm512_xor_si512(s1, s2);
+        s0 = _mm512_xor_si512(s0, s3);
+        s2 = _mm512_xor_si512(s2, shifted);
+        s3 = _mm512_maskz_rol_epi64(AllLanes64, s3, 45);
+    }
+    _mm512_store_si512(state, s0);
+    _mm512_store_si512(state + LaneCount, s1);
+    _mm512_store_si512(state + 2 * LaneCount, s2);
+    _mm512_store_si512(state + 3 * LaneCount, s3);
+}
+
+#elif defined(RAD_ARCH_AARCH64)
+
+template <int Count>
+inline uint64x2_t RotateLeft64Neon(uint64x2_t value) noexcept
+{
+    return vorrq_u64(vshlq_n_u64(value, Count), vshrq_n_u64(value, 64 - Count));
+}
+
+void NextBlocksNeon(Uint64* state, void* output, std::size_t blockCount) noexcept
+{
+    // Four registers of two lanes per state word.
+    uint64x2_t s[4][4];
+    for (int word = 0; word < 4; ++word)
+    {
+        for (int part = 0; part < 4; ++part)
+        {
+            s[word][part] = vld1q_u64(state + word * LaneCount + part * 2);
+        }
+    }
+    auto* destination = static_cast<std::byte*>(output);
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        for (int part = 0; part < 4; ++part)
+        {
+            const uint64x2_t result = vaddq_u64(
+                RotateLeft64Neon<23>(vaddq_u64(s[0][part], s[3][part])), s[0][part]);
+            vst1q_u8(reinterpret_cast<uint8_t*>(destination), vreinterpretq_u8_u64(result));
+            destination += sizeof(result);
+            const uint64x2_t shifted = vshlq_n_u64(s[1][part], 17);
+            s[2][part] = veorq_u64(s[2][part], s[0][part]);
+            s[3][part] = veorq_u64(s[3][part], s[1][part]);
+            s[1][part] = veorq_u64(s[1][part], s[2][part]);
+            s[0][part] = veorq_u64(s[0][part], s[3][part]);
+            s[2][part] = veorq_u64(s[2][part], shifted);
+            s[3][part] = RotateLeft64Neon<45>(s[3][part]);
+        }
+    }
+    for (int word = 0; word < 4; ++word)
+    {
+        for (int part = 0; part < 4; ++part)
+        {
+            vst1q_u64(state + word * LaneCount + part * 2, s[word][part]);
+        }
+    }
+}
+
+#endif
+
+[[nodiscard]] BlockKernel SelectBlockKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return NextBlocksAvx512;
+    case SimdLevel::AVX2:
+        return NextBlocksAvx2;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return NextBlocksNeon;
+#endif
+    default:
+        return NextBlocksScalar;
+    }
+}
+
+// AVX-512 gains nothing over AVX2 for the float transforms, which are dominated by the block
+// generation; NEON uses the scalar versions.
+[[nodiscard]] UniformKernel SelectUniformKernel() noexcept
+{
+#if defined(RAD_ARCH_X86)
+    const SimdLevel level = GetSimdLevel();
+    if (level == SimdLevel::AVX2 || level == SimdLevel::AVX512)
+    {
+        return UniformAvx2;
+    }
+#endif
+    return nullptr;
+}
+
+[[nodiscard]] NormalKernel SelectNormalKernel() noexcept
+{
+#if defined(RAD_ARCH_X86)
+    const SimdLevel level = GetSimdLevel();
+    if (level == SimdLevel::AVX2 || level == SimdLevel::AVX512)
+    {
+        return NormalAvx2;
+    }
+#endif
+    return nullptr;
+}
+
+// Floats are generated in chunks small enough for the random bits to stay in L1.
+constexpr std::size_t ChunkUint32Count = 1024;
+
+} // namespace
+
+Xoshiro256pp& GetThreadRandomEngine()
+{
+    thread_local Xoshiro256pp engine = []()
+    {
+        Xoshiro256pp::State state = {};
+        do
+        {
+            const std::vector<std::byte> entropy = os::urandom(sizeof(state));
+            std::memcpy(state.data(), entropy.data(), sizeof(state));
+        } while (state == Xoshiro256pp::State{});
+        return Xoshiro256pp(state);
+    }();
+    return engine;
+}
+
+BulkRandom::BulkRandom() : BulkRandom(GetThreadRandomEngine()())
+{
+}
+
+BulkRandom::BulkRandom(Xoshiro256pp engine) noexcept
+{
+    for (std::size_t lane = 0; lane < LaneCount; ++lane)
+    {
+        const Xoshiro256pp::State& state = engine.GetState();
+        for (std::size_t word = 0; word < state.size(); ++word)
+        {
+            m_state[word * LaneCount + lane] = state[word];
+        }
+        engine.Jump();
+    }
+}
+
+void BulkRandom::Fill(Span<Uint64> values) noexcept
+{
+    const BlockKernel kernel = SelectBlockKernel();
+    const std::size_t blockCount = values.size() / LaneCount;
+    kernel(m_state.data(), values.data(), blockCount);
+    if (const std::size_t rest = values.size() - blockCount * LaneCount; rest > 0)
+    {
+        std::array<Uint64, LaneCount> block;
+        kernel(m_state.data(), block.data(), 1);
+        std::copy_n(block.data(), rest, values.data() + blockCount * LaneCount);
+    }
+}
+
+void BulkRandom::Fill(Span<Uint32> values) noexcept
+{
+    const BlockKernel kernel = SelectBlockKernel();
+    const std::size_t blockCount = values.size() / BlockUint32Count;
+    kernel(m_state.data(), values.data(), blockCount);
+    if (const std::size_t rest = values.size() - blockCount * BlockUint32Count; rest > 0)
+    {
+        std::array<Uint32, BlockUint32Count> block;
+        kernel(m_state.data(), block.data(), 1);
+        std::copy_n(block.data(), rest, values.data() + blockCount * BlockUint32Count);
+    }
+}
+
+void BulkRandom::FillUniform(Span<float> values, float low, float high) noexcept
+{
+    assert(low < high);
+    const BlockKernel blockKernel = SelectBlockKernel();
+    const UniformKernel uniformKernel = SelectUniformKernel();
+    // Scaling by a power of two is exact, so [0, 1) matches ToUnitFloat bit for bit.
+    const float scale = (high - low) * 0x1p-24f;
+    const float limit = std::nextafter(high, low);
+    alignas(64) std::array<Uint32, ChunkUint32Count> bits;
+    for (std::size_t offset = 0; offset < values.size(); offset += bits.size())
+    {
+        const std::size_t count = std::min(bits.size(), values.size() - offset);
+        blockKernel(m_state.data(), bits.data(),
+                    (count + BlockUint32Count - 1) / BlockUint32Count);
+        float* output = values.data() + offset;
+        std::size_t index = uniformKernel ? uniformKernel(bits.data(), output, count, scale, low,
+                                                          limit)
+                                          : 0;
+        for (; index < count; ++index)
+        {
+            output[index] = UniformScalar(bits[index], scale, low, limit);
+        }
+    }
+}
+
+void BulkRandom::FillNormal(Span<float> values, float mean, float stddev) noexcept
+{
+    const BlockKernel blockKernel = SelectBlockKernel();
+    const NormalKernel normalKernel = SelectNormalKernel();
+    alignas(64) std::array<Uint32, ChunkUint32Count> bits;
+    for (std::size_t offset = 0; offset < values.size(); offset += bits.size())
+    {
+        const std::size_t count = std::min(bits.size(), values.size() - offset);
+        blockKernel(m_state.data(), bits.data(),
+                    (count + BlockUint32Count - 1) / BlockUint32Count);
+        float* output = values.data() + offset;
+        std::size_t index =
+            normalKernel ? normalKernel(bits.data(), output, count, stddev, mean) : 0;
+        for (; index + 2 <= count; index += 2)
+        {
+            NormalPairScalar(bits[index], bits[index + 1], stddev, mean, output + index);
+        }
+        if (index < count)
+        {
+            std::array<float, 2> pair;
+            NormalPairScalar(bits[index], bits[index + 1], stddev, mean, pair.data());
+            output[index] = pair[0];
+        }
+    }
+}
+
 } // namespace rad
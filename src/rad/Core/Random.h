@@ -1,6 +1,337 @@
 #pragma once
 
+#include <rad/Core/Hash.h>
+#include <rad/Core/Integer.h>
+#include <rad/Core/Platform.h>
+#include <rad/Core/Span.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+
+#if defined(RAD_COMPILER_MSVC) && defined(RAD_ARCH_X86_64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
 namespace rad
 {
 
+// Uniform float in [0, 1) from the top 24 bits of bits.
+[[nodiscard]] constexpr float ToUnitFloat(Uint32 bits) noexcept
+{
+    return static_cast<float>(bits >> 8) * 0x1p-24f;
+}
+
+// Uniform double in [0, 1) from the top 53 bits of bits.
+[[nodiscard]] constexpr double ToUnitDouble(Uint64 bits) noexcept
+{
+    return static_cast<double>(bits >> 11) * 0x1p-53;
+}
+
+// PCG-XSH-RR with 64-bit state and 32-bit output (https://www.pcg-random.org/). The sequence
+// matches pcg32 from pcg-cpp for the same seed and stream; streams with different stream values
+// never overlap.
+class Pcg32
+{
+public:
+    using result_type = Uint32;
+
+    static constexpr Uint64 DefaultSeed = 0xCAFEF00DD15EA5E5ull;
+    static constexpr Uint64 DefaultStream = 1442695040888963407ull >> 1;
+
+    constexpr explicit Pcg32(Uint64 seed = DefaultSeed, Uint64 stream = DefaultStream) noexcept
+    {
+        Seed(seed, stream);
+    }
+
+    constexpr void Seed(Uint64 seed, Uint64 stream = DefaultStream) noexcept
+    {
+        m_increment = (stream << 1) | 1;
+        m_state = Step(seed + m_increment);
+    }
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+    [[nodiscard]] static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type operator()() noexcept
+    {
+        const Uint64 state = m_state;
+        m_state = Step(state);
+        const auto xorShifted = static_cast<Uint32>(((state >> 18) ^ state) >> 27);
+        return std::rotr(xorShifted, static_cast<int>(state >> 59));
+    }
+
+    // Skips delta outputs in O(log delta) steps (Brown, "Random Number Generation with Arbitrary
+    // Strides"); the step count wraps, so Advance(-n) steps back n outputs.
+    constexpr void Advance(Uint64 delta) noexcept
+    {
+        Uint64 multiplier = Multiplier;
+        Uint64 increment = m_increment;
+        Uint64 totalMultiplier = 1;
+        Uint64 totalIncrement = 0;
+        for (; delta > 0; delta >>= 1)
+        {
+            if (delta & 1)
+            {
+                totalMultiplier *= multiplier;
+                totalIncrement = totalIncrement * multiplier + increment;
+            }
+            increment = (multiplier + 1) * increment;
+            multiplier *= multiplier;
+        }
+        m_state = totalMultiplier * m_state + totalIncrement;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Pcg32&) const noexcept = default;
+
+private:
+    static constexpr Uint64 Multiplier = 6364136223846793005ull;
+
+    [[nodiscard]] constexpr Uint64 Step(Uint64 state) const noexcept
+    {
+        return state * Multiplier + m_increment;
+    }
+
+    Uint64 m_state = 0;
+    Uint64 m_increment = 0;
+}; // class Pcg32
+
+namespace detail
+{
+
+[[nodiscard]] inline Uint64 MultiplyHigh64(Uint64 lhs, Uint64 rhs) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    return static_cast<Uint64>((static_cast<unsigned __int128>(lhs) * rhs) >> 64);
+#elif defined(RAD_COMPILER_MSVC) && defined(RAD_ARCH_X86_64)
+    return __umulh(lhs, rhs);
+#else
+    const Uint64 lowLow = Lower32Bits(lhs) * static_cast<Uint64>(Lower32Bits(rhs));
+    const Uint64 highLow = Upper32Bits(lhs) * static_cast<Uint64>(Lower32Bits(rhs));
+    const Uint64 lowHigh = Lower32Bits(lhs) * static_cast<Uint64>(Upper32Bits(rhs));
+    const Uint64 highHigh = Upper32Bits(lhs) * static_cast<Uint64>(Upper32Bits(rhs));
+    const Uint64 middle = (lowLow >> 32) + Lower32Bits(highLow) + Lower32Bits(lowHigh);
+    return highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+// Just enough 128-bit arithmetic for the Pcg64 state.
+struct PcgUint128
+{
+    Uint64 low = 0;
+    Uint64 high = 0;
+
+    [[nodiscard]] friend PcgUint128 operator+(PcgUint128 lhs, PcgUint128 rhs) noexcept
+    {
+        const Uint64 low = lhs.low + rhs.low;
+        return {low, lhs.high + rhs.high + (low < lhs.low ? 1 : 0)};
+    }
+
+    [[nodiscard]] friend PcgUint128 operator*(PcgUint128 lhs, PcgUint128 rhs) noexcept
+    {
+        return {lhs.low * rhs.low,
+                MultiplyHigh64(lhs.low, rhs.low) + lhs.low * rhs.high + lhs.high * rhs.low};
+    }
+
+    [[nodiscard]] bool operator==(const PcgUint128&) const noexcept = default;
+}; // struct PcgUint128
+
+} // namespace detail
+
+// PCG-XSL-RR with 128-bit state and 64-bit output; matches pcg64 from pcg-cpp for the same seed
+// and stream.
+class Pcg64
+{
+public:
+    using result_type = Uint64;
+
+    static constexpr Uint64 DefaultSeed = 0xCAFEF00DD15EA5E5ull;
+
+    explicit Pcg64(Uint64 seed = DefaultSeed) noexcept
+    {
+        // pcg-cpp's default increment, which is not of the form (stream << 1) | 1 for a 64-bit
+        // stream.
+        m_increment = {1442695040888963407ull, 6364136223846793005ull};
+        m_state = Step(detail::PcgUint128{seed, 0} + m_increment);
+    }
+
+    Pcg64(Uint64 seed, Uint64 stream) noexcept { Seed(seed, stream); }
+
+    void Seed(Uint64 seed, Uint64 stream) noexcept
+    {
+        m_increment = {(stream << 1) | 1, stream >> 63};
+        m_state = Step(detail::PcgUint128{seed, 0} + m_increment);
+    }
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+    [[nodiscard]] static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept
+    {
+        m_state = Step(m_state);
+        return std::rotr(m_state.high ^ m_state.low, static_cast<int>(m_state.high >> 58));
+    }
+
+    // Skips delta outputs in O(log delta) steps.
+    void Advance(Uint64 delta) noexcept
+    {
+        detail::PcgUint128 multiplier = Multiplier;
+        detail::PcgUint128 increment = m_increment;
+        detail::PcgUint128 totalMultiplier = {1, 0};
+        detail::PcgUint128 totalIncrement = {0, 0};
+        for (; delta > 0; delta >>= 1)
+        {
+            if (delta & 1)
+            {
+                totalMultiplier = totalMultiplier * multiplier;
+                totalIncrement = totalIncrement * multiplier + increment;
+            }
+            increment = (multiplier + detail::PcgUint128{1, 0}) * increment;
+            multiplier = multiplier * multiplier;
+        }
+        m_state = totalMultiplier * m_state + totalIncrement;
+    }
+
+    [[nodiscard]] bool operator==(const Pcg64&) const noexcept = default;
+
+private:
+    static constexpr detail::PcgUint128 Multiplier = {4865540595714422341ull,
+                                                      2549297995355413924ull};
+
+    [[nodiscard]] detail::PcgUint128 Step(detail::PcgUint128 state) const noexcept
+    {
+        return state * Multiplier + m_increment;
+    }
+
+    detail::PcgUint128 m_state;
+    detail::PcgUint128 m_increment;
+}; // class Pcg64
+
+// xoshiro256++ (https://prng.di.unimi.it/): 256-bit state, 64-bit output, period 2^256 - 1.
+// Jump and LongJump split one seed into non-overlapping streams for parallel workers.
+class Xoshiro256pp
+{
+public:
+    using result_type = Uint64;
+    using State = std::array<Uint64, 4>;
+
+    // Expands seed with SplitMix64, as recommended by the authors.
+    constexpr explicit Xoshiro256pp(Uint64 seed = 0) noexcept { Seed(seed); }
+
+    // state must not be all zero.
+    constexpr explicit Xoshiro256pp(const State& state) noexcept : m_state(state) {}
+
+    constexpr void Seed(Uint64 seed) noexcept
+    {
+        for (Uint64& word : m_state)
+        {
+            seed += 0x9E3779B97F4A7C15ull;
+            word = MixBits64(seed);
+        }
+    }
+
+    [[nodiscard]] constexpr const State& GetState() const noexcept { return m_state; }
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+    [[nodiscard]] static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type operator()() noexcept
+    {
+        const Uint64 result = std::rotl(m_state[0] + m_state[3], 23) + m_state[0];
+        const Uint64 shifted = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= shifted;
+        m_state[3] = std::rotl(m_state[3], 45);
+        return result;
+    }
+
+    // Equivalent to 2^128 calls; yields 2^128 non-overlapping streams of 2^128 outputs.
+    constexpr void Jump() noexcept
+    {
+        ApplyJump({0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull,
+                   0x39ABDC4529B1661Cull});
+    }
+
+    // Equivalent to 2^192 calls, for splitting streams that are themselves split with Jump.
+    constexpr void LongJump() noexcept
+    {
+        ApplyJump({0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull,
+                   0x39109BB02ACBE635ull});
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Xoshiro256pp&) const noexcept = default;
+
+private:
+    constexpr void ApplyJump(const State& polynomial) noexcept
+    {
+        State state = {};
+        for (const Uint64 word : polynomial)
+        {
+            for (int bit = 0; bit < 64; ++bit)
+            {
+                if ((word >> bit) & 1)
+                {
+                    for (std::size_t index = 0; index < state.size(); ++index)
+                    {
+                        state[index] ^= m_state[index];
+                    }
+                }
+                (*this)();
+            }
+        }
+        m_state = state;
+    }
+
+    State m_state = {};
+}; // class Xoshiro256pp
+
+// The calling thread's engine, seeded from os::urandom on first use. Throws if the operating
+// system cannot provide entropy.
+[[nodiscard]] Xoshiro256pp& GetThreadRandomEngine();
+
+// Eight Xoshiro256pp streams, each one Jump apart, advanced in lockstep so that bulk generation
+// runs on SIMD registers. For a given seed the output is the same at every SimdLevel, except
+// that FillUniform with a custom range and FillNormal may differ in the last bit.
+//
+// Each call consumes whole blocks of eight 64-bit outputs; the unused rest of the last block is
+// discarded. Fill(Span<Uint32>) splits every 64-bit output into its low and high halves.
+class BulkRandom
+{
+public:
+    static constexpr std::size_t LaneCount = 8;
+
+    // Seeds from GetThreadRandomEngine.
+    BulkRandom();
+    explicit BulkRandom(Uint64 seed) noexcept : BulkRandom(Xoshiro256pp(seed)) {}
+    // Lane i starts from engine advanced by i jumps.
+    explicit BulkRandom(Xoshiro256pp engine) noexcept;
+
+    void Fill(Span<Uint64> values) noexcept;
+    void Fill(Span<Uint32> values) noexcept;
+
+    // Uniform in [low, high) with 24 bits of resolution; requires low < high.
+    void FillUniform(Span<float> values, float low = 0.0f, float high = 1.0f) noexcept;
+
+    // Normally distributed, by the Box-Muller transform of pairs of 24-bit uniforms. log, sin and
+    // cos use polynomial approximations accurate to a few ulps.
+    void FillNormal(Span<float> values, float mean = 0.0f, float stddev = 1.0f) noexcept;
+
+private:
+    // m_state[word * LaneCount + lane] is word of lane's Xoshiro256pp state.
+    alignas(64) std::array<Uint64, 4 * LaneCount> m_state;
+}; // class BulkRandom
+
 } // namespace rad
@@ -0,0 +1,264 @@
+#include <rad/Core/Random.h>
+#include <rad/System/CpuInfo.h>
+
+#include <gtest/gtest.h>
+
+#include <pcg_random.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+static_assert(std::uniform_random_bit_generator<rad::Pcg32>);
+static_assert(std::uniform_random_bit_generator<rad::Pcg64>);
+static_assert(std::uniform_random_bit_generator<rad::Xoshiro256pp>);
+
+namespace
+{
+
+// Reference xoshiro256++ from https://prng.di.unimi.it/xoshiro256plusplus.c.
+struct ReferenceXoshiro
+{
+    std::uint64_t s[4];
+
+    static std::uint64_t Rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t Next()
+    {
+        const std::uint64_t result = Rotl(s[0] + s[3], 23) + s[0];
+        const std::uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = Rotl(s[3], 45);
+        return result;
+    }
+
+    void Jump()
+    {
+        static const std::uint64_t JUMP[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                             0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+        std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            for (int b = 0; b < 64; b++)
+            {
+                if (JUMP[i] & UINT64_C(1) << b)
+                {
+                    s0 ^= s[0];
+                    s1 ^= s[1];
+                    s2 ^= s[2];
+                    s3 ^= s[3];
+                }
+                Next();
+            }
+        }
+        s[0] = s0;
+        s[1] = s1;
+        s[2] = s2;
+        s[3] = s3;
+    }
+};
+
+constexpr std::array<rad::SimdLevel, 5> AllSimdLevels = {
+    rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2, rad::SimdLevel::AVX2, rad::SimdLevel::AVX512,
+    rad::SimdLevel::NEON};
+
+} // namespace
+
+TEST(Core, RandomPcgMatchesReference)
+{
+    pcg32 reference32;
+    rad::Pcg32 engine32;
+    pcg32 streamReference32(42, 54);
+    rad::Pcg32 stream32(42, 54);
+    pcg64 reference64;
+    rad::Pcg64 engine64;
+    pcg64 streamReference64(42, 54);
+    rad::Pcg64 stream64(42, 54);
+    for (int index = 0; index < 1000; ++index)
+    {
+        ASSERT_EQ(engine32(), reference32());
+        ASSERT_EQ(stream32(), streamReference32());
+        ASSERT_EQ(engine64(), reference64());
+        ASSERT_EQ(stream64(), streamReference64());
+    }
+
+    // Advancing agrees with pcg-cpp for distances far beyond what stepping could check.
+    for (const std::uint64_t delta : {1ull, 1000ull, 0x123456789ABCDEFull, ~0ull})
+    {
+        engine32.Advance(delta);
+        reference32.advance(delta);
+        EXPECT_EQ(engine32(), reference32());
+        engine64.Advance(delta);
+        reference64.advance(delta);
+        EXPECT_EQ(engine64(), reference64());
+    }
+
+    rad::Pcg32 stepped(7);
+    rad::Pcg32 advanced(7);
+    for (int index = 0; index < 100; ++index)
+    {
+        static_cast<void>(stepped());
+    }
+    advanced.Advance(100);
+    EXPECT_EQ(stepped, advanced);
+    // Advancing by -n steps back.
+    advanced.Advance(~0ull - 99);
+    EXPECT_EQ(advanced, rad::Pcg32(7));
+}
+
+TEST(Core, RandomXoshiroMatchesReference)
+{
+    rad::Xoshiro256pp engine(12345);
+    ReferenceXoshiro reference = {};
+    std::copy_n(engine.GetState().begin(), 4, reference.s);
+    for (int index = 0; index < 1000; ++index)
+    {
+        ASSERT_EQ(engine(), reference.Next());
+    }
+    engine.Jump();
+    reference.Jump();
+    for (int index = 0; index < 100; ++index)
+    {
+        ASSERT_EQ(engine(), reference.Next());
+    }
+
+    rad::Xoshiro256pp jumped(1);
+    jumped.Jump();
+    rad::Xoshiro256pp longJumped(1);
+    longJumped.LongJump();
+    EXPECT_NE(jumped, rad::Xoshiro256pp(1));
+    EXPECT_NE(jumped, longJumped);
+
+    // The thread engine is seeded once per thread.
+    rad::Xoshiro256pp& threadEngine = rad::GetThreadRandomEngine();
+    EXPECT_EQ(&threadEngine, &rad::GetThreadRandomEngine());
+    EXPECT_NE(threadEngine(), threadEngine());
+}
+
+TEST(Core, BulkRandomMatchesLanes)
+{
+    // Lane i of every block continues the stream of the seed engine after i jumps.
+    std::vector<rad::Xoshiro256pp> lanes;
+    rad::Xoshiro256pp engine(99);
+    for (std::size_t lane = 0; lane < rad::BulkRandom::LaneCount; ++lane)
+    {
+        lanes.push_back(engine);
+        engine.Jump();
+    }
+    std::vector<std::uint64_t> expected(rad::BulkRandom::LaneCount * 40);
+    for (std::size_t index = 0; index < expected.size(); ++index)
+    {
+        expected[index] = lanes[index % rad::BulkRandom::LaneCount]();
+    }
+
+    for (const rad::SimdLevel level : AllSimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        rad::BulkRandom random(rad::Xoshiro256pp(99));
+        std::vector<std::uint64_t> values(expected.size() / 2 - 3);
+        random.Fill(values);
+        // The partial block's unused outputs are discarded.
+        std::vector<std::uint64_t> next(expected.size() / 2);
+        random.Fill(next);
+        values.resize(expected.size() / 2);
+        values.insert(values.end(), next.begin(), next.end());
+        for (std::size_t index = 0; index < expected.size(); ++index)
+        {
+            if (index < expected.size() / 2 - 3 || index >= expected.size() / 2)
+            {
+                ASSERT_EQ(values[index], expected[index])
+                    << "level " << static_cast<int>(level) << ", index " << index;
+            }
+        }
+
+        rad::BulkRandom random32(rad::Xoshiro256pp(99));
+        std::vector<std::uint32_t> halves(2 * expected.size());
+        random32.Fill(halves);
+        for (std::size_t index = 0; index < expected.size(); ++index)
+        {
+            ASSERT_EQ(halves[2 * index], static_cast<std::uint32_t>(expected[index]));
+            ASSERT_EQ(halves[2 * index + 1], static_cast<std::uint32_t>(expected[index] >> 32));
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, BulkRandomFloats)
+{
+    constexpr std::size_t Count = 1 << 20;
+    std::vector<float> scalarUniform(Count + 5);
+    std::vector<float> scalarNormal(Count + 5);
+    std::vector<std::uint32_t> bits(Count + 5);
+    rad::SetSimdLevelLimit(rad::SimdLevel::Scalar);
+    rad::BulkRandom(7).Fill(bits);
+    rad::BulkRandom(7).FillUniform(scalarUniform);
+    rad::BulkRandom(7).FillNormal(scalarNormal);
+
+    for (std::size_t index = 0; index < bits.size(); ++index)
+    {
+        ASSERT_EQ(scalarUniform[index], rad::ToUnitFloat(bits[index]));
+    }
+
+    // Moments of the standard normal: mean 0, variance 1, kurtosis 3.
+    double sum = 0;
+    double squares = 0;
+    double fourthPowers = 0;
+    for (const float value : scalarNormal)
+    {
+        ASSERT_TRUE(std::isfinite(value));
+        sum += value;
+        squares += double(value) * value;
+        fourthPowers += double(value) * value * value * value;
+    }
+    const double size = static_cast<double>(scalarNormal.size());
+    EXPECT_NEAR(sum / size, 0.0, 0.005);
+    EXPECT_NEAR(squares / size, 1.0, 0.005);
+    EXPECT_NEAR(fourthPowers / size, 3.0, 0.05);
+
+    // Box-Muller of the same bits with the standard library's functions.
+    for (std::size_t index = 0; index + 1 < bits.size(); index += 2)
+    {
+        const double uniform = ((bits[index] >> 8) + 1) * 0x1p-24;
+        const double radius = std::sqrt(-2.0 * std::log(uniform));
+        const double angle = 2.0 * 3.14159265358979323846 * (bits[index + 1] >> 8) * 0x1p-24;
+        ASSERT_NEAR(scalarNormal[index], radius * std::cos(angle), 2e-6 * (1 + radius));
+        ASSERT_NEAR(scalarNormal[index + 1], radius * std::sin(angle), 2e-6 * (1 + radius));
+    }
+
+    std::vector<float> ranged(Count);
+    rad::BulkRandom(3).FillUniform(ranged, 1.0f, 2.0f);
+    EXPECT_GE(*std::min_element(ranged.begin(), ranged.end()), 1.0f);
+    EXPECT_LT(*std::max_element(ranged.begin(), ranged.end()), 2.0f);
+
+    for (const rad::SimdLevel level : AllSimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        std::vector<float> uniform(scalarUniform.size());
+        rad::BulkRandom(7).FillUniform(uniform);
+        EXPECT_EQ(uniform, scalarUniform) << "level " << static_cast<int>(level);
+        std::vector<float> normal(scalarNormal.size());
+        rad::BulkRandom(7).FillNormal(normal, 1.0f, 2.0f);
+        for (std::size_t index = 0; index < normal.size(); ++index)
+        {
+            ASSERT_NEAR(normal[index], 1.0f + 2.0f * scalarNormal[index], 1e-5f)
+                << "level " << static_cast<int>(level) << ", index " << index;
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
@@ -0,0 +1,202 @@
+#include <rad/Core/UnormConvert.h>
+#include <rad/System/CpuInfo.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// One 1024x1024 RGBA image.
+constexpr std::size_t ElementCount = 1 << 22;
+constexpr std::size_t ChannelCount = 4;
+
+std::vector<std::uint8_t> MakeUnorm8Values()
+{
+    std::mt19937 random(3);
+    std::vector<std::uint8_t> values(ElementCount);
+    for (std::uint8_t& value : values)
+    {
+        value = static_cast<std::uint8_t>(random());
+    }
+    return values;
+}
+
+std::vector<float> MakeFloat32Values()
+{
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> distribution(-0.1f, 1.1f);
+    std::vector<float> values(ElementCount);
+    for (float& value : values)
+    {
+        value = distribution(random);
+    }
+    return values;
+}
+
+bool ApplySimdLevel(benchmark::State& state)
+{
+    const auto level = static_cast<rad::SimdLevel>(state.range(0));
+    if (!rad::IsSimdLevelSupported(level))
+    {
+        state.SkipWithError("SIMD level not supported");
+        return false;
+    }
+    rad::SetSimdLevelLimit(level);
+    return true;
+}
+
+// Bytes read plus bytes written.
+void SetBytesProcessed(benchmark::State& state)
+{
+    const std::size_t bytes = (sizeof(float) + sizeof(std::uint8_t)) * ElementCount;
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+}
+
+// The argument selects the rad::SimdLevel limit.
+void BM_ConvertUnorm8ToFloat32(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<std::uint8_t> values = MakeUnorm8Values();
+    std::vector<float> converted(ElementCount);
+    for (auto _ : state)
+    {
+        rad::ConvertUnorm8ToFloat32(values, converted);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// The per-element lambdas Image used before the bulk conversions.
+void BM_ConvertUnorm8ToFloat32Transform(benchmark::State& state)
+{
+    const std::vector<std::uint8_t> values = MakeUnorm8Values();
+    std::vector<float> converted(ElementCount);
+    for (auto _ : state)
+    {
+        std::transform(values.begin(), values.end(), converted.begin(),
+                       [](std::uint8_t value) { return static_cast<float>(value) / 255.0f; });
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+}
+
+void BM_ConvertFloat32ToUnorm8(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<float> values = MakeFloat32Values();
+    std::vector<std::uint8_t> converted(ElementCount);
+    for (auto _ : state)
+    {
+        rad::ConvertFloat32ToUnorm8(values, converted);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void BM_ConvertFloat32ToUnorm8Transform(benchmark::State& state)
+{
+    const std::vector<float> values = MakeFloat32Values();
+    std::vector<std::uint8_t> converted(ElementCount);
+    for (auto _ : state)
+    {
+        std::transform(values.begin(), values.end(), converted.begin(),
+                       [](float value)
+                       {
+                           value = std::isnan(value) ? 0.0f : std::clamp(value, 0.0f, 1.0f);
+                           return static_cast<std::uint8_t>(std::lround(value * 255.0f));
+                       });
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+}
+
+void BM_ConvertUnorm8ToFloat32Normalized(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const float mean[ChannelCount] = {0.485f, 0.456f, 0.406f, 0.5f};
+    const float stddev[ChannelCount] = {0.229f, 0.224f, 0.225f, 0.25f};
+    const std::vector<std::uint8_t> values = MakeUnorm8Values();
+    std::vector<float> converted(ElementCount);
+    for (auto _ : state)
+    {
+        rad::ConvertUnorm8ToFloat32Normalized(values, ChannelCount, mean, stddev, converted);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+// The two-pass reference: convert, then standardize in place.
+void BM_ConvertUnorm8ToFloat32NormalizedTwoPass(benchmark::State& state)
+{
+    const float mean[ChannelCount] = {0.485f, 0.456f, 0.406f, 0.5f};
+    const float stddev[ChannelCount] = {0.229f, 0.224f, 0.225f, 0.25f};
+    const std::vector<std::uint8_t> values = MakeUnorm8Values();
+    std::vector<float> converted(ElementCount);
+    for (auto _ : state)
+    {
+        std::transform(values.begin(), values.end(), converted.begin(),
+                       [](std::uint8_t value) { return static_cast<float>(value) / 255.0f; });
+        for (std::size_t index = 0; index < ElementCount; ++index)
+        {
+            const std::size_t channel = index % ChannelCount;
+            converted[index] = (converted[index] - mean[channel]) / stddev[channel];
+        }
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+}
+
+void BM_ConvertUnorm8ToFloat32Premultiplied(benchmark::State& state)
+{
+    if (!ApplySimdLevel(state))
+    {
+        return;
+    }
+    const std::vector<std::uint8_t> values = MakeUnorm8Values();
+    std::vector<float> converted(ElementCount);
+    for (auto _ : state)
+    {
+        rad::ConvertUnorm8ToFloat32Premultiplied(values, ChannelCount, converted);
+        benchmark::ClobberMemory();
+    }
+    SetBytesProcessed(state);
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+void SimdLevels(benchmark::internal::Benchmark* benchmark)
+{
+    for (const rad::SimdLevel level : {rad::SimdLevel::Scalar, rad::SimdLevel::AVX2,
+                                       rad::SimdLevel::AVX512, rad::SimdLevel::NEON})
+    {
+        benchmark->Arg(static_cast<std::int64_t>(level));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ConvertUnorm8ToFloat32)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertUnorm8ToFloat32Transform);
+BENCHMARK(BM_ConvertFloat32ToUnorm8)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertFloat32ToUnorm8Transform);
+BENCHMARK(BM_ConvertUnorm8ToFloat32Normalized)->Apply(SimdLevels);
+BENCHMARK(BM_ConvertUnorm8ToFloat32NormalizedTwoPass);
+BENCHMARK(BM_ConvertUnorm8ToFloat32Premultiplied)->Apply(SimdLevels);
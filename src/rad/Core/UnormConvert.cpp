@@ -0,0 +1,584 @@
+#include <rad/Core/UnormConvert.h>
+#include <rad/Core/Platform.h>
+#include <rad/System/CpuInfo.h>
+
+#if defined(RAD_ARCH_X86)
+#include <immintrin.h>
+#elif defined(RAD_ARCH_AARCH64)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace rad
+{
+
+namespace
+{
+
+// Kernels convert a prefix of whole vectors, or of whole blocks of pixels for the pixel variants,
+// and return how many values they consumed; the scalar loops finish the rest.
+using Unorm8ToFloat32Kernel = std::size_t (*)(const Uint8* input, Float32* output,
+                                              std::size_t size) noexcept;
+using Float32ToUnorm8Kernel = std::size_t (*)(const Float32* input, Uint8* output,
+                                              std::size_t size) noexcept;
+// scales and biases hold the coefficients of each lane; see MakeLaneCoefficients.
+using NormalizeKernel = std::size_t (*)(const Uint8* input, Float32* output, std::size_t size,
+                                        std::size_t channelCount, const Float32* scales,
+                                        const Float32* biases) noexcept;
+
+constexpr Float32 Reciprocal255 = 1.0f / 255.0f;
+
+// Every UNORM8 value divided by 255.
+constexpr std::array<Float32, 256> Unorm8ToFloat32Table = []()
+{
+    std::array<Float32, 256> table = {};
+    for (std::size_t value = 0; value < table.size(); ++value)
+    {
+        table[value] = static_cast<Float32>(value) / 255.0f;
+    }
+    return table;
+}();
+
+[[nodiscard]] inline Uint8 ToUnorm8(Float32 value) noexcept
+{
+    // std::max returns its first argument when the comparison is false, which maps NaN to zero.
+    const Float32 scaled = std::min(std::max(0.0f, value * 255.0f), 255.0f);
+    // Rounds half away from zero like std::lround; the fraction is exact, and unlike
+    // scaled + 0.5 it cannot round up to the next integer.
+    const auto truncated = static_cast<Uint32>(scaled);
+    const Float32 fraction = scaled - static_cast<Float32>(truncated);
+    return static_cast<Uint8>(truncated + (fraction >= 0.5f ? 1 : 0));
+}
+
+void Unorm8ToFloat32Scalar(const Uint8* input, Float32* output, std::size_t size) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        output[index] = Unorm8ToFloat32Table[input[index]];
+    }
+}
+
+void Float32ToUnorm8Scalar(const Float32* input, Uint8* output, std::size_t size) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        output[index] = ToUnorm8(input[index]);
+    }
+}
+
+// input and output start at the first channel of a pixel.
+void NormalizeScalar(const Uint8* input, Float32* output, std::size_t size,
+                     std::size_t channelCount, const Float32* scales,
+                     const Float32* biases) noexcept
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        const std::size_t channel = index % channelCount;
+        output[index] =
+            std::fma(static_cast<Float32>(input[index]), scales[channel], biases[channel]);
+    }
+}
+
+void PremultiplyScalar(const Uint8* input, Float32* output, std::size_t size,
+                       std::size_t channelCount) noexcept
+{
+    for (std::size_t pixel = 0; pixel < size; pixel += channelCount)
+    {
+        const Float32 alpha = Unorm8ToFloat32Table[input[pixel + channelCount - 1]];
+        for (std::size_t channel = 0; channel + 1 < channelCount; ++channel)
+        {
+            output[pixel + channel] = Unorm8ToFloat32Table[input[pixel + channel]] * alpha;
+        }
+        output[pixel + channelCount - 1] = alpha;
+    }
+}
+
+// Lane coefficients for kernels that process blocks of channelCount vectors of up to 16 lanes:
+// a block holds whole pixels, so lane i of a block always belongs to channel i % channelCount.
+struct LaneCoefficients
+{
+    alignas(64) Float32 scales[4 * 16];
+    alignas(64) Float32 biases[4 * 16];
+};
+
+[[nodiscard]] LaneCoefficients MakeLaneCoefficients(std::size_t channelCount,
+                                                    const Float32* scales,
+                                                    const Float32* biases) noexcept
+{
+    LaneCoefficients coefficients;
+    for (std::size_t lane = 0; lane < std::size(coefficients.scales); ++lane)
+    {
+        coefficients.scales[lane] = scales[lane % channelCount];
+        coefficients.biases[lane] = biases[lane % channelCount];
+    }
+    return coefficients;
+}
+
+#if defined(RAD_ARCH_X86)
+
+// Correctly rounded value / 255 for the integers 0 to 255. The product with the rounded
+// reciprocal is one ulp off for about half of them; one correction step on the exact residual
+// fixes every case.
+RAD_TARGET_AVX2 inline __m256 DivideBy255Avx2(__m256 value) noexcept
+{
+    const __m256 reciprocal = _mm256_set1_ps(Reciprocal255);
+    const __m256 quotient = _mm256_mul_ps(value, reciprocal);
+    const __m256 residual = _mm256_fnmadd_ps(quotient, _mm256_set1_ps(255.0f), value);
+    return _mm256_fmadd_ps(residual, reciprocal, quotient);
+}
+
+RAD_TARGET_AVX2 inline __m256 LoadUnorm8Avx2(const Uint8* input) noexcept
+{
+    return _mm256_cvtepi32_ps(
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input))));
+}
+
+// Matches ToUnorm8 lane by lane, returning 32-bit integers.
+RAD_TARGET_AVX2 inline __m256i ToUnorm8Avx2(__m256 value) noexcept
+{
+    // MAXPS returns its second operand when either is NaN.
+    const __m256 scaled =
+        _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(value, _mm256_set1_ps(255.0f)),
+                                    _mm256_setzero_ps()),
+                      _mm256_set1_ps(255.0f));
+    const __m256i truncated = _mm256_cvttps_epi32(scaled);
+    const __m256 fraction = _mm256_sub_ps(scaled, _mm256_cvtepi32_ps(truncated));
+    // The comparison yields -1 in the lanes that round up.
+    const __m256 roundsUp = _mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ);
+    return _mm256_sub_epi32(truncated, _mm256_castps_si256(roundsUp));
+}
+
+RAD_TARGET_AVX2 std::size_t Unorm8ToFloat32Avx2(const Uint8* input, Float32* output,
+                                                std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        _mm256_storeu_ps(output + offset, DivideBy255Avx2(LoadUnorm8Avx2(input + offset)));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX2 std::size_t Float32ToUnorm8Avx2(const Float32* input, Uint8* output,
+                                                std::size_t size) noexcept
+{
+    // Packing interleaves the 128-bit halves; the permutation restores element order.
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    std::size_t offset = 0;
+    for (; size - offset >= 32; offset += 32)
+    {
+        const __m256i values01 =
+            _mm256_packus_epi32(ToUnorm8Avx2(_mm256_loadu_ps(input + offset)),
+                                ToUnorm8Avx2(_mm256_loadu_ps(input + offset + 8)));
+        const __m256i values23 =
+            _mm256_packus_epi32(ToUnorm8Avx2(_mm256_loadu_ps(input + offset + 16)),
+                                ToUnorm8Avx2(_mm256_loadu_ps(input + offset + 24)));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + offset),
+            _mm256_permutevar8x32_epi32(_mm256_packus_epi16(values01, values23), order));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX2 std::size_t NormalizeAvx2(const Uint8* input, Float32* output, std::size_t size,
+                                          std::size_t channelCount, const Float32* scales,
+                                          const Float32* biases) noexcept
+{
+    const std::size_t blockSize = 8 * channelCount;
+    std::size_t offset = 0;
+    for (; size - offset >= blockSize; offset += blockSize)
+    {
+        for (std::size_t lane = 0; lane < blockSize; lane += 8)
+        {
+            const std::size_t index = offset + lane;
+            _mm256_storeu_ps(output + index, _mm256_fmadd_ps(LoadUnorm8Avx2(input + index),
+                                                             _mm256_load_ps(scales + lane),
+                                                             _mm256_load_ps(biases + lane)));
+        }
+    }
+    return offset;
+}
+
+// Two RGBA or four YA pixels per vector.
+template <std::size_t ChannelCount>
+RAD_TARGET_AVX2 std::size_t PremultiplyAvx2(const Uint8* input, Float32* output,
+                                            std::size_t size) noexcept
+{
+    constexpr int AlphaLanes = ChannelCount == 4 ? 0x88 : 0xAA;
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const __m256 value = DivideBy255Avx2(LoadUnorm8Avx2(input + offset));
+        const __m256 alpha = ChannelCount == 4
+                                 ? _mm256_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3))
+                                 : _mm256_movehdup_ps(value);
+        _mm256_storeu_ps(output + offset,
+                         _mm256_blend_ps(_mm256_mul_ps(value, alpha), value, AlphaLanes));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX512 inline __m512 DivideBy255Avx512(__m512 value) noexcept
+{
+    const __m512 reciprocal = _mm512_set1_ps(Reciprocal255);
+    const __m512 quotient = _mm512_mul_ps(value, reciprocal);
+    const __m512 residual = _mm512_fnmadd_ps(quotient, _mm512_set1_ps(255.0f), value);
+    return _mm512_fmadd_ps(residual, reciprocal, quotient);
+}
+
+RAD_TARGET_AVX512 inline __m512 LoadUnorm8Avx512(const Uint8* input) noexcept
+{
+    return _mm512_maskz_cvtepi32_ps(
+        AllLanes32, _mm512_maskz_cvtepu8_epi32(
+                        AllLanes32, _mm_loadu_si128(reinterpret_cast<const __m128i*>(input))));
+}
+
+RAD_TARGET_AVX512 inline __m128i ToUnorm8Avx512(__m512 value) noexcept
+{
+    const __m512 scaled = _mm512_maskz_min_ps(
+        AllLanes32,
+        _mm512_maskz_max_ps(AllLanes32, _mm512_mul_ps(value, _mm512_set1_ps(255.0f)),
+                            _mm512_setzero_ps()),
+        _mm512_set1_ps(255.0f));
+    const __m512i truncated = _mm512_maskz_cvttps_epi32(AllLanes32, scaled);
+    const __m512 fraction =
+        _mm512_sub_ps(scaled, _mm512_maskz_cvtepi32_ps(AllLanes32, truncated));
+    const __mmask16 roundsUp = _mm512_cmp_ps_mask(fraction, _mm512_set1_ps(0.5f), _CMP_GE_OQ);
+    return _mm512_maskz_cvtepi32_epi8(
+        AllLanes32, _mm512_mask_add_epi32(truncated, roundsUp, truncated, _mm512_set1_epi32(1)));
+}
+
+RAD_TARGET_AVX512 std::size_t Unorm8ToFloat32Avx512(const Uint8* input, Float32* output,
+                                                    std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        _mm512_storeu_ps(output + offset, DivideBy255Avx512(LoadUnorm8Avx512(input + offset)));
+    }
+    return offset + Unorm8ToFloat32Avx2(input + offset, output + offset, size - offset);
+}
+
+RAD_TARGET_AVX512 std::size_t Float32ToUnorm8Avx512(const Float32* input, Uint8* output,
+                                                    std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset),
+                         ToUnorm8Avx512(_mm512_loadu_ps(input + offset)));
+    }
+    return offset;
+}
+
+RAD_TARGET_AVX512 std::size_t NormalizeAvx512(const Uint8* input, Float32* output,
+                                              std::size_t size, std::size_t channelCount,
+                                              const Float32* scales, const Float32* biases) noexcept
+{
+    const std::size_t blockSize = 16 * channelCount;
+    std::size_t offset = 0;
+    for (; size - offset >= blockSize; offset += blockSize)
+    {
+        for (std::size_t lane = 0; lane < blockSize; lane += 16)
+        {
+            const std::size_t index = offset + lane;
+            _mm512_storeu_ps(output + index, _mm512_fmadd_ps(LoadUnorm8Avx512(input + index),
+                                                             _mm512_load_ps(scales + lane),
+                                                             _mm512_load_ps(biases + lane)));
+        }
+    }
+    return offset + NormalizeAvx2(input + offset, output + offset, size - offset, channelCount,
+                                  scales, biases);
+}
+
+template <std::size_t ChannelCount>
+RAD_TARGET_AVX512 std::size_t PremultiplyAvx512(const Uint8* input, Float32* output,
+                                                std::size_t size) noexcept
+{
+    constexpr __mmask16 AlphaLanes = ChannelCount == 4 ? 0x8888 : 0xAAAA;
+    std::size_t offset = 0;
+    for (; size - offset >= 16; offset += 16)
+    {
+        const __m512 value = DivideBy255Avx512(LoadUnorm8Avx512(input + offset));
+        const __m512 alpha = ChannelCount == 4
+                                 ? _mm512_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3))
+                                 : _mm512_maskz_movehdup_ps(AllLanes32, value);
+        _mm512_storeu_ps(output + offset,
+                         _mm512_mask_mov_ps(_mm512_mul_ps(value, alpha), AlphaLanes, value));
+    }
+    return offset + PremultiplyAvx2<ChannelCount>(input + offset, output + offset, size - offset);
+}
+
+#elif defined(RAD_ARCH_AARCH64)
+
+inline float32x4_t DivideBy255Neon(float32x4_t value) noexcept
+{
+    const float32x4_t reciprocal = vdupq_n_f32(Reciprocal255);
+    const float32x4_t quotient = vmulq_f32(value, reciprocal);
+    const float32x4_t residual = vfmsq_f32(value, quotient, vdupq_n_f32(255.0f));
+    return vfmaq_f32(quotient, residual, reciprocal);
+}
+
+inline void LoadUnorm8Neon(uint8x8_t bytes, float32x4_t& low, float32x4_t& high) noexcept
+{
+    const uint16x8_t halves = vmovl_u8(bytes);
+    low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(halves)));
+    high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(halves)));
+}
+
+inline uint16x4_t ToUnorm8Neon(float32x4_t value) noexcept
+{
+    // FMAXNM returns the number when the other operand is NaN.
+    const float32x4_t scaled = vminq_f32(
+        vmaxnmq_f32(vmulq_n_f32(value, 255.0f), vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+    // FCVTAU rounds half away from zero, like std::lround.
+    return vmovn_u32(vcvtaq_u32_f32(scaled));
+}
+
+std::size_t Unorm8ToFloat32Neon(const Uint8* input, Float32* output, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        float32x4_t low, high;
+        LoadUnorm8Neon(vld1_u8(input + offset), low, high);
+        vst1q_f32(output + offset, DivideBy255Neon(low));
+        vst1q_f32(output + offset + 4, DivideBy255Neon(high));
+    }
+    return offset;
+}
+
+std::size_t Float32ToUnorm8Neon(const Float32* input, Uint8* output, std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+    for (; size - offset >= 8; offset += 8)
+    {
+        const uint16x8_t values = vcombine_u16(ToUnorm8Neon(vld1q_f32(input + offset)),
+                                               ToUnorm8Neon(vld1q_f32(input + offset + 4)));
+        vst1_u8(output + offset, vmovn_u16(values));
+    }
+    return offset;
+}
+
+std::size_t NormalizeNeon(const Uint8* input, Float32* output, std::size_t size,
+                          std::size_t channelCount, const Float32* scales,
+                          const Float32* biases) noexcept
+{
+    const std::size_t blockSize = 8 * channelCount;
+    std::size_t offset = 0;
+    for (; size - offset >= blockSize; offset += blockSize)
+    {
+        for (std::size_t lane = 0; lane < blockSize; lane += 8)
+        {
+            const std::size_t index = offset + lane;
+            float32x4_t low, high;
+            LoadUnorm8Neon(vld1_u8(input + index), low, high);
+            vst1q_f32(output + index,
+                      vfmaq_f32(vld1q_f32(biases + lane), low, vld1q_f32(scales + lane)));
+            vst1q_f32(output + index + 4,
+                      vfmaq_f32(vld1q_f32(biases + lane + 4), high, vld1q_f32(scales + lane + 4)));
+        }
+    }
+    return offset;
+}
+
+// Eight pixels per iteration, deinterleaved into one vector per channel.
+template <std::size_t ChannelCount>
+std::size_t PremultiplyNeon(const Uint8* input, Float32* output, std::size_t size) noexcept
+{
+    constexpr std::size_t BlockSize = 8 * ChannelCount;
+    std::size_t offset = 0;
+    for (; size - offset >= BlockSize; offset += BlockSize)
+    {
+        float32x4_t low[ChannelCount], high[ChannelCount];
+        if constexpr (ChannelCount == 4)
+        {
+            const uint8x8x4_t pixels = vld4_u8(input + offset);
+            for (std::size_t channel = 0; channel < ChannelCount; ++channel)
+            {
+                LoadUnorm8Neon(pixels.val[channel], low[channel], high[channel]);
+            }
+        }
+        else
+        {
+            const uint8x8x2_t pixels = vld2_u8(input + offset);
+            for (std::size_t channel = 0; channel < ChannelCount; ++channel)
+            {
+                LoadUnorm8Neon(pixels.val[channel], low[channel], high[channel]);
+            }
+        }
+        for (std::size_t channel = 0; channel < ChannelCount; ++channel)
+        {
+            low[channel] = DivideBy255Neon(low[channel]);
+            high[channel] = DivideBy255Neon(high[channel]);
+        }
+        for (std::size_t channel = 0; channel + 1 < ChannelCount; ++channel)
+        {
+            low[channel] = vmulq_f32(low[channel], low[ChannelCount - 1]);
+            high[channel] = vmulq_f32(high[channel], high[ChannelCount - 1]);
+        }
+        if constexpr (ChannelCount == 4)
+        {
+            vst4q_f32(output + offset, float32x4x4_t{{low[0], low[1], low[2], low[3]}});
+            vst4q_f32(output + offset + 16, float32x4x4_t{{high[0], high[1], high[2], high[3]}});
+        }
+        else
+        {
+            vst2q_f32(output + offset, float32x4x2_t{{low[0], low[1]}});
+            vst2q_f32(output + offset + 8, float32x4x2_t{{high[0], high[1]}});
+        }
+    }
+    return offset;
+}
+
+#endif
+
+[[nodiscard]] Unorm8ToFloat32Kernel SelectUnorm8ToFloat32Kernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return Unorm8ToFloat32Avx512;
+    case SimdLevel::AVX2:
+        return Unorm8ToFloat32Avx2;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return Unorm8ToFloat32Neon;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+[[nodiscard]] Float32ToUnorm8Kernel SelectFloat32ToUnorm8Kernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return Float32ToUnorm8Avx512;
+    case SimdLevel::AVX2:
+        return Float32ToUnorm8Avx2;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return Float32ToUnorm8Neon;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+[[nodiscard]] NormalizeKernel SelectNormalizeKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return NormalizeAvx512;
+    case SimdLevel::AVX2:
+        return NormalizeAvx2;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return NormalizeNeon;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+template <std::size_t ChannelCount>
+[[nodiscard]] Unorm8ToFloat32Kernel SelectPremultiplyKernel() noexcept
+{
+    switch (GetSimdLevel())
+    {
+#if defined(RAD_ARCH_X86)
+    case SimdLevel::AVX512:
+        return PremultiplyAvx512<ChannelCount>;
+    case SimdLevel::AVX2:
+        return PremultiplyAvx2<ChannelCount>;
+#elif defined(RAD_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return PremultiplyNeon<ChannelCount>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace
+
+void ConvertUnorm8ToFloat32(Span<const Uint8> input, Span<Float32> output) noexcept
+{
+    assert(output.size() >= input.size());
+    std::size_t offset = 0;
+    if (const Unorm8ToFloat32Kernel kernel = SelectUnorm8ToFloat32Kernel())
+    {
+        offset = kernel(input.data(), output.data(), input.size());
+    }
+    Unorm8ToFloat32Scalar(input.data() + offset, output.data() + offset, input.size() - offset);
+}
+
+void ConvertFloat32ToUnorm8(Span<const Float32> input, Span<Uint8> output) noexcept
+{
+    assert(output.size() >= input.size());
+    std::size_t offset = 0;
+    if (const Float32ToUnorm8Kernel kernel = SelectFloat32ToUnorm8Kernel())
+    {
+        offset = kernel(input.data(), output.data(), input.size());
+    }
+    Float32ToUnorm8Scalar(input.data() + offset, output.data() + offset, input.size() - offset);
+}
+
+void ConvertUnorm8ToFloat32Normalized(Span<const Uint8> input, std::size_t channelCount,
+                                      Span<const Float32> mean, Span<const Float32> stddev,
+                                      Span<Float32> output) noexcept
+{
+    assert(channelCount >= 1 && channelCount <= 4);
+    assert(input.size() % channelCount == 0);
+    assert(mean.size() == channelCount && stddev.size() == channelCount);
+    assert(output.size() >= input.size());
+    Float32 scales[4];
+    Float32 biases[4];
+    for (std::size_t channel = 0; channel < channelCount; ++channel)
+    {
+        scales[channel] = 1.0f / (255.0f * stddev[channel]);
+        biases[channel] = -mean[channel] / stddev[channel];
+    }
+    std::size_t offset = 0;
+    if (const NormalizeKernel kernel = SelectNormalizeKernel())
+    {
+        const LaneCoefficients coefficients = MakeLaneCoefficients(channelCount, scales, biases);
+        offset = kernel(input.data(), output.data(), input.size(), channelCount,
+                        coefficients.scales, coefficients.biases);
+    }
+    NormalizeScalar(input.data() + offset, output.data() + offset, input.size() - offset,
+                    channelCount, scales, biases);
+}
+
+void ConvertUnorm8ToFloat32Premultiplied(Span<const Uint8> input, std::size_t channelCount,
+                                         Span<Float32> output) noexcept
+{
+    assert(channelCount >= 1 && channelCount <= 4);
+    assert(input.size() % channelCount == 0);
+    assert(output.size() >= input.size());
+    if ((channelCount != 2) && (channelCount != 4))
+    {
+        ConvertUnorm8ToFloat32(input, output);
+        return;
+    }
+    std::size_t offset = 0;
+    if (const Unorm8ToFloat32Kernel kernel = channelCount == 4 ? SelectPremultiplyKernel<4>()
+                                                               : SelectPremultiplyKernel<2>())
+    {
+        offset = kernel(input.data(), output.data(), input.size());
+    }
+    PremultiplyScalar(input.data() + offset, output.data() + offset, input.size() - offset,
+                      channelCount);
+}
+
+} // namespace rad
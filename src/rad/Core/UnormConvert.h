@@ -0,0 +1,36 @@
+#pragma once
+
+#include <rad/Core/Float.h>
+#include <rad/Core/Integer.h>
+#include <rad/Core/Span.h>
+
+#include <cstddef>
+
+namespace rad
+{
+
+// Bulk conversions between 8-bit UNORM values and Float32. Results are bit-identical to the
+// scalar formulas below whichever SIMD kernel runs. The output must hold at least input.size()
+// elements. The pixel variants take interleaved pixels of channelCount (1 to 4) channels, and
+// input.size() must be a multiple of channelCount.
+
+// output[i] = input[i] / 255.0f.
+void ConvertUnorm8ToFloat32(Span<const Uint8> input, Span<Float32> output) noexcept;
+
+// output[i] = std::lround(std::clamp(input[i], 0.0f, 1.0f) * 255.0f), with NaN converted to 0.
+void ConvertFloat32ToUnorm8(Span<const Float32> input, Span<Uint8> output) noexcept;
+
+// Standardizes each channel for ML preprocessing: (input / 255 - mean[c]) / stddev[c], evaluated
+// as std::fma(input, 1 / (255 * stddev[c]), -mean[c] / stddev[c]) with the coefficients rounded
+// to Float32. mean and stddev hold one value per channel.
+void ConvertUnorm8ToFloat32Normalized(Span<const Uint8> input, std::size_t channelCount,
+                                      Span<const Float32> mean, Span<const Float32> stddev,
+                                      Span<Float32> output) noexcept;
+
+// Converts straight-alpha YA or RGBA pixels to premultiplied alpha: each color channel becomes
+// (color / 255.0f) * (alpha / 255.0f), and alpha becomes alpha / 255.0f. Y and RGB pixels, which
+// have no alpha, are converted as by ConvertUnorm8ToFloat32.
+void ConvertUnorm8ToFloat32Premultiplied(Span<const Uint8> input, std::size_t channelCount,
+                                         Span<Float32> output) noexcept;
+
+} // namespace rad
@@ -0,0 +1,191 @@
+#include <rad/Core/UnormConvert.h>
+#include <rad/System/CpuInfo.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr rad::SimdLevel SimdLevels[] = {rad::SimdLevel::Scalar, rad::SimdLevel::SSE4_2,
+                                         rad::SimdLevel::AVX2, rad::SimdLevel::AVX512,
+                                         rad::SimdLevel::NEON};
+
+// The formula ImageFloat32::ToUnorm8 has always used.
+std::uint8_t ReferenceToUnorm8(float value)
+{
+    const float clamped = std::isnan(value) ? 0.0f : std::clamp(value, 0.0f, 1.0f);
+    return static_cast<std::uint8_t>(std::lround(clamped * 255.0f));
+}
+
+// Bytes cycling through every value, in a length that is not a multiple of any vector width.
+std::vector<std::uint8_t> MakeUnorm8Inputs(std::size_t size)
+{
+    std::vector<std::uint8_t> inputs(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        inputs[index] = static_cast<std::uint8_t>(index * 7 + index / 256);
+    }
+    return inputs;
+}
+
+// Values a few ulps around every rounding boundary and every exact UNORM8 value, the limits of
+// the clamp, special values and random bit patterns.
+std::vector<float> MakeFloat32Inputs()
+{
+    std::vector<float> inputs;
+    for (int value = 0; value <= 256; ++value)
+    {
+        for (const float center : {(static_cast<float>(value) - 0.5f) / 255.0f,
+                                   static_cast<float>(value) / 255.0f})
+        {
+            const auto bits = std::bit_cast<std::uint32_t>(center);
+            for (std::uint32_t delta = 0; delta <= 8; ++delta)
+            {
+                inputs.push_back(std::bit_cast<float>(bits + delta));
+                inputs.push_back(std::bit_cast<float>(bits - delta));
+            }
+        }
+    }
+    for (const float value :
+         {0.0f, -0.0f, 1.0f, -1.0f, 0x1p-149f, -0x1p-149f, 0.5f / 255.0f, 0.49999997f / 255.0f,
+          std::numeric_limits<float>::max(), std::numeric_limits<float>::infinity(),
+          -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(),
+          -std::numeric_limits<float>::quiet_NaN()})
+    {
+        inputs.push_back(value);
+    }
+    std::mt19937 random(5);
+    for (int index = 0; index < (1 << 16); ++index)
+    {
+        inputs.push_back(std::bit_cast<float>(static_cast<std::uint32_t>(random())));
+    }
+    std::uniform_real_distribution<float> distribution(-0.25f, 1.25f);
+    for (int index = 0; index < (1 << 16); ++index)
+    {
+        inputs.push_back(distribution(random));
+    }
+    return inputs;
+}
+
+void ExpectUnorm8ToFloat32Exact()
+{
+    const std::vector<std::uint8_t> inputs = MakeUnorm8Inputs(1000);
+    for (const std::size_t size : {std::size_t(0), std::size_t(7), std::size_t(100), inputs.size()})
+    {
+        std::vector<float> outputs(size + 1, -1.0f);
+        rad::ConvertUnorm8ToFloat32(rad::Span<const std::uint8_t>(inputs.data(), size), outputs);
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            ASSERT_EQ(std::bit_cast<std::uint32_t>(outputs[index]),
+                      std::bit_cast<std::uint32_t>(static_cast<float>(inputs[index]) / 255.0f))
+                << "value " << int(inputs[index]);
+        }
+        EXPECT_EQ(outputs[size], -1.0f);
+    }
+}
+
+void ExpectFloat32ToUnorm8Exact(const std::vector<float>& inputs)
+{
+    std::vector<std::uint8_t> outputs(inputs.size());
+    rad::ConvertFloat32ToUnorm8(inputs, outputs);
+    for (std::size_t index = 0; index < inputs.size(); ++index)
+    {
+        ASSERT_EQ(outputs[index], ReferenceToUnorm8(inputs[index]))
+            << std::hexfloat << "input " << inputs[index];
+    }
+}
+
+void ExpectNormalizedExact(std::size_t channelCount)
+{
+    const float mean[] = {0.485f, 0.456f, 0.406f, 0.5f};
+    const float stddev[] = {0.229f, 0.224f, 0.225f, 0.25f};
+    // 333 pixels leave a tail after every block size.
+    const std::vector<std::uint8_t> inputs = MakeUnorm8Inputs(333 * channelCount);
+    std::vector<float> outputs(inputs.size());
+    rad::ConvertUnorm8ToFloat32Normalized(inputs, channelCount,
+                                          rad::Span<const float>(mean, channelCount),
+                                          rad::Span<const float>(stddev, channelCount), outputs);
+    for (std::size_t index = 0; index < inputs.size(); ++index)
+    {
+        const std::size_t channel = index % channelCount;
+        const float scale = 1.0f / (255.0f * stddev[channel]);
+        const float bias = -mean[channel] / stddev[channel];
+        const float expected = std::fma(static_cast<float>(inputs[index]), scale, bias);
+        ASSERT_EQ(std::bit_cast<std::uint32_t>(outputs[index]),
+                  std::bit_cast<std::uint32_t>(expected))
+            << "index " << index;
+        const float twoPass = (static_cast<float>(inputs[index]) / 255.0f - mean[channel]) /
+                              stddev[channel];
+        EXPECT_NEAR(outputs[index], twoPass, 4.0f * std::numeric_limits<float>::epsilon());
+    }
+}
+
+void ExpectPremultipliedExact(std::size_t channelCount)
+{
+    const std::vector<std::uint8_t> inputs = MakeUnorm8Inputs(333 * channelCount);
+    std::vector<float> outputs(inputs.size());
+    rad::ConvertUnorm8ToFloat32Premultiplied(inputs, channelCount, outputs);
+    const bool hasAlpha = (channelCount == 2) || (channelCount == 4);
+    for (std::size_t pixel = 0; pixel < inputs.size(); pixel += channelCount)
+    {
+        const float alpha = static_cast<float>(inputs[pixel + channelCount - 1]) / 255.0f;
+        for (std::size_t channel = 0; channel < channelCount; ++channel)
+        {
+            float expected = static_cast<float>(inputs[pixel + channel]) / 255.0f;
+            if (hasAlpha && (channel + 1 < channelCount))
+            {
+                expected *= alpha;
+            }
+            ASSERT_EQ(std::bit_cast<std::uint32_t>(outputs[pixel + channel]),
+                      std::bit_cast<std::uint32_t>(expected))
+                << "pixel " << pixel / channelCount << " channel " << channel;
+        }
+    }
+}
+
+} // namespace
+
+TEST(Core, UnormConvertMatchesScalar)
+{
+    const std::vector<float> inputs = MakeFloat32Inputs();
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        SCOPED_TRACE(static_cast<int>(level));
+        ExpectUnorm8ToFloat32Exact();
+        ExpectFloat32ToUnorm8Exact(inputs);
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
+
+TEST(Core, UnormConvertFused)
+{
+    for (const rad::SimdLevel level : SimdLevels)
+    {
+        if (!rad::IsSimdLevelSupported(level))
+        {
+            continue;
+        }
+        rad::SetSimdLevelLimit(level);
+        SCOPED_TRACE(static_cast<int>(level));
+        for (std::size_t channelCount = 1; channelCount <= 4; ++channelCount)
+        {
+            SCOPED_TRACE(channelCount);
+            ExpectNormalizedExact(channelCount);
+            ExpectPremultipliedExact(channelCount);
+        }
+    }
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+}
@@ -0,0 +1,191 @@
+#include <rad/IO/Image.h>
+#include <rad/System/ThreadPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+rad::ImageUnorm8 MakeImage(int size)
+{
+    rad::ImageUnorm8 image{size, size, 4};
+    std::mt19937 random(7);
+    std::uint8_t* data = image.Data();
+    const std::size_t count = static_cast<std::size_t>(size) * static_cast<std::size_t>(size) * 4;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        data[index] = static_cast<std::uint8_t>(random());
+    }
+    return image;
+}
+
+// The first argument is the width and height of the RGBA source, the second the pool's worker
+// count; zero runs the serial Resize. The source is reduced to a 256x256 thumbnail.
+void BM_ResizeThumbnail(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    const auto threadCount = static_cast<std::size_t>(state.range(1));
+    const rad::ImageUnorm8 image = MakeImage(size);
+    rad::ThreadPool pool(threadCount == 0 ? 1 : threadCount);
+    for (auto _ : state)
+    {
+        rad::ImageUnorm8 thumbnail =
+            threadCount == 0 ? image.Resize(256, 256) : image.ResizeParallel(256, 256, pool);
+        benchmark::DoNotOptimize(thumbnail.Data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size) * size);
+}
+
+// Like BM_ResizeThumbnail, reusing one resizer and one destination as a frame loop would.
+void BM_ResizeThumbnailInto(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    const auto threadCount = static_cast<std::size_t>(state.range(1));
+    const rad::ImageUnorm8 image = MakeImage(size);
+    rad::ThreadPool pool(threadCount == 0 ? 1 : threadCount);
+    rad::ImageUnorm8 thumbnail{256, 256, 4};
+    rad::ImageResizer resizer;
+    for (auto _ : state)
+    {
+        if (threadCount == 0)
+        {
+            resizer.Resize(image.View(), thumbnail.View());
+        }
+        else
+        {
+            resizer.ResizeParallel(image.View(), thumbnail.View(), pool);
+        }
+        benchmark::DoNotOptimize(thumbnail.Data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size) * size);
+}
+
+// Doubles a float image, where the output dominates the work.
+void BM_ResizeUpscaleFloat32(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    const auto threadCount = static_cast<std::size_t>(state.range(1));
+    const rad::ImageFloat32 image = MakeImage(size).ToFloat32();
+    rad::ThreadPool pool(threadCount == 0 ? 1 : threadCount);
+    for (auto _ : state)
+    {
+        rad::ImageFloat32 resized = threadCount == 0
+                                        ? image.Resize(size * 2, size * 2)
+                                        : image.ResizeParallel(size * 2, size * 2, pool);
+        benchmark::DoNotOptimize(resized.Data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size) * size * 4);
+}
+
+// Reads the dimensions of an encoded PNG, as a batch job filtering files by size would.
+void BM_ProbePNG(benchmark::State& state)
+{
+    const std::string fileName = "bench-probe.png";
+    if (!MakeImage(static_cast<int>(state.range(0))).SavePNG(fileName))
+    {
+        state.SkipWithError("failed to write the PNG file");
+        return;
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rad::ImageInfo::Probe(fileName));
+    }
+}
+
+void BM_LoadPNG(benchmark::State& state)
+{
+    const std::string fileName = "bench-load.png";
+    if (!MakeImage(static_cast<int>(state.range(0))).SavePNG(fileName))
+    {
+        state.SkipWithError("failed to write the PNG file");
+        return;
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rad::ImageUnorm8::LoadFromFile(fileName));
+    }
+}
+
+// Gradients with sparse noise, which compress about as well as photographs do.
+rad::ImageUnorm8 MakeSmoothImage(int size)
+{
+    rad::ImageUnorm8 image{size, size, 4};
+    std::mt19937 random(7);
+    for (int y = 0; y < size; ++y)
+    {
+        std::uint8_t* pixel = image.Pixel(0, y);
+        for (int x = 0; x < size; ++x, pixel += 4)
+        {
+            const int noise = (random() % 4 == 0) ? static_cast<int>(random() % 8) : 0;
+            pixel[0] = static_cast<std::uint8_t>(x * 255 / size + noise);
+            pixel[1] = static_cast<std::uint8_t>(y * 255 / size + noise);
+            pixel[2] = static_cast<std::uint8_t>((x + y) * 127 / size);
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+// The argument is the compression level; the buffer is reused across iterations.
+void BM_EncodePNG(benchmark::State& state)
+{
+    const rad::ImageUnorm8 image = MakeSmoothImage(2048);
+    std::vector<std::uint8_t> buffer;
+    const rad::PngOptions options{static_cast<int>(state.range(0)), rad::PngFilter::Adaptive};
+    for (auto _ : state)
+    {
+        if (!image.EncodePNG(buffer, options))
+        {
+            state.SkipWithError("failed to encode");
+            return;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * std::int64_t{2048} * 2048 * 4);
+    state.counters["ratio"] = 2048.0 * 2048 * 4 / static_cast<double>(buffer.size());
+}
+
+// The arguments are the compression level and the pool's worker count.
+void BM_EncodePNGParallel(benchmark::State& state)
+{
+    const rad::ImageUnorm8 image = MakeSmoothImage(2048);
+    std::vector<std::uint8_t> buffer;
+    const rad::PngOptions options{static_cast<int>(state.range(0)), rad::PngFilter::Adaptive};
+    rad::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+    {
+        if (!rad::EncodePNGParallel(image.View(), buffer, options, pool))
+        {
+            state.SkipWithError("failed to encode");
+            return;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * std::int64_t{2048} * 2048 * 4);
+    state.counters["ratio"] = 2048.0 * 2048 * 4 / static_cast<double>(buffer.size());
+}
+
+void SizesAndThreadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    for (const std::int64_t size : {1024, 4096})
+    {
+        for (const std::int64_t threadCount : {0, 1, 2, 4, 8})
+        {
+            benchmark->Args({size, threadCount});
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ProbePNG)->Arg(1024);
+BENCHMARK(BM_LoadPNG)->Arg(1024);
+BENCHMARK(BM_EncodePNG)->Arg(1)->Arg(6)->Arg(9);
+BENCHMARK(BM_EncodePNGParallel)->ArgsProduct({{1, 6}, {1, 3, 7}})->UseRealTime();
+BENCHMARK(BM_ResizeThumbnail)->Apply(SizesAndThreadCounts)->UseRealTime();
+BENCHMARK(BM_ResizeThumbnailInto)->Apply(SizesAndThreadCounts)->UseRealTime();
+BENCHMARK(BM_ResizeUpscaleFloat32)->Apply(SizesAndThreadCounts)->UseRealTime();
@@ -1,4 +1,9 @@
 #include <rad/IO/Image.h>
+#include <rad/Core/Crc.h>
+#include <rad/Core/Deflate.h>
+#include <rad/Core/UnormConvert.h>
+#include <rad/System/MappedFile.h>
+#include <rad/System/ParallelCrc.h>
 
 #define STB_IMAGE_STATIC
 #define STB_IMAGE_IMPLEMENTATION
@@ -11,14 +16,21 @@
 #include <stb_image_write.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <climits>
 #include <cmath>
+#include <concepts>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
 
 namespace rad
@@ -97,6 +109,92 @@ namespace
     return ValidateDimensions(width, height, channels, sizeof(float)) && width <= INT_MAX / 4;
 }
 
+[[nodiscard]] bool CanWriteJpeg(int width, int height, int channels, int quality) noexcept
+{
+    constexpr int MaximumDimension = UINT16_MAX;
+    return ((channels == 1) || (channels == 3)) && (quality >= 1) && (quality <= 100) &&
+           ValidateDimensions(width, height, channels, 1, MaximumDimension);
+}
+
+[[nodiscard]] bool CanWriteBmp(int width, int height, int channels) noexcept
+{
+    return (channels != 2) && ValidateBmpDimensions(width, height, channels);
+}
+
+[[nodiscard]] bool CanWriteTga(int width, int height, int channels) noexcept
+{
+    constexpr int MaximumDimension = UINT16_MAX;
+    return ValidateDimensions(width, height, channels, 1, MaximumDimension);
+}
+
+[[nodiscard]] bool CanWriteHdr(int width, int height, int channels,
+                               Span<const float> values) noexcept
+{
+    if (((channels != 1) && (channels != 3)) || (!ValidateHdrDimensions(width, height, channels)))
+    {
+        return false;
+    }
+    constexpr float MaximumValue = 0x1p127f;
+    return std::ranges::none_of(values,
+                                [](float value)
+                                {
+                                    return std::isnan(value) || std::isinf(value) ||
+                                           (value < 0.0f) || (value >= MaximumValue);
+                                });
+}
+
+// Collects what stb_image_write emits. Its callbacks cannot fail, so allocation failures are
+// recorded instead.
+struct BufferWriter
+{
+    std::vector<std::uint8_t>& buffer;
+    bool failed = false;
+};
+
+void WriteToBuffer(void* context, void* data, int size) noexcept
+{
+    auto* writer = static_cast<BufferWriter*>(context);
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    try
+    {
+        writer->buffer.insert(writer->buffer.end(), bytes, bytes + size);
+    }
+    catch (...)
+    {
+        writer->failed = true;
+    }
+}
+
+// Calls write(func, context) with a stbi_write_*_to_func writer that appends to buffer.
+template <typename Write>
+[[nodiscard]] bool EncodeWithStb(std::vector<std::uint8_t>& buffer, Write write) noexcept
+{
+    buffer.clear();
+    BufferWriter writer{buffer};
+    if ((write(&WriteToBuffer, &writer) == 0) || (writer.failed))
+    {
+        buffer.clear();
+        return false;
+    }
+    return true;
+}
+
+[[nodiscard]] bool WriteFile(const std::string& fileName, Span<const std::uint8_t> data) noexcept
+{
+    try
+    {
+        std::ofstream file{std::filesystem::path{fileName}, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+        file.close();
+        return !file.fail();
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
 void ValidateImage(int width, int height, int channels, std::size_t size)
 {
     if (size == 0)
@@ -109,24 +207,75 @@ void ValidateImage(int width, int height, int channels, std::size_t size)
     }
 }
 
-[[nodiscard]] bool HasValidAlpha(const std::vector<float>& data, int channels) noexcept
+[[nodiscard]] bool ValidateRegion(int x, int y, int width, int height, int imageWidth,
+                                  int imageHeight) noexcept
 {
+    return (x >= 0) && (y >= 0) && (width > 0) && (height > 0) && (x <= imageWidth - width) &&
+           (y <= imageHeight - height);
+}
+
+template <typename T>
+void ValidateView(BasicImageView<T> view)
+{
+    if ((view.Empty()) || (view.Data() == nullptr))
+    {
+        throw std::logic_error{"image is empty"};
+    }
+}
+
+template <typename S, typename D>
+void ValidateViews(BasicImageView<S> source, BasicImageView<D> destination)
+{
+    ValidateView(source);
+    ValidateView(destination);
+    if ((source.Width() != destination.Width()) || (source.Height() != destination.Height()) ||
+        (source.Channels() != destination.Channels()))
+    {
+        throw std::invalid_argument{"source and destination dimensions must match"};
+    }
+}
+
+[[nodiscard]] bool HasValidAlpha(ImageView<float> image) noexcept
+{
+    const int channels = image.Channels();
     if ((channels != 2) && (channels != 4))
     {
         return true;
     }
-    for (std::size_t index = static_cast<std::size_t>(channels - 1); index < data.size();
-         index += static_cast<std::size_t>(channels))
+    for (int y = 0; y < image.Height(); ++y)
     {
-        const float alpha = data[index];
-        if ((!std::isfinite(alpha)) || (alpha < 0.0f) || (alpha > 1.0f))
+        const float* row = image.Row(y);
+        for (std::size_t index = static_cast<std::size_t>(channels - 1); index < image.RowSize();
+             index += static_cast<std::size_t>(channels))
         {
-            return false;
+            const float alpha = row[index];
+            if ((!std::isfinite(alpha)) || (alpha < 0.0f) || (alpha > 1.0f))
+            {
+                return false;
+            }
         }
     }
     return true;
 }
 
+// Applies a bulk conversion to whole images, or row by row when either side is strided.
+template <typename S, typename D, typename Function>
+void ConvertRows(ImageView<S> source, MutableImageView<D> destination, Function convert)
+{
+    ValidateViews(source, destination);
+    if ((source.IsContiguous()) && (destination.IsContiguous()))
+    {
+        const std::size_t size = source.RowSize() * static_cast<std::size_t>(source.Height());
+        convert(Span<const S>(source.Data(), size), Span<D>(destination.Data(), size));
+        return;
+    }
+    for (int y = 0; y < source.Height(); ++y)
+    {
+        convert(Span<const S>(source.Row(y), source.RowSize()),
+                Span<D>(destination.Row(y), destination.RowSize()));
+    }
+}
+
 [[nodiscard]] stbir_pixel_layout PixelLayout(int channels)
 {
     switch (channels)
@@ -144,8 +293,494 @@ void ValidateImage(int width, int height, int channels, std::size_t size)
     }
 }
 
+template <typename T>
+constexpr stbir_datatype DataType = std::same_as<T, float> ? STBIR_TYPE_FLOAT : STBIR_TYPE_UINT8;
+
+// stb_image_resize2 takes dimensions and strides in bytes as int.
+template <typename T>
+void ValidateResizeView(ImageView<T> image)
+{
+    ValidateView(image);
+    if ((!ValidateDimensions(image.Width(), image.Height(), image.Channels(), sizeof(T))) ||
+        (image.Stride() > static_cast<std::size_t>(INT_MAX) / sizeof(T)))
+    {
+        throw std::length_error{"image dimensions are too large for stb_image_resize"};
+    }
+}
+
+// The number of bands to split the output rows into with stb_image_resize2's split API. Each
+// band is resized independently, each output row computed exactly as the single-call resize
+// computes it.
+[[nodiscard]] int RequestedSplits(std::int64_t pixelCount, const ThreadPool& pool) noexcept
+{
+    // Splits smaller than this spend a large fraction of their time on the hand-off and on
+    // re-reading the input rows shared with neighboring bands.
+    constexpr std::int64_t MinimumPixelsPerSplit = 256 * 1024;
+    const auto splitLimit = static_cast<std::int64_t>(
+        std::min<std::size_t>(pool.GetThreadCount() + 1, static_cast<std::size_t>(INT_MAX)));
+    return static_cast<int>(
+        std::clamp<std::int64_t>(pixelCount / MinimumPixelsPerSplit, 1, splitLimit));
+}
+
+constexpr std::array<std::uint8_t, 8> PngSignature = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+// Chunk data must be shorter than 2^31 bytes.
+constexpr std::size_t MaxPngChunkSize = 0x7FFFFFFF;
+// Chunk length, type and CRC.
+constexpr std::size_t PngChunkOverhead = 12;
+
+void StoreBigEndian(std::uint8_t* destination, std::uint32_t value) noexcept
+{
+    destination[0] = static_cast<std::uint8_t>(value >> 24);
+    destination[1] = static_cast<std::uint8_t>(value >> 16);
+    destination[2] = static_cast<std::uint8_t>(value >> 8);
+    destination[3] = static_cast<std::uint8_t>(value);
+}
+
+void AppendPngChunk(std::vector<std::uint8_t>& buffer, const char* type,
+                    Span<const std::uint8_t> data)
+{
+    const std::size_t start = buffer.size();
+    buffer.resize(start + data.size() + PngChunkOverhead);
+    std::uint8_t* chunk = buffer.data() + start;
+    StoreBigEndian(chunk, static_cast<std::uint32_t>(data.size()));
+    std::memcpy(chunk + 4, type, 4);
+    if (!data.empty())
+    {
+        std::memcpy(chunk + 8, data.data(), data.size());
+    }
+    StoreBigEndian(chunk + 8 + data.size(), Crc32::Compute(chunk + 4, data.size() + 4));
+}
+
+// Wraps the zlib stream that follows the 8 bytes reserved at buffer[start] in IDAT chunks, in
+// place. Streams longer than a chunk are split, moving each chunk into place from the last to the
+// first so that none overwrites data not yet moved.
+void WrapIdatChunks(std::vector<std::uint8_t>& buffer, std::size_t start, ThreadPool* pool)
+{
+    const std::size_t dataSize = buffer.size() - start - 8;
+    const std::size_t chunkCount = std::max<std::size_t>(
+        (dataSize + MaxPngChunkSize - 1) / MaxPngChunkSize, 1);
+    buffer.resize(start + dataSize + chunkCount * PngChunkOverhead);
+    const std::uint32_t typeCrc = Crc32::Compute("IDAT", 4);
+    for (std::size_t chunk = chunkCount; chunk-- > 0;)
+    {
+        const std::size_t offset = chunk * MaxPngChunkSize;
+        const std::size_t size = std::min(MaxPngChunkSize, dataSize - offset);
+        std::uint8_t* destination = buffer.data() + start + offset + chunk * PngChunkOverhead;
+        if (chunk != 0)
+        {
+            std::memmove(destination + 8, buffer.data() + start + 8 + offset, size);
+        }
+        StoreBigEndian(destination, static_cast<std::uint32_t>(size));
+        std::memcpy(destination + 4, "IDAT", 4);
+        const std::uint32_t dataCrc =
+            pool != nullptr ? ComputeCrcParallel<Crc32>(destination + 8, size, *pool)
+                            : Crc32::Compute(destination + 8, size);
+        StoreBigEndian(destination + 8 + size, Crc32::Combine(typeCrc, dataCrc, size));
+    }
+}
+
+[[nodiscard]] int PaethPredictor(int left, int up, int upLeft) noexcept
+{
+    const int estimate = left + up - upLeft;
+    const int leftDistance = std::abs(estimate - left);
+    const int upDistance = std::abs(estimate - up);
+    const int upLeftDistance = std::abs(estimate - upLeft);
+    if ((leftDistance <= upDistance) && (leftDistance <= upLeftDistance))
+    {
+        return left;
+    }
+    return upDistance <= upLeftDistance ? up : upLeft;
+}
+
+// Filters size bytes of row against previous, the row above or zeros for the first row. The
+// first pixelSize bytes have no left neighbor, which the format takes as zero.
+void FilterRow(PngFilter filter, const std::uint8_t* row, const std::uint8_t* previous,
+               std::size_t size, std::size_t pixelSize, std::uint8_t* output) noexcept
+{
+    const auto store = [&](std::size_t index, int predictor)
+    { output[index] = static_cast<std::uint8_t>(row[index] - predictor); };
+    switch (filter)
+    {
+    case PngFilter::None:
+        std::memcpy(output, row, size);
+        break;
+    case PngFilter::Sub:
+        std::memcpy(output, row, pixelSize);
+        for (std::size_t index = pixelSize; index < size; ++index)
+        {
+            store(index, row[index - pixelSize]);
+        }
+        break;
+    case PngFilter::Up:
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            store(index, previous[index]);
+        }
+        break;
+    case PngFilter::Average:
+        for (std::size_t index = 0; index < pixelSize; ++index)
+        {
+            store(index, previous[index] / 2);
+        }
+        for (std::size_t index = pixelSize; index < size; ++index)
+        {
+            store(index, (row[index - pixelSize] + previous[index]) / 2);
+        }
+        break;
+    case PngFilter::Paeth:
+    case PngFilter::Adaptive:
+        for (std::size_t index = 0; index < pixelSize; ++index)
+        {
+            store(index, previous[index]);
+        }
+        for (std::size_t index = pixelSize; index < size; ++index)
+        {
+            store(index, PaethPredictor(row[index - pixelSize], previous[index],
+                                        previous[index - pixelSize]));
+        }
+        break;
+    }
+}
+
+// The adaptive filter's cost estimate: filtered bytes read as signed values near zero are cheap.
+[[nodiscard]] std::uint64_t FilterCost(const std::uint8_t* filtered, std::size_t size) noexcept
+{
+    std::uint64_t cost = 0;
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        cost += static_cast<std::uint64_t>(std::abs(static_cast<std::int8_t>(filtered[index])));
+    }
+    return cost;
+}
+
+// Filters rows [begin, end) of image into filtered, each row preceded by its filter type byte.
+// zeros holds a row of zeros to filter the first row against.
+void FilterRows(ImageView<std::uint8_t> image, PngFilter filter, int begin, int end,
+                const std::uint8_t* zeros, std::uint8_t* filtered)
+{
+    const std::size_t rowSize = image.RowSize();
+    const auto pixelSize = static_cast<std::size_t>(image.Channels());
+    std::vector<std::uint8_t> candidate(filter == PngFilter::Adaptive ? rowSize : 0);
+    for (int y = begin; y < end; ++y)
+    {
+        const std::uint8_t* row = image.Row(y);
+        const std::uint8_t* previous = y > 0 ? image.Row(y - 1) : zeros;
+        std::uint8_t* output = filtered + static_cast<std::size_t>(y) * (rowSize + 1);
+        if (filter != PngFilter::Adaptive)
+        {
+            output[0] = static_cast<std::uint8_t>(filter);
+            FilterRow(filter, row, previous, rowSize, pixelSize, output + 1);
+            continue;
+        }
+        std::uint64_t bestCost = std::numeric_limits<std::uint64_t>::max();
+        for (const PngFilter rowFilter : {PngFilter::None, PngFilter::Sub, PngFilter::Up,
+                                          PngFilter::Average, PngFilter::Paeth})
+        {
+            FilterRow(rowFilter, row, previous, rowSize, pixelSize, candidate.data());
+            const std::uint64_t cost = FilterCost(candidate.data(), rowSize);
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                output[0] = static_cast<std::uint8_t>(rowFilter);
+                std::memcpy(output + 1, candidate.data(), rowSize);
+            }
+        }
+    }
+}
+
+// Writes a PNG file into buffer, filtering and deflating on the pool's threads if there is one.
+[[nodiscard]] bool EncodePngView(ImageView<std::uint8_t> image, std::vector<std::uint8_t>& buffer,
+                                 const PngOptions& options, ThreadPool* pool) noexcept
+{
+    buffer.clear();
+    if ((image.Empty()) || (image.Data() == nullptr) ||
+        (!ValidatePngDimensions(image.Width(), image.Height(), image.Channels())) ||
+        (options.compressionLevel < 0) || (options.compressionLevel > 9) ||
+        (options.filter < PngFilter::None) || (options.filter > PngFilter::Adaptive))
+    {
+        return false;
+    }
+    try
+    {
+        const std::size_t rowSize = image.RowSize();
+        const auto height = static_cast<std::size_t>(image.Height());
+        std::vector<std::uint8_t> filtered((rowSize + 1) * height);
+        const std::vector<std::uint8_t> zeros(rowSize);
+        const std::int64_t pixelCount = static_cast<std::int64_t>(image.Width()) * image.Height();
+        const int bandCount =
+            pool != nullptr ? std::min(RequestedSplits(pixelCount, *pool), image.Height()) : 1;
+        const auto filterBand = [&](std::size_t band)
+        {
+            const auto bandIndex = static_cast<std::int64_t>(band);
+            const auto begin = static_cast<int>(bandIndex * image.Height() / bandCount);
+            const auto end = static_cast<int>((bandIndex + 1) * image.Height() / bandCount);
+            FilterRows(image, options.filter, begin, end, zeros.data(), filtered.data());
+        };
+        if (bandCount > 1)
+        {
+            pool->ParallelFor(static_cast<std::size_t>(bandCount), filterBand);
+        }
+        else
+        {
+            filterBand(0);
+        }
+
+        constexpr std::uint8_t ColorTypes[] = {0, 4, 2, 6};
+        std::array<std::uint8_t, 13> header = {};
+        StoreBigEndian(header.data(), static_cast<std::uint32_t>(image.Width()));
+        StoreBigEndian(header.data() + 4, static_cast<std::uint32_t>(image.Height()));
+        header[8] = 8;
+        header[9] = ColorTypes[image.Channels() - 1];
+
+        buffer.insert(buffer.end(), PngSignature.begin(), PngSignature.end());
+        AppendPngChunk(buffer, "IHDR", header);
+        const std::size_t idatStart = buffer.size();
+        buffer.resize(idatStart + 8);
+        if (pool != nullptr)
+        {
+            CompressZlibParallel(filtered, buffer, options.compressionLevel, *pool);
+        }
+        else
+        {
+            CompressZlib(filtered, buffer, options.compressionLevel);
+        }
+        WrapIdatChunks(buffer, idatStart, pool);
+        AppendPngChunk(buffer, "IEND", {});
+        return true;
+    }
+    catch (...)
+    {
+        buffer.clear();
+        return false;
+    }
+}
+
+// Everything the samplers of a STBIR_RESIZE are built from; buffers and strides can change
+// without rebuilding them.
+struct ResizeConfiguration
+{
+    int inputWidth = 0;
+    int inputHeight = 0;
+    int outputWidth = 0;
+    int outputHeight = 0;
+    int channels = 0;
+    stbir_datatype dataType = STBIR_TYPE_UINT8;
+    int requestedSplits = 0;
+
+    bool operator==(const ResizeConfiguration&) const = default;
+};
+
 } // namespace
 
+struct ImageResizer::State
+{
+    STBIR_RESIZE resize;
+    ResizeConfiguration configuration;
+    // Zero until samplers have been built for configuration.
+    int splitCount = 0;
+
+    ~State()
+    {
+        if (splitCount > 0)
+        {
+            stbir_free_samplers(&resize);
+        }
+    }
+};
+
+ImageResizer::ImageResizer() noexcept = default;
+ImageResizer::ImageResizer(ImageResizer&& other) noexcept = default;
+ImageResizer& ImageResizer::operator=(ImageResizer&& other) noexcept = default;
+ImageResizer::~ImageResizer() = default;
+
+void ImageResizer::Resize(ImageView<std::uint8_t> source,
+                          MutableImageView<std::uint8_t> destination)
+{
+    ResizeView(source, destination, nullptr);
+}
+
+void ImageResizer::Resize(ImageView<float> source, MutableImageView<float> destination)
+{
+    ResizeView(source, destination, nullptr);
+}
+
+void ImageResizer::ResizeParallel(ImageView<std::uint8_t> source,
+                                  MutableImageView<std::uint8_t> destination, ThreadPool& pool)
+{
+    ResizeView(source, destination, &pool);
+}
+
+void ImageResizer::ResizeParallel(ImageView<float> source, MutableImageView<float> destination,
+                                  ThreadPool& pool)
+{
+    ResizeView(source, destination, &pool);
+}
+
+template <typename T>
+void ImageResizer::ResizeView(ImageView<T> source, MutableImageView<T> destination,
+                              ThreadPool* pool)
+{
+    ValidateResizeView(source);
+    ValidateResizeView(ImageView<T>{destination});
+    if (source.Channels() != destination.Channels())
+    {
+        throw std::invalid_argument{"source and destination channel counts must match"};
+    }
+    if constexpr (std::same_as<T, float>)
+    {
+        if (!HasValidAlpha(source))
+        {
+            throw std::invalid_argument{"image alpha values must be finite and between 0 and 1"};
+        }
+    }
+
+    const std::int64_t pixelCount =
+        static_cast<std::int64_t>(source.Width()) * source.Height() +
+        static_cast<std::int64_t>(destination.Width()) * destination.Height();
+    const int requestedSplits = pool != nullptr ? RequestedSplits(pixelCount, *pool) : 1;
+    const ResizeConfiguration configuration{source.Width(),      source.Height(),
+                                            destination.Width(), destination.Height(),
+                                            source.Channels(),   DataType<T>,
+                                            requestedSplits};
+    if (!m_state)
+    {
+        m_state = std::make_unique<State>();
+    }
+    State& state = *m_state;
+    const int inputStride = static_cast<int>(source.Stride() * sizeof(T));
+    const int outputStride = static_cast<int>(destination.Stride() * sizeof(T));
+    if ((state.splitCount == 0) || (state.configuration != configuration))
+    {
+        if (state.splitCount > 0)
+        {
+            stbir_free_samplers(&state.resize);
+            state.splitCount = 0;
+        }
+        stbir_resize_init(&state.resize, source.Data(), source.Width(), source.Height(),
+                          inputStride, destination.Data(), destination.Width(),
+                          destination.Height(), outputStride, PixelLayout(source.Channels()),
+                          DataType<T>);
+        // stb_image_resize2 may use fewer splits than requested, for example for short outputs.
+        const int splitCount =
+            stbir_build_samplers_with_splits(&state.resize, configuration.requestedSplits);
+        if (splitCount <= 0)
+        {
+            stbir_free_samplers(&state.resize);
+            throw std::runtime_error{"stb_image_resize failed to build samplers"};
+        }
+        state.configuration = configuration;
+        state.splitCount = splitCount;
+    }
+    else
+    {
+        stbir_set_buffer_ptrs(&state.resize, source.Data(), inputStride, destination.Data(),
+                              outputStride);
+    }
+
+    const auto resizeSplit = [&](std::size_t split)
+    {
+        if (!stbir_resize_extended_split(&state.resize, static_cast<int>(split), 1))
+        {
+            throw std::runtime_error{"stb_image_resize failed to resize image"};
+        }
+    };
+    if (pool != nullptr)
+    {
+        pool->ParallelFor(static_cast<std::size_t>(state.splitCount), resizeSplit);
+    }
+    else
+    {
+        resizeSplit(0);
+    }
+}
+
+void Convert(ImageView<std::uint8_t> source, MutableImageView<float> destination)
+{
+    ConvertRows(source, destination, [](Span<const std::uint8_t> input, Span<float> output)
+                { ConvertUnorm8ToFloat32(input, output); });
+}
+
+void Convert(ImageView<float> source, MutableImageView<std::uint8_t> destination)
+{
+    ConvertRows(source, destination, [](Span<const float> input, Span<std::uint8_t> output)
+                { ConvertFloat32ToUnorm8(input, output); });
+}
+
+void ConvertNormalized(ImageView<std::uint8_t> source, Span<const float> mean,
+                       Span<const float> stddev, MutableImageView<float> destination)
+{
+    const auto channelCount = static_cast<std::size_t>(source.Channels());
+    if ((mean.size() != channelCount) || (stddev.size() != channelCount))
+    {
+        throw std::invalid_argument{"mean and stddev must hold one value per channel"};
+    }
+    ConvertRows(source, destination,
+                [&](Span<const std::uint8_t> input, Span<float> output)
+                { ConvertUnorm8ToFloat32Normalized(input, channelCount, mean, stddev, output); });
+}
+
+void ConvertPremultiplied(ImageView<std::uint8_t> source, MutableImageView<float> destination)
+{
+    const auto channelCount = static_cast<std::size_t>(source.Channels());
+    ConvertRows(source, destination,
+                [&](Span<const std::uint8_t> input, Span<float> output)
+                { ConvertUnorm8ToFloat32Premultiplied(input, channelCount, output); });
+}
+
+bool SavePNG(const std::string& fileName, ImageView<std::uint8_t> image,
+             const PngOptions& options) noexcept
+{
+    try
+    {
+        std::vector<std::uint8_t> buffer;
+        return EncodePNG(image, buffer, options) && WriteFile(fileName, buffer);
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+bool EncodePNG(ImageView<std::uint8_t> image, std::vector<std::uint8_t>& buffer,
+               const PngOptions& options) noexcept
+{
+    return EncodePngView(image, buffer, options, nullptr);
+}
+
+bool EncodePNGParallel(ImageView<std::uint8_t> image, std::vector<std::uint8_t>& buffer,
+                       const PngOptions& options, ThreadPool& pool) noexcept
+{
+    return EncodePngView(image, buffer, options, &pool);
+}
+
+std::optional<ImageInfo> ImageInfo::Probe(const std::string& fileName)
+{
+    std::error_code error;
+    const MappedFile file{std::filesystem::path{fileName}, error};
+    if (error)
+    {
+        return std::nullopt;
+    }
+    return Probe(file.Data(), file.Size());
+}
+
+std::optional<ImageInfo> ImageInfo::Probe(const void* data, std::size_t size) noexcept
+{
+    if ((data == nullptr) || (size == 0) || (size > static_cast<std::size_t>(INT_MAX)))
+    {
+        return std::nullopt;
+    }
+    const auto* bytes = static_cast<const stbi_uc*>(data);
+    ImageInfo info;
+    if (!stbi_info_from_memory(bytes, static_cast<int>(size), &info.width, &info.height,
+                               &info.channels))
+    {
+        return std::nullopt;
+    }
+    info.isHdr = stbi_is_hdr_from_memory(bytes, static_cast<int>(size)) != 0;
+    return info;
+}
+
 ImageUnorm8::ImageUnorm8(int width, int height, int channels) :
     m_width(width),
     m_height(height),
@@ -173,22 +808,13 @@ std::optional<ImageUnorm8> ImageUnorm8::LoadFromFile(const std::string& fileName
     {
         return std::nullopt;
     }
-
-    int width = 0;
-    int height = 0;
-    int sourceChannels = 0;
-    using ImageData = std::unique_ptr<stbi_uc, decltype(&stbi_image_free)>;
-    ImageData pixels{stbi_load(fileName.c_str(), &width, &height, &sourceChannels, desiredChannels),
-                     &stbi_image_free};
-    if (!pixels)
+    std::error_code error;
+    const MappedFile file{std::filesystem::path{fileName}, error};
+    if (error)
     {
         return std::nullopt;
     }
-
-    const int channels = desiredChannels != 0 ? desiredChannels : sourceChannels;
-    const std::size_t valueCount = CheckedValueCount(width, height, channels);
-    return ImageUnorm8{width, height, channels,
-                       std::vector<std::uint8_t>{pixels.get(), pixels.get() + valueCount}};
+    return LoadFromMemory(file.Data(), file.Size(), desiredChannels);
 }
 
 std::optional<ImageUnorm8> ImageUnorm8::LoadFromMemory(const void* data, std::size_t size,
@@ -219,34 +845,24 @@ std::optional<ImageUnorm8> ImageUnorm8::LoadFromMemory(const void* data, std::si
                        std::vector<std::uint8_t>{pixels.get(), pixels.get() + valueCount}};
 }
 
-bool ImageUnorm8::SavePNG(const std::string& fileName) const noexcept
+bool ImageUnorm8::SavePNG(const std::string& fileName, const PngOptions& options) const noexcept
 {
-    if ((Empty()) || (!ValidatePngDimensions(m_width, m_height, m_channels)))
-    {
-        return false;
-    }
-    const int stride = m_width * m_channels;
-    return stbi_write_png(fileName.c_str(), m_width, m_height, m_channels, m_data.data(), stride) !=
-           0;
+    return rad::SavePNG(fileName, View(), options);
 }
 
-bool ImageUnorm8::SavePNG(const std::string& fileName, int x, int y, int width,
-                          int height) const noexcept
+bool ImageUnorm8::SavePNG(const std::string& fileName, int x, int y, int width, int height,
+                          const PngOptions& options) const noexcept
 {
-    if ((Empty()) || (x < 0) || (y < 0) || (width <= 0) || (height <= 0) || (x > m_width - width) ||
-        (y > m_height - height) || (!ValidatePngDimensions(width, height, m_channels)))
+    if ((Empty()) || (!ValidateRegion(x, y, width, height, m_width, m_height)))
     {
         return false;
     }
-    const int stride = m_width * m_channels;
-    return stbi_write_png(fileName.c_str(), width, height, m_channels, Pixel(x, y), stride) != 0;
+    return rad::SavePNG(fileName, View().Crop(x, y, width, height), options);
 }
 
 bool ImageUnorm8::SaveJPEG(const std::string& fileName, int quality) const noexcept
 {
-    constexpr int MaximumDimension = UINT16_MAX;
-    if ((Empty()) || ((m_channels != 1) && (m_channels != 3)) || (quality < 1) || (quality > 100) ||
-        (!ValidateDimensions(m_width, m_height, m_channels, 1, MaximumDimension)))
+    if ((Empty()) || (!CanWriteJpeg(m_width, m_height, m_channels, quality)))
     {
         return false;
     }
@@ -256,7 +872,7 @@ bool ImageUnorm8::SaveJPEG(const std::string& fileName, int quality) const noexc
 
 bool ImageUnorm8::SaveBMP(const std::string& fileName) const noexcept
 {
-    if ((Empty()) || (m_channels == 2) || (!ValidateBmpDimensions(m_width, m_height, m_channels)))
+    if ((Empty()) || (!CanWriteBmp(m_width, m_height, m_channels)))
     {
         return false;
     }
@@ -265,8 +881,7 @@ bool ImageUnorm8::SaveBMP(const std::string& fileName) const noexcept
 
 bool ImageUnorm8::SaveTGA(const std::string& fileName) const noexcept
 {
-    constexpr int MaximumDimension = UINT16_MAX;
-    if ((Empty()) || (!ValidateDimensions(m_width, m_height, m_channels, 1, MaximumDimension)))
+    if ((Empty()) || (!CanWriteTga(m_width, m_height, m_channels)))
     {
         return false;
     }
@@ -285,6 +900,70 @@ bool ImageUnorm8::SaveHDR(const std::string& fileName) const noexcept
     }
 }
 
+bool ImageUnorm8::EncodePNG(std::vector<std::uint8_t>& buffer,
+                            const PngOptions& options) const noexcept
+{
+    return rad::EncodePNG(View(), buffer, options);
+}
+
+bool ImageUnorm8::EncodeJPEG(std::vector<std::uint8_t>& buffer, int quality) const noexcept
+{
+    if ((Empty()) || (!CanWriteJpeg(m_width, m_height, m_channels, quality)))
+    {
+        buffer.clear();
+        return false;
+    }
+    return EncodeWithStb(buffer,
+                         [&](stbi_write_func* write, void* context)
+                         {
+                             return stbi_write_jpg_to_func(write, context, m_width, m_height,
+                                                           m_channels, m_data.data(), quality);
+                         });
+}
+
+bool ImageUnorm8::EncodeBMP(std::vector<std::uint8_t>& buffer) const noexcept
+{
+    if ((Empty()) || (!CanWriteBmp(m_width, m_height, m_channels)))
+    {
+        buffer.clear();
+        return false;
+    }
+    return EncodeWithStb(buffer,
+                         [&](stbi_write_func* write, void* context)
+                         {
+                             return stbi_write_bmp_to_func(write, context, m_width, m_height,
+                                                           m_channels, m_data.data());
+                         });
+}
+
+bool ImageUnorm8::EncodeTGA(std::vector<std::uint8_t>& buffer) const noexcept
+{
+    if ((Empty()) || (!CanWriteTga(m_width, m_height, m_channels)))
+    {
+        buffer.clear();
+        return false;
+    }
+    return EncodeWithStb(buffer,
+                         [&](stbi_write_func* write, void* context)
+                         {
+                             return stbi_write_tga_to_func(write, context, m_width, m_height,
+                                                           m_channels, m_data.data());
+                         });
+}
+
+bool ImageUnorm8::EncodeHDR(std::vector<std::uint8_t>& buffer) const noexcept
+{
+    try
+    {
+        return ToFloat32().EncodeHDR(buffer);
+    }
+    catch (...)
+    {
+        buffer.clear();
+        return false;
+    }
+}
+
 std::uint8_t* ImageUnorm8::Pixel(int x, int y) noexcept
 {
     return const_cast<std::uint8_t*>(std::as_const(*this).Pixel(x, y));
@@ -299,6 +978,18 @@ const std::uint8_t* ImageUnorm8::Pixel(int x, int y) const noexcept
                                static_cast<std::size_t>(m_channels);
 }
 
+ImageView<std::uint8_t> ImageUnorm8::View() const noexcept
+{
+    return {m_data.data(), m_width, m_height, m_channels,
+            static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_channels)};
+}
+
+MutableImageView<std::uint8_t> ImageUnorm8::View() noexcept
+{
+    return {m_data.data(), m_width, m_height, m_channels,
+            static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_channels)};
+}
+
 ImageUnorm8 ImageUnorm8::Resize(int width, int height) const
 {
     ValidateImage(m_width, m_height, m_channels, m_data.size());
@@ -308,21 +999,46 @@ ImageUnorm8 ImageUnorm8::Resize(int width, int height) const
         throw std::length_error{"image dimensions are too large for stb_image_resize"};
     }
     ImageUnorm8 result{width, height, m_channels};
-    if (!stbir_resize_uint8_linear(m_data.data(), m_width, m_height, 0, result.Data(), width,
-                                   height, 0, PixelLayout(m_channels)))
+    ImageResizer{}.Resize(View(), result.View());
+    return result;
+}
+
+ImageUnorm8 ImageUnorm8::ResizeParallel(int width, int height, ThreadPool& pool) const
+{
+    ValidateImage(m_width, m_height, m_channels, m_data.size());
+    if ((!ValidateDimensions(m_width, m_height, m_channels)) ||
+        (!ValidateDimensions(width, height, m_channels)))
     {
-        throw std::runtime_error{"stb_image_resize failed to resize image"};
+        throw std::length_error{"image dimensions are too large for stb_image_resize"};
     }
+    ImageUnorm8 result{width, height, m_channels};
+    ImageResizer{}.ResizeParallel(View(), result.View(), pool);
     return result;
 }
 
 ImageFloat32 ImageUnorm8::ToFloat32() const
 {
     ValidateImage(m_width, m_height, m_channels, m_data.size());
-    std::vector<float> pixels(m_data.size());
-    std::transform(m_data.begin(), m_data.end(), pixels.begin(),
-                   [](std::uint8_t value) { return static_cast<float>(value) / 255.0f; });
-    return ImageFloat32{m_width, m_height, m_channels, std::move(pixels)};
+    ImageFloat32 result{m_width, m_height, m_channels};
+    Convert(View(), result.View());
+    return result;
+}
+
+ImageFloat32 ImageUnorm8::ToFloat32Normalized(Span<const float> mean,
+                                              Span<const float> stddev) const
+{
+    ValidateImage(m_width, m_height, m_channels, m_data.size());
+    ImageFloat32 result{m_width, m_height, m_channels};
+    ConvertNormalized(View(), mean, stddev, result.View());
+    return result;
+}
+
+ImageFloat32 ImageUnorm8::ToFloat32Premultiplied() const
+{
+    ValidateImage(m_width, m_height, m_channels, m_data.size());
+    ImageFloat32 result{m_width, m_height, m_channels};
+    ConvertPremultiplied(View(), result.View());
+    return result;
 }
 
 ImageFloat32::ImageFloat32(int width, int height, int channels) :
@@ -352,32 +1068,13 @@ std::optional<ImageFloat32> ImageFloat32::LoadFromFile(const std::string& fileNa
     {
         return std::nullopt;
     }
-    if (!stbi_is_hdr(fileName.c_str()))
-    {
-        std::optional<ImageUnorm8> image = ImageUnorm8::LoadFromFile(fileName, desiredChannels);
-        if (!image)
-        {
-            return std::nullopt;
-        }
-        return image->ToFloat32();
-    }
-
-    int width = 0;
-    int height = 0;
-    int sourceChannels = 0;
-    using ImageData = std::unique_ptr<float, decltype(&stbi_image_free)>;
-    ImageData pixels{
-        stbi_loadf(fileName.c_str(), &width, &height, &sourceChannels, desiredChannels),
-        &stbi_image_free};
-    if (!pixels)
+    std::error_code error;
+    const MappedFile file{std::filesystem::path{fileName}, error};
+    if (error)
     {
         return std::nullopt;
     }
-
-    const int channels = desiredChannels != 0 ? desiredChannels : sourceChannels;
-    const std::size_t valueCount = CheckedValueCount(width, height, channels);
-    return ImageFloat32{width, height, channels,
-                        std::vector<float>{pixels.get(), pixels.get() + valueCount}};
+    return LoadFromMemory(file.Data(), file.Size(), desiredChannels);
 }
 
 std::optional<ImageFloat32> ImageFloat32::LoadFromMemory(const void* data, std::size_t size,
@@ -417,11 +1114,11 @@ std::optional<ImageFloat32> ImageFloat32::LoadFromMemory(const void* data, std::
                         std::vector<float>{pixels.get(), pixels.get() + valueCount}};
 }
 
-bool ImageFloat32::SavePNG(const std::string& fileName) const noexcept
+bool ImageFloat32::SavePNG(const std::string& fileName, const PngOptions& options) const noexcept
 {
     try
     {
-        return ToUnorm8().SavePNG(fileName);
+        return ToUnorm8().SavePNG(fileName, options);
     }
     catch (...)
     {
@@ -429,12 +1126,19 @@ bool ImageFloat32::SavePNG(const std::string& fileName) const noexcept
     }
 }
 
-bool ImageFloat32::SavePNG(const std::string& fileName, int x, int y, int width,
-                           int height) const noexcept
+bool ImageFloat32::SavePNG(const std::string& fileName, int x, int y, int width, int height,
+                           const PngOptions& options) const noexcept
 {
+    if ((Empty()) || (!ValidateRegion(x, y, width, height, m_width, m_height)))
+    {
+        return false;
+    }
     try
     {
-        return ToUnorm8().SavePNG(fileName, x, y, width, height);
+        // Converts only the saved region.
+        ImageUnorm8 region{width, height, m_channels};
+        Convert(View().Crop(x, y, width, height), region.View());
+        return region.SavePNG(fileName, options);
     }
     catch (...)
     {
@@ -480,22 +1184,79 @@ bool ImageFloat32::SaveTGA(const std::string& fileName) const noexcept
 
 bool ImageFloat32::SaveHDR(const std::string& fileName) const noexcept
 {
-    if ((Empty()) || ((m_channels != 1) && (m_channels != 3)) ||
-        (!ValidateHdrDimensions(m_width, m_height, m_channels)))
+    if ((Empty()) || (!CanWriteHdr(m_width, m_height, m_channels, m_data)))
     {
         return false;
     }
-    constexpr float MaximumValue = 0x1p127f;
-    if (std::ranges::any_of(m_data,
-                            [](float value)
-                            {
-                                return std::isnan(value) || std::isinf(value) || (value < 0.0f) ||
-                                       (value >= MaximumValue);
-                            }))
+    return stbi_write_hdr(fileName.c_str(), m_width, m_height, m_channels, m_data.data()) != 0;
+}
+
+bool ImageFloat32::EncodePNG(std::vector<std::uint8_t>& buffer,
+                             const PngOptions& options) const noexcept
+{
+    try
+    {
+        return ToUnorm8().EncodePNG(buffer, options);
+    }
+    catch (...)
     {
+        buffer.clear();
+        return false;
+    }
+}
+
+bool ImageFloat32::EncodeJPEG(std::vector<std::uint8_t>& buffer, int quality) const noexcept
+{
+    try
+    {
+        return ToUnorm8().EncodeJPEG(buffer, quality);
+    }
+    catch (...)
+    {
+        buffer.clear();
+        return false;
+    }
+}
+
+bool ImageFloat32::EncodeBMP(std::vector<std::uint8_t>& buffer) const noexcept
+{
+    try
+    {
+        return ToUnorm8().EncodeBMP(buffer);
+    }
+    catch (...)
+    {
+        buffer.clear();
         return false;
     }
-    return stbi_write_hdr(fileName.c_str(), m_width, m_height, m_channels, m_data.data()) != 0;
+}
+
+bool ImageFloat32::EncodeTGA(std::vector<std::uint8_t>& buffer) const noexcept
+{
+    try
+    {
+        return ToUnorm8().EncodeTGA(buffer);
+    }
+    catch (...)
+    {
+        buffer.clear();
+        return false;
+    }
+}
+
+bool ImageFloat32::EncodeHDR(std::vector<std::uint8_t>& buffer) const noexcept
+{
+    if ((Empty()) || (!CanWriteHdr(m_width, m_height, m_channels, m_data)))
+    {
+        buffer.clear();
+        return false;
+    }
+    return EncodeWithStb(buffer,
+                         [&](stbi_write_func* write, void* context)
+                         {
+                             return stbi_write_hdr_to_func(write, context, m_width, m_height,
+                                                           m_channels, m_data.data());
+                         });
 }
 
 float* ImageFloat32::Pixel(int x, int y) noexcept
@@ -512,6 +1273,18 @@ const float* ImageFloat32::Pixel(int x, int y) const noexcept
                                static_cast<std::size_t>(m_channels);
 }
 
+ImageView<float> ImageFloat32::View() const noexcept
+{
+    return {m_data.data(), m_width, m_height, m_channels,
+            static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_channels)};
+}
+
+MutableImageView<float> ImageFloat32::View() noexcept
+{
+    return {m_data.data(), m_width, m_height, m_channels,
+            static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_channels)};
+}
+
 ImageFloat32 ImageFloat32::Resize(int width, int height) const
 {
     ValidateImage(m_width, m_height, m_channels, m_data.size());
@@ -520,31 +1293,30 @@ ImageFloat32 ImageFloat32::Resize(int width, int height) const
     {
         throw std::length_error{"image dimensions are too large for stb_image_resize"};
     }
-    if (!HasValidAlpha(m_data, m_channels))
-    {
-        throw std::invalid_argument{"image alpha values must be finite and between 0 and 1"};
-    }
     ImageFloat32 result{width, height, m_channels};
-    if (!stbir_resize_float_linear(m_data.data(), m_width, m_height, 0, result.Data(), width,
-                                   height, 0, PixelLayout(m_channels)))
+    ImageResizer{}.Resize(View(), result.View());
+    return result;
+}
+
+ImageFloat32 ImageFloat32::ResizeParallel(int width, int height, ThreadPool& pool) const
+{
+    ValidateImage(m_width, m_height, m_channels, m_data.size());
+    if ((!ValidateDimensions(m_width, m_height, m_channels, sizeof(float))) ||
+        (!ValidateDimensions(width, height, m_channels, sizeof(float))))
     {
-        throw std::runtime_error{"stb_image_resize failed to resize image"};
+        throw std::length_error{"image dimensions are too large for stb_image_resize"};
     }
+    ImageFloat32 result{width, height, m_channels};
+    ImageResizer{}.ResizeParallel(View(), result.View(), pool);
     return result;
 }
 
 ImageUnorm8 ImageFloat32::ToUnorm8() const
 {
     ValidateImage(m_width, m_height, m_channels, m_data.size());
-    std::vector<std::uint8_t> pixels(m_data.size());
-    std::transform(m_data.begin(), m_data.end(), pixels.begin(),
-                   [](float value)
-                   {
-                       const float clamped =
-                           std::isnan(value) ? 0.0f : std::clamp(value, 0.0f, 1.0f);
-                       return static_cast<std::uint8_t>(std::lround(clamped * 255.0f));
-                   });
-    return ImageUnorm8{m_width, m_height, m_channels, std::move(pixels)};
+    ImageUnorm8 result{m_width, m_height, m_channels};
+    Convert(View(), result.View());
+    return result;
 }
 
 } // namespace rad
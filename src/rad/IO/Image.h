@@ -1,7 +1,13 @@
 #pragma once
 
+#include <rad/Core/Span.h>
+#include <rad/System/ThreadPool.h>
+
+#include <cassert>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -11,6 +17,123 @@ namespace rad
 
 class ImageFloat32;
 
+// PNG row filters, numbered as in the file format. Filtering turns smooth gradients into runs of
+// small values that compress well.
+enum class PngFilter
+{
+    None,
+    Sub,
+    Up,
+    Average,
+    Paeth,
+    // Picks the filter per row whose output has the smallest sum of absolute values, as libpng
+    // and stb_image_write do. Slowest to filter, and usually the smallest file.
+    Adaptive,
+};
+
+struct PngOptions
+{
+    // 0 stores the filtered rows uncompressed; 1 through 9 trade speed for size as in zlib (see
+    // CompressZlib).
+    int compressionLevel = 6;
+    PngFilter filter = PngFilter::Adaptive;
+};
+
+// Image header fields, read without decoding the pixels.
+struct ImageInfo
+{
+    int width = 0;
+    int height = 0;
+    // The channel count stored in the file, 1 through 4.
+    int channels = 0;
+    // Whether ImageFloat32 loads the file as linear floating-point values (Radiance HDR).
+    bool isHdr = false;
+
+    // Returns std::nullopt if the data is not in a format stb_image can decode. Only the header is
+    // read: mapped files are not read beyond the pages holding it.
+    [[nodiscard]] static std::optional<ImageInfo> Probe(const std::string& fileName);
+    [[nodiscard]] static std::optional<ImageInfo> Probe(const void* data,
+                                                        std::size_t size) noexcept;
+};
+
+// A non-owning view of a row-major image with interleaved channels: the pixels of an ImageUnorm8
+// or ImageFloat32, a region of them, or any caller-owned buffer. Rows start Stride() values apart,
+// so cropping never copies. Like Span, a view does not keep its pixels alive. Use the ImageView
+// and MutableImageView aliases.
+template <typename T>
+class BasicImageView
+{
+public:
+    BasicImageView() noexcept = default;
+    // stride is the distance between the starts of consecutive rows, in values, and must be at
+    // least width * channels.
+    BasicImageView(T* data, int width, int height, int channels, std::size_t stride) noexcept :
+        m_data(data),
+        m_width(width),
+        m_height(height),
+        m_channels(channels),
+        m_stride(stride)
+    {
+        assert(width >= 0 && height >= 0 && channels >= 0 && channels <= 4);
+        assert(stride >= RowSize());
+    }
+
+    // A mutable view converts to a read-only one.
+    template <typename U>
+        requires(std::same_as<const U, T> && !std::same_as<U, T>)
+    BasicImageView(const BasicImageView<U>& other) noexcept :
+        BasicImageView(other.Data(), other.Width(), other.Height(), other.Channels(),
+                       other.Stride())
+    {
+    }
+
+    [[nodiscard]] int Width() const noexcept { return m_width; }
+    [[nodiscard]] int Height() const noexcept { return m_height; }
+    [[nodiscard]] int Channels() const noexcept { return m_channels; }
+    [[nodiscard]] std::size_t Stride() const noexcept { return m_stride; }
+    [[nodiscard]] bool Empty() const noexcept { return (m_width == 0) || (m_height == 0); }
+    [[nodiscard]] T* Data() const noexcept { return m_data; }
+
+    // Values per row, excluding the padding up to the stride.
+    [[nodiscard]] std::size_t RowSize() const noexcept
+    {
+        return static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_channels);
+    }
+    // Whether the rows follow each other without padding.
+    [[nodiscard]] bool IsContiguous() const noexcept { return m_stride == RowSize(); }
+
+    [[nodiscard]] T* Row(int y) const noexcept
+    {
+        assert(y >= 0 && y < m_height);
+        return m_data + static_cast<std::size_t>(y) * m_stride;
+    }
+    [[nodiscard]] T* Pixel(int x, int y) const noexcept
+    {
+        assert(x >= 0 && x < m_width);
+        return Row(y) + static_cast<std::size_t>(x) * static_cast<std::size_t>(m_channels);
+    }
+
+    // The width x height region whose top-left pixel is (x, y); it must lie inside this view.
+    [[nodiscard]] BasicImageView Crop(int x, int y, int width, int height) const noexcept
+    {
+        assert(x >= 0 && y >= 0 && width > 0 && height > 0);
+        assert(x <= m_width - width && y <= m_height - height);
+        return BasicImageView{Pixel(x, y), width, height, m_channels, m_stride};
+    }
+
+private:
+    T* m_data = nullptr;
+    int m_width = 0;
+    int m_height = 0;
+    int m_channels = 0;
+    std::size_t m_stride = 0;
+}; // class BasicImageView
+
+template <typename T>
+using ImageView = BasicImageView<const T>;
+template <typename T>
+using MutableImageView = BasicImageView<T>;
+
 // An owning, tightly packed, row-major image with interleaved 8-bit UNORM channels.
 // Channel layouts are Y, YA, RGB, and RGBA. No color-space conversion is performed.
 class ImageUnorm8
@@ -20,26 +143,49 @@ public:
     ImageUnorm8(int width, int height, int channels);
     ImageUnorm8(int width, int height, int channels, std::vector<std::uint8_t> pixels);
 
-    // desiredChannels must be 0 (preserve the source channel count) or 1 through 4.
+    // desiredChannels must be 0 (preserve the source channel count) or 1 through 4. Files are
+    // memory-mapped and decoded in place, without an intermediate read buffer.
     [[nodiscard]] static std::optional<ImageUnorm8> LoadFromFile(const std::string& fileName,
                                                                  int desiredChannels = 0);
     [[nodiscard]] static std::optional<ImageUnorm8> LoadFromMemory(const void* data,
                                                                    std::size_t size,
                                                                    int desiredChannels = 0);
 
-    [[nodiscard]] bool SavePNG(const std::string& fileName) const noexcept;
-    [[nodiscard]] bool SavePNG(const std::string& fileName, int x, int y, int width,
-                               int height) const noexcept;
+    [[nodiscard]] bool SavePNG(const std::string& fileName,
+                               const PngOptions& options = {}) const noexcept;
+    [[nodiscard]] bool SavePNG(const std::string& fileName, int x, int y, int width, int height,
+                               const PngOptions& options = {}) const noexcept;
     // JPEG requires 1 or 3 channels. BMP accepts 1, 3, or 4 channels.
     [[nodiscard]] bool SaveJPEG(const std::string& fileName, int quality = 90) const noexcept;
     [[nodiscard]] bool SaveBMP(const std::string& fileName) const noexcept;
     [[nodiscard]] bool SaveTGA(const std::string& fileName) const noexcept;
     [[nodiscard]] bool SaveHDR(const std::string& fileName) const noexcept;
 
+    // Encode as the Save functions do, into buffer instead of a file. The buffer's contents are
+    // replaced but its capacity is kept, so a buffer reused across calls stops allocating once it
+    // has grown to the largest encoding. On failure the buffer is left empty.
+    [[nodiscard]] bool EncodePNG(std::vector<std::uint8_t>& buffer,
+                                 const PngOptions& options = {}) const noexcept;
+    [[nodiscard]] bool EncodeJPEG(std::vector<std::uint8_t>& buffer,
+                                  int quality = 90) const noexcept;
+    [[nodiscard]] bool EncodeBMP(std::vector<std::uint8_t>& buffer) const noexcept;
+    [[nodiscard]] bool EncodeTGA(std::vector<std::uint8_t>& buffer) const noexcept;
+    [[nodiscard]] bool EncodeHDR(std::vector<std::uint8_t>& buffer) const noexcept;
+
     // YA/RGBA input is straight alpha; colors are alpha-weighted during filtering.
     [[nodiscard]] ImageUnorm8 Resize(int width, int height) const;
+    // Resizes bands of output rows on the pool's workers and the calling thread; the result is
+    // bit-identical to Resize. Small images run serially.
+    [[nodiscard]] ImageUnorm8 ResizeParallel(int width, int height,
+                                             ThreadPool& pool = GetGlobalThreadPool()) const;
 
     [[nodiscard]] ImageFloat32 ToFloat32() const;
+    // Converts and standardizes each channel in one pass for ML preprocessing:
+    // (value / 255 - mean[c]) / stddev[c]. mean and stddev hold one value per channel.
+    [[nodiscard]] ImageFloat32 ToFloat32Normalized(Span<const float> mean,
+                                                   Span<const float> stddev) const;
+    // Converts YA/RGBA pixels to premultiplied alpha; Y/RGB pixels convert as by ToFloat32.
+    [[nodiscard]] ImageFloat32 ToFloat32Premultiplied() const;
 
     [[nodiscard]] int Width() const noexcept { return m_width; }
     [[nodiscard]] int Height() const noexcept { return m_height; }
@@ -49,6 +195,8 @@ public:
     [[nodiscard]] const std::uint8_t* Data() const noexcept { return m_data.data(); }
     [[nodiscard]] std::uint8_t* Pixel(int x, int y) noexcept;
     [[nodiscard]] const std::uint8_t* Pixel(int x, int y) const noexcept;
+    [[nodiscard]] ImageView<std::uint8_t> View() const noexcept;
+    [[nodiscard]] MutableImageView<std::uint8_t> View() noexcept;
 
 private:
     int m_width = 0;
@@ -67,24 +215,39 @@ public:
     ImageFloat32(int width, int height, int channels);
     ImageFloat32(int width, int height, int channels, std::vector<float> pixels);
 
-    // desiredChannels must be 0 (preserve the source channel count) or 1 through 4.
+    // desiredChannels must be 0 (preserve the source channel count) or 1 through 4. Files are
+    // memory-mapped and decoded in place, without an intermediate read buffer.
     [[nodiscard]] static std::optional<ImageFloat32> LoadFromFile(const std::string& fileName,
                                                                   int desiredChannels = 0);
     [[nodiscard]] static std::optional<ImageFloat32> LoadFromMemory(const void* data,
                                                                     std::size_t size,
                                                                     int desiredChannels = 0);
 
-    [[nodiscard]] bool SavePNG(const std::string& fileName) const noexcept;
-    [[nodiscard]] bool SavePNG(const std::string& fileName, int x, int y, int width,
-                               int height) const noexcept;
+    [[nodiscard]] bool SavePNG(const std::string& fileName,
+                               const PngOptions& options = {}) const noexcept;
+    [[nodiscard]] bool SavePNG(const std::string& fileName, int x, int y, int width, int height,
+                               const PngOptions& options = {}) const noexcept;
     [[nodiscard]] bool SaveJPEG(const std::string& fileName, int quality = 90) const noexcept;
     [[nodiscard]] bool SaveBMP(const std::string& fileName) const noexcept;
     [[nodiscard]] bool SaveTGA(const std::string& fileName) const noexcept;
     // Uses lossy RGBE encoding and requires 1 or 3 channels with finite, non-negative values.
     [[nodiscard]] bool SaveHDR(const std::string& fileName) const noexcept;
 
+    // Encode as the Save functions do, into buffer; see ImageUnorm8::EncodePNG.
+    [[nodiscard]] bool EncodePNG(std::vector<std::uint8_t>& buffer,
+                                 const PngOptions& options = {}) const noexcept;
+    [[nodiscard]] bool EncodeJPEG(std::vector<std::uint8_t>& buffer,
+                                  int quality = 90) const noexcept;
+    [[nodiscard]] bool EncodeBMP(std::vector<std::uint8_t>& buffer) const noexcept;
+    [[nodiscard]] bool EncodeTGA(std::vector<std::uint8_t>& buffer) const noexcept;
+    [[nodiscard]] bool EncodeHDR(std::vector<std::uint8_t>& buffer) const noexcept;
+
     // YA/RGBA input is straight alpha; colors are alpha-weighted during filtering.
     [[nodiscard]] ImageFloat32 Resize(int width, int height) const;
+    // Resizes bands of output rows on the pool's workers and the calling thread; the result is
+    // bit-identical to Resize. Small images run serially.
+    [[nodiscard]] ImageFloat32 ResizeParallel(int width, int height,
+                                              ThreadPool& pool = GetGlobalThreadPool()) const;
 
     // Values are clamped to [0, 1] and rounded to the nearest representable UNORM8 value.
     // NaN is converted to zero.
@@ -98,6 +261,8 @@ public:
     [[nodiscard]] const float* Data() const noexcept { return m_data.data(); }
     [[nodiscard]] float* Pixel(int x, int y) noexcept;
     [[nodiscard]] const float* Pixel(int x, int y) const noexcept;
+    [[nodiscard]] ImageView<float> View() const noexcept;
+    [[nodiscard]] MutableImageView<float> View() noexcept;
 
 private:
     int m_width = 0;
@@ -106,4 +271,59 @@ private:
     std::vector<float> m_data;
 }; // class ImageFloat32
 
+// Resizes into caller-provided destinations, with the same filtering as ImageUnorm8::Resize and
+// ImageFloat32::Resize. The filter samplers depend only on the source and destination sizes, the
+// channel count and the value type; they are built on first use and kept until those change, so a
+// frame loop resizing into a preallocated destination stops allocating after its first frame.
+// Source and destination must have the same channel count and must not overlap. Not thread-safe;
+// use one resizer per thread.
+class ImageResizer
+{
+public:
+    ImageResizer() noexcept;
+    ImageResizer(ImageResizer&& other) noexcept;
+    ImageResizer& operator=(ImageResizer&& other) noexcept;
+    ~ImageResizer();
+
+    void Resize(ImageView<std::uint8_t> source, MutableImageView<std::uint8_t> destination);
+    void Resize(ImageView<float> source, MutableImageView<float> destination);
+    // Resizes bands of output rows on the pool's workers and the calling thread; the result is
+    // bit-identical to Resize. Small images run serially.
+    void ResizeParallel(ImageView<std::uint8_t> source, MutableImageView<std::uint8_t> destination,
+                        ThreadPool& pool = GetGlobalThreadPool());
+    void ResizeParallel(ImageView<float> source, MutableImageView<float> destination,
+                        ThreadPool& pool = GetGlobalThreadPool());
+
+private:
+    struct State;
+
+    template <typename T>
+    void ResizeView(ImageView<T> source, MutableImageView<T> destination, ThreadPool* pool);
+
+    std::unique_ptr<State> m_state;
+}; // class ImageResizer
+
+// Conversions into caller-provided destinations of the same size and channel count, computing
+// what ImageUnorm8::ToFloat32, ToFloat32Normalized, ToFloat32Premultiplied and
+// ImageFloat32::ToUnorm8 return.
+void Convert(ImageView<std::uint8_t> source, MutableImageView<float> destination);
+void Convert(ImageView<float> source, MutableImageView<std::uint8_t> destination);
+void ConvertNormalized(ImageView<std::uint8_t> source, Span<const float> mean,
+                       Span<const float> stddev, MutableImageView<float> destination);
+void ConvertPremultiplied(ImageView<std::uint8_t> source, MutableImageView<float> destination);
+
+// Like ImageUnorm8::SavePNG and EncodePNG, for any view; strided rows are read without copying.
+// Encoding keeps a filtered copy of the rows, one byte per row larger than the pixels.
+[[nodiscard]] bool SavePNG(const std::string& fileName, ImageView<std::uint8_t> image,
+                           const PngOptions& options = {}) noexcept;
+[[nodiscard]] bool EncodePNG(ImageView<std::uint8_t> image, std::vector<std::uint8_t>& buffer,
+                             const PngOptions& options = {}) noexcept;
+// Filters bands of rows, then deflates segments of the filtered rows, on the pool's workers and
+// the calling thread. The file decodes to the same pixels as EncodePNG's and is slightly larger;
+// see CompressZlibParallel. Small images run serially.
+[[nodiscard]] bool EncodePNGParallel(ImageView<std::uint8_t> image,
+                                     std::vector<std::uint8_t>& buffer,
+                                     const PngOptions& options = {},
+                                     ThreadPool& pool = GetGlobalThreadPool()) noexcept;
+
 } // namespace rad
@@ -1,13 +1,17 @@
 #include <rad/IO/Image.h>
+#include <rad/System/ThreadPool.h>
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace
 {
@@ -121,6 +125,21 @@ void TestLdrFormats()
     const auto jpeg = rad::ImageUnorm8::LoadFromFile(jpegPath);
     ASSERT_TRUE(jpeg);
     VerifyImage(rgbImage, *jpeg, 8);
+
+    for (const auto& [path, channels] : {std::pair{pngPath, 4}, std::pair{bmpPath, 3},
+                                         std::pair{tgaPath, 3}, std::pair{jpegPath, 3}})
+    {
+        const auto info = rad::ImageInfo::Probe(path);
+        ASSERT_TRUE(info) << path;
+        EXPECT_EQ(info->width, 256);
+        EXPECT_EQ(info->height, 256);
+        EXPECT_EQ(info->channels, channels);
+        EXPECT_FALSE(info->isHdr);
+    }
+    const auto regionInfo = rad::ImageInfo::Probe(pngRegionPath);
+    ASSERT_TRUE(regionInfo);
+    EXPECT_EQ(regionInfo->width, 128);
+    EXPECT_EQ(regionInfo->height, 96);
 }
 
 void TestHdr()
@@ -141,6 +160,9 @@ void TestHdr()
 
     const std::string path = "gradient.hdr";
     ASSERT_TRUE(image.SaveHDR(path));
+    const auto info = rad::ImageInfo::Probe(path);
+    ASSERT_TRUE(info);
+    EXPECT_TRUE(info->isHdr);
     const auto loaded = rad::ImageFloat32::LoadFromFile(path);
     ASSERT_TRUE(loaded);
     ASSERT_EQ(loaded->Width(), image.Width());
@@ -165,11 +187,213 @@ void TestFailures()
     EXPECT_FALSE(rgbaImage.SavePNG(""));
     EXPECT_FALSE(rgbaImage.SaveJPEG("gradient-rgba.jpg"));
 
+    EXPECT_FALSE(rad::ImageUnorm8::LoadFromFile("missing.png"));
+    EXPECT_FALSE(rad::ImageInfo::Probe("missing.png"));
+    const char text[] = "not an image";
+    EXPECT_FALSE(rad::ImageInfo::Probe(text, sizeof(text)));
+
     rad::ImageFloat32 image{2, 2, 4};
     image.Pixel(0, 0)[3] = std::numeric_limits<float>::quiet_NaN();
     EXPECT_THROW(static_cast<void>(image.Resize(1, 1)), std::invalid_argument);
 }
 
+void TestConversions()
+{
+    rad::ImageUnorm8 image{37, 23, 4};
+    FillGradient(image);
+    const float mean[] = {0.485f, 0.456f, 0.406f, 0.5f};
+    const float stddev[] = {0.229f, 0.224f, 0.225f, 0.25f};
+    const rad::ImageFloat32 normalized = image.ToFloat32Normalized(mean, stddev);
+    const rad::ImageFloat32 premultiplied = image.ToFloat32Premultiplied();
+    for (int y = 0; y < image.Height(); ++y)
+    {
+        for (int x = 0; x < image.Width(); ++x)
+        {
+            const float alpha = image.Pixel(x, y)[3] / 255.0f;
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                const float value = image.Pixel(x, y)[channel] / 255.0f;
+                EXPECT_NEAR(normalized.Pixel(x, y)[channel],
+                            (value - mean[channel]) / stddev[channel], 1e-5f);
+                EXPECT_FLOAT_EQ(premultiplied.Pixel(x, y)[channel],
+                                channel < 3 ? value * alpha : alpha);
+            }
+        }
+    }
+    EXPECT_TRUE(std::equal(image.Data(), image.Data() + 37 * 23 * 4,
+                           image.ToFloat32().ToUnorm8().Data()));
+    EXPECT_THROW(static_cast<void>(image.ToFloat32Normalized(
+                     rad::Span<const float>(mean, 3), rad::Span<const float>(stddev, 3))),
+                 std::invalid_argument);
+}
+
+// Upscales, downscales and mixed scales, large enough to be split across the pool's workers.
+void TestResizeParallel()
+{
+    rad::ThreadPool pool(4);
+    const std::pair<int, int> sizes[] = {{1024, 768}, {97, 1601}, {3000, 41}, {1, 1}};
+    for (const int channels : {1, 2, 3, 4})
+    {
+        rad::ImageUnorm8 image{1280, 960, channels};
+        FillGradient(image);
+        const rad::ImageFloat32 imageFloat32 = image.ToFloat32();
+        for (const auto& [width, height] : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << channels << " channels, " << width << "x" << height);
+            const rad::ImageUnorm8 serial = image.Resize(width, height);
+            const rad::ImageUnorm8 parallel = image.ResizeParallel(width, height, pool);
+            ASSERT_EQ(parallel.Width(), width);
+            ASSERT_EQ(parallel.Height(), height);
+            EXPECT_TRUE(std::equal(serial.Data(), serial.Data() + width * height * channels,
+                                   parallel.Data()));
+
+            const rad::ImageFloat32 serialFloat32 = imageFloat32.Resize(width, height);
+            const rad::ImageFloat32 parallelFloat32 =
+                imageFloat32.ResizeParallel(width, height, pool);
+            EXPECT_EQ(std::memcmp(serialFloat32.Data(), parallelFloat32.Data(),
+                                  sizeof(float) * width * height * channels),
+                      0);
+        }
+    }
+}
+
+// Crops and resizes into regions of larger destinations through views, comparing with the
+// allocating member functions.
+void TestViews()
+{
+    rad::ImageUnorm8 image{64, 48, 4};
+    FillGradient(image);
+    const rad::ImageView<std::uint8_t> crop = image.View().Crop(5, 7, 40, 30);
+    ASSERT_EQ(crop.Stride(), std::size_t(64 * 4));
+    ASSERT_FALSE(crop.IsContiguous());
+    EXPECT_EQ(crop.Pixel(0, 0), image.Pixel(5, 7));
+    EXPECT_EQ(crop.Pixel(39, 29), image.Pixel(44, 36));
+
+    rad::ImageUnorm8 cropped{40, 30, 4};
+    for (int y = 0; y < 30; ++y)
+    {
+        std::memcpy(cropped.Pixel(0, y), crop.Row(y), crop.RowSize());
+    }
+
+    // Converts into the middle of a padded float image and back.
+    rad::ImageFloat32 canvas{50, 40, 4};
+    const rad::MutableImageView<float> target = canvas.View().Crop(3, 2, 40, 30);
+    rad::Convert(crop, target);
+    const rad::ImageFloat32 expected = cropped.ToFloat32();
+    for (int y = 0; y < 30; ++y)
+    {
+        EXPECT_EQ(std::memcmp(target.Row(y), expected.Pixel(0, y), sizeof(float) * 40 * 4), 0);
+    }
+    rad::ImageUnorm8 roundTrip{40, 30, 4};
+    rad::Convert(rad::ImageView<float>{target}, roundTrip.View());
+    EXPECT_TRUE(std::equal(cropped.Data(), cropped.Data() + 40 * 30 * 4, roundTrip.Data()));
+    EXPECT_THROW(rad::Convert(crop, canvas.View()), std::invalid_argument);
+
+    // The resizer reuses its samplers across frames and rebuilds them when the sizes change.
+    rad::ImageResizer resizer;
+    rad::ThreadPool pool(2);
+    for (const auto& [width, height] : {std::pair{17, 13}, std::pair{17, 13}, std::pair{80, 60}})
+    {
+        const rad::ImageUnorm8 reference = cropped.Resize(width, height);
+        rad::ImageUnorm8 padded{width + 6, height + 1, 4};
+        const rad::MutableImageView<std::uint8_t> region = padded.View().Crop(6, 1, width, height);
+        for (const bool parallel : {false, true})
+        {
+            if (parallel)
+            {
+                resizer.ResizeParallel(crop, region, pool);
+            }
+            else
+            {
+                resizer.Resize(crop, region);
+            }
+            for (int y = 0; y < height; ++y)
+            {
+                EXPECT_TRUE(std::equal(region.Row(y), region.Row(y) + region.RowSize(),
+                                       reference.Pixel(0, y)));
+            }
+        }
+    }
+
+    EXPECT_TRUE(rad::SavePNG("gradient-crop.png", crop));
+    const auto loaded = rad::ImageUnorm8::LoadFromFile("gradient-crop.png");
+    ASSERT_TRUE(loaded);
+    EXPECT_TRUE(std::equal(cropped.Data(), cropped.Data() + 40 * 30 * 4, loaded->Data()));
+}
+
+// Encodes into reused buffers and decodes from memory: PNG with every filter and a range of
+// levels, serially and on a pool, and the stb_image_write formats.
+void TestEncode()
+{
+    rad::ImageUnorm8 image{1024, 600, 4};
+    FillGradient(image);
+    const rad::ImageView<std::uint8_t> crop = image.View().Crop(3, 5, 301, 97);
+    rad::ImageUnorm8 cropped{301, 97, 4};
+    for (int y = 0; y < cropped.Height(); ++y)
+    {
+        std::memcpy(cropped.Pixel(0, y), crop.Row(y), crop.RowSize());
+    }
+
+    std::vector<std::uint8_t> buffer;
+    for (const rad::PngFilter filter :
+         {rad::PngFilter::None, rad::PngFilter::Sub, rad::PngFilter::Up, rad::PngFilter::Average,
+          rad::PngFilter::Paeth, rad::PngFilter::Adaptive})
+    {
+        for (const int level : {0, 1, 6, 9})
+        {
+            SCOPED_TRACE(testing::Message() << "filter " << static_cast<int>(filter) << ", level "
+                                            << level);
+            ASSERT_TRUE(rad::EncodePNG(crop, buffer, {level, filter}));
+            const auto decoded = rad::ImageUnorm8::LoadFromMemory(buffer.data(), buffer.size());
+            ASSERT_TRUE(decoded);
+            VerifyImage(cropped, *decoded, 0);
+        }
+    }
+
+    // A buffer that has grown to an encoding is reused without reallocating.
+    ASSERT_TRUE(image.EncodePNG(buffer));
+    const std::size_t serialSize = buffer.size();
+    const std::uint8_t* data = buffer.data();
+    ASSERT_TRUE(image.EncodePNG(buffer));
+    EXPECT_EQ(buffer.data(), data);
+    EXPECT_EQ(buffer.size(), serialSize);
+
+    rad::ThreadPool pool(4);
+    ASSERT_TRUE(rad::EncodePNGParallel(image.View(), buffer, {}, pool));
+    EXPECT_LE(buffer.size(), serialSize + serialSize / 50);
+    const auto parallel = rad::ImageUnorm8::LoadFromMemory(buffer.data(), buffer.size());
+    ASSERT_TRUE(parallel);
+    VerifyImage(image, *parallel, 0);
+
+    rad::ImageUnorm8 rgbImage{256, 256, 3};
+    FillGradient(rgbImage);
+    ASSERT_TRUE(rgbImage.EncodeBMP(buffer));
+    const auto bmp = rad::ImageUnorm8::LoadFromMemory(buffer.data(), buffer.size());
+    ASSERT_TRUE(bmp);
+    VerifyImage(rgbImage, *bmp, 0);
+    ASSERT_TRUE(rgbImage.EncodeTGA(buffer));
+    const auto tga = rad::ImageUnorm8::LoadFromMemory(buffer.data(), buffer.size());
+    ASSERT_TRUE(tga);
+    VerifyImage(rgbImage, *tga, 0);
+    ASSERT_TRUE(rgbImage.EncodeJPEG(buffer, 100));
+    const auto jpeg = rad::ImageUnorm8::LoadFromMemory(buffer.data(), buffer.size());
+    ASSERT_TRUE(jpeg);
+    VerifyImage(rgbImage, *jpeg, 8);
+    ASSERT_TRUE(rgbImage.ToFloat32().EncodeHDR(buffer));
+    const auto hdr = rad::ImageFloat32::LoadFromMemory(buffer.data(), buffer.size());
+    ASSERT_TRUE(hdr);
+    EXPECT_EQ(hdr->Width(), 256);
+    EXPECT_EQ(hdr->Channels(), 3);
+
+    // Failures leave the buffer empty.
+    EXPECT_FALSE(image.EncodeJPEG(buffer));
+    EXPECT_TRUE(buffer.empty());
+    ASSERT_TRUE(image.EncodeBMP(buffer));
+    EXPECT_FALSE(image.EncodePNG(buffer, {10, rad::PngFilter::Adaptive}));
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(rad::ImageUnorm8{}.EncodeTGA(buffer));
+}
+
 } // namespace
 
 TEST(IO, Image)
@@ -177,4 +401,20 @@ TEST(IO, Image)
     TestLdrFormats();
     TestHdr();
     TestFailures();
+    TestConversions();
+}
+
+TEST(IO, ImageEncode)
+{
+    TestEncode();
+}
+
+TEST(IO, ImageView)
+{
+    TestViews();
+}
+
+TEST(IO, ImageResizeParallel)
+{
+    TestResizeParallel();
 }
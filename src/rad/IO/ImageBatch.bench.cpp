@@ -0,0 +1,81 @@
+#include <rad/IO/ImageBatch.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t FileCount = 64;
+
+// Noisy images that compress poorly, so that decoding dominates.
+std::vector<std::string> MakeFiles()
+{
+    std::vector<std::string> fileNames;
+    std::mt19937 random(11);
+    rad::ImageUnorm8 image{512, 512, 3};
+    for (std::size_t index = 0; index < FileCount; ++index)
+    {
+        std::uint8_t* data = image.Data();
+        for (std::size_t value = 0; value < std::size_t{512} * 512 * 3; ++value)
+        {
+            data[value] = static_cast<std::uint8_t>(random() & 0xF0);
+        }
+        fileNames.push_back("bench-batch-" + std::to_string(index) + ".png");
+        if (!image.SavePNG(fileNames.back()))
+        {
+            return {};
+        }
+    }
+    return fileNames;
+}
+
+// The loop the batch API replaces.
+void BM_DecodeImagesSerial(benchmark::State& state)
+{
+    const std::vector<std::string> fileNames = MakeFiles();
+    if (fileNames.empty())
+    {
+        state.SkipWithError("failed to write the PNG files");
+        return;
+    }
+    for (auto _ : state)
+    {
+        for (const std::string& fileName : fileNames)
+        {
+            benchmark::DoNotOptimize(rad::ImageUnorm8::LoadFromFile(fileName));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(FileCount));
+}
+
+// The argument is the pool's worker count.
+void BM_DecodeImages(benchmark::State& state)
+{
+    const std::vector<std::string> fileNames = MakeFiles();
+    if (fileNames.empty())
+    {
+        state.SkipWithError("failed to write the PNG files");
+        return;
+    }
+    rad::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        rad::DecodeImages(
+            fileNames, [](std::size_t, std::optional<rad::ImageUnorm8> image)
+            { benchmark::DoNotOptimize(image); },
+            {}, pool);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(FileCount));
+}
+
+} // namespace
+
+BENCHMARK(BM_DecodeImagesSerial)->UseRealTime();
+BENCHMARK(BM_DecodeImages)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -0,0 +1,396 @@
+#include <rad/IO/ImageBatch.h>
+#include <rad/System/MappedFile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace rad
+{
+namespace
+{
+
+using AtomicNanoseconds = std::atomic<Nanoseconds::rep>;
+
+void AddElapsed(AtomicNanoseconds& total, PerfClock::time_point start) noexcept
+{
+    total.fetch_add(std::chrono::duration_cast<Nanoseconds>(PerfClock::now() - start).count(),
+                    std::memory_order_relaxed);
+}
+
+// The decoded size of an image, saturating instead of overflowing for absurd headers.
+[[nodiscard]] std::size_t DecodedSize(const ImageInfo& info, int desiredChannels) noexcept
+{
+    const int channels = desiredChannels != 0 ? desiredChannels : info.channels;
+    const auto rowSize = static_cast<std::size_t>(info.width) * static_cast<std::size_t>(channels);
+    const auto height = static_cast<std::size_t>(info.height);
+    if ((height != 0) && (rowSize > std::numeric_limits<std::size_t>::max() / height))
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+    return rowSize * height;
+}
+
+[[nodiscard]] bool SaveByExtension(const ImageUnorm8& image, const std::string& fileName)
+{
+    std::string extension = std::filesystem::path{fileName}.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char character)
+                   { return static_cast<char>(std::tolower(character)); });
+    if (extension == ".png")
+    {
+        return image.SavePNG(fileName);
+    }
+    if ((extension == ".jpg") || (extension == ".jpeg"))
+    {
+        return image.SaveJPEG(fileName);
+    }
+    if (extension == ".bmp")
+    {
+        return image.SaveBMP(fileName);
+    }
+    if (extension == ".tga")
+    {
+        return image.SaveTGA(fileName);
+    }
+    if (extension == ".hdr")
+    {
+        return image.SaveHDR(fileName);
+    }
+    return false;
+}
+
+// Shared by the workers of one batch and the thread delivering its results. Workers claim items
+// in input order and reserve memory before producing a result; the results wait in m_ready until
+// the calling thread hands them to the callback and releases their memory.
+template <typename Result>
+class Batch
+{
+public:
+    Batch(std::size_t count, const ImageBatchOptions& options) noexcept :
+        m_count(count),
+        m_budget(options.memoryBudget),
+        m_ordered(options.ordered)
+    {
+    }
+
+    [[nodiscard]] bool Claim(std::size_t& index) noexcept
+    {
+        if (m_cancelled.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        index = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+        return index < m_count;
+    }
+
+    // Blocks until bytes fit the budget. Reservations are always granted when nothing else is in
+    // flight, so oversized items run alone, and in ordered mode to the item delivered next, whose
+    // successors may hold the whole budget while they wait for it. Returns false if the batch was
+    // cancelled.
+    [[nodiscard]] bool Reserve(std::size_t index, std::size_t bytes)
+    {
+        const PerfClock::time_point start = PerfClock::now();
+        std::unique_lock lock(m_mutex);
+        m_budgetAvailable.wait(lock,
+                               [&]()
+                               {
+                                   return m_cancelled.load(std::memory_order_relaxed) ||
+                                          (m_bytesInFlight == 0) ||
+                                          ((m_bytesInFlight <= m_budget) &&
+                                           (bytes <= m_budget - m_bytesInFlight)) ||
+                                          (m_ordered && (index == m_nextToDeliver));
+                               });
+        AddElapsed(budgetWaitTime, start);
+        if (m_cancelled.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        m_bytesInFlight += bytes;
+        m_peakBytesInFlight = std::max(m_peakBytesInFlight, m_bytesInFlight);
+        return true;
+    }
+
+    // Returns part of a reservation early, such as a mapped file once it has been decoded.
+    void Release(std::size_t bytes)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_bytesInFlight -= bytes;
+        }
+        m_budgetAvailable.notify_all();
+    }
+
+    // heldBytes is what remains reserved for the result until it has been delivered.
+    void Complete(std::size_t index, Result result, std::size_t heldBytes)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_ready.emplace(index, Entry{std::move(result), heldBytes});
+        }
+        m_resultReady.notify_one();
+    }
+
+    void Cancel()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_cancelled.store(true, std::memory_order_relaxed);
+        }
+        m_budgetAvailable.notify_all();
+    }
+
+    // Runs on the calling thread until every item has been delivered.
+    template <typename Callback>
+    void Deliver(const Callback& callback, ImageBatchStatistics& statistics)
+    {
+        for (std::size_t delivered = 0; delivered < m_count; ++delivered)
+        {
+            typename std::map<std::size_t, Entry>::node_type node;
+            {
+                std::unique_lock lock(m_mutex);
+                m_resultReady.wait(lock,
+                                   [&]()
+                                   {
+                                       return (!m_ready.empty()) &&
+                                              ((!m_ordered) ||
+                                               (m_ready.begin()->first == m_nextToDeliver));
+                                   });
+                node = m_ready.extract(m_ready.begin());
+            }
+            Entry& entry = node.mapped();
+            ++(entry.result ? statistics.succeeded : statistics.failed);
+            const PerfClock::time_point start = PerfClock::now();
+            callback(node.key(), std::move(entry.result));
+            AddElapsed(callbackTime, start);
+            {
+                std::lock_guard lock(m_mutex);
+                m_bytesInFlight -= entry.bytes;
+                ++m_nextToDeliver;
+            }
+            m_budgetAvailable.notify_all();
+        }
+    }
+
+    [[nodiscard]] std::size_t PeakBytesInFlight()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_peakBytesInFlight;
+    }
+
+    AtomicNanoseconds readTime = 0;
+    AtomicNanoseconds decodeTime = 0;
+    AtomicNanoseconds encodeTime = 0;
+    AtomicNanoseconds budgetWaitTime = 0;
+    AtomicNanoseconds callbackTime = 0;
+
+private:
+    struct Entry
+    {
+        Result result;
+        std::size_t bytes;
+    };
+
+    const std::size_t m_count;
+    const std::size_t m_budget;
+    const bool m_ordered;
+    std::atomic<std::size_t> m_nextIndex = 0;
+    std::atomic<bool> m_cancelled = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_budgetAvailable;
+    std::condition_variable m_resultReady;
+    std::size_t m_bytesInFlight = 0;
+    std::size_t m_peakBytesInFlight = 0;
+    std::size_t m_nextToDeliver = 0;
+    std::map<std::size_t, Entry> m_ready;
+};
+
+// Runs process(batch, index) for every input on the pool and delivers the results. process
+// returns the result and the bytes still reserved for it; an exception fails the item.
+template <typename Result, typename Process, typename Callback>
+ImageBatchStatistics RunBatch(std::size_t count, const ImageBatchOptions& options,
+                              ThreadPool& pool, const Process& process, const Callback& callback)
+{
+    const PerfClock::time_point start = PerfClock::now();
+    ImageBatchStatistics statistics;
+    Batch<Result> batch(count, options);
+    const auto work = [&]()
+    {
+        std::size_t index = 0;
+        while (batch.Claim(index))
+        {
+            std::pair<Result, std::size_t> result{};
+            try
+            {
+                result = process(batch, index);
+            }
+            catch (...)
+            {
+                result = {};
+            }
+            batch.Complete(index, std::move(result.first), result.second);
+        }
+    };
+
+    std::vector<std::future<void>> workers;
+    const std::size_t workerCount = std::min(count, pool.GetThreadCount());
+    workers.reserve(workerCount);
+    std::exception_ptr exception;
+    try
+    {
+        for (std::size_t worker = 0; worker < workerCount; ++worker)
+        {
+            workers.push_back(pool.Submit(work));
+        }
+        batch.Deliver(callback, statistics);
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+        batch.Cancel();
+    }
+    for (std::future<void>& worker : workers)
+    {
+        worker.wait();
+    }
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    statistics.readTime = Nanoseconds{batch.readTime.load()};
+    statistics.decodeTime = Nanoseconds{batch.decodeTime.load()};
+    statistics.encodeTime = Nanoseconds{batch.encodeTime.load()};
+    statistics.budgetWaitTime = Nanoseconds{batch.budgetWaitTime.load()};
+    statistics.callbackTime = Nanoseconds{batch.callbackTime.load()};
+    statistics.wallTime = std::chrono::duration_cast<Nanoseconds>(PerfClock::now() - start);
+    statistics.peakBytesInFlight = batch.PeakBytesInFlight();
+    return statistics;
+}
+
+// Decodes one image. The reservation covers encodedBytes, the part of the input that counts
+// against the budget, until the decode finishes, and the pixels until the result is delivered.
+// Reading the header first sizes the reservation without touching the rest of the input.
+[[nodiscard]] std::pair<std::optional<ImageUnorm8>, std::size_t> Decode(
+    Batch<std::optional<ImageUnorm8>>& batch, std::size_t index, const void* data,
+    std::size_t size, std::size_t encodedBytes, const ImageBatchOptions& options)
+{
+    PerfClock::time_point start = PerfClock::now();
+    const std::optional<ImageInfo> info = ImageInfo::Probe(data, size);
+    AddElapsed(batch.readTime, start);
+    if (!info)
+    {
+        return {std::nullopt, 0};
+    }
+    const std::size_t decodedBytes = DecodedSize(*info, options.desiredChannels);
+    const std::size_t reservedBytes =
+        std::min(decodedBytes, std::numeric_limits<std::size_t>::max() - encodedBytes) +
+        encodedBytes;
+    if (!batch.Reserve(index, reservedBytes))
+    {
+        return {std::nullopt, 0};
+    }
+
+    start = PerfClock::now();
+    std::optional<ImageUnorm8> image;
+    try
+    {
+        image = ImageUnorm8::LoadFromMemory(data, size, options.desiredChannels);
+    }
+    catch (...)
+    {
+    }
+    AddElapsed(batch.decodeTime, start);
+    if (!image)
+    {
+        batch.Release(reservedBytes);
+        return {std::nullopt, 0};
+    }
+    batch.Release(reservedBytes - decodedBytes);
+    return {std::move(image), decodedBytes};
+}
+
+} // namespace
+
+ImageBatchStatistics DecodeImages(Span<const std::string> fileNames,
+                                  const ImageDecodeCallback& callback,
+                                  const ImageBatchOptions& options, ThreadPool& pool)
+{
+    using Result = std::optional<ImageUnorm8>;
+    return RunBatch<Result>(
+        fileNames.size(), options, pool,
+        [&](Batch<Result>& batch, std::size_t index) -> std::pair<Result, std::size_t>
+        {
+            const PerfClock::time_point start = PerfClock::now();
+            std::error_code error;
+            const MappedFile file{std::filesystem::path{fileNames[index]}, error};
+            AddElapsed(batch.readTime, start);
+            if (error)
+            {
+                return {std::nullopt, 0};
+            }
+            return Decode(batch, index, file.Data(), file.Size(), file.Size(), options);
+        },
+        callback);
+}
+
+ImageBatchStatistics DecodeImages(Span<const Span<const std::uint8_t>> buffers,
+                                  const ImageDecodeCallback& callback,
+                                  const ImageBatchOptions& options, ThreadPool& pool)
+{
+    using Result = std::optional<ImageUnorm8>;
+    return RunBatch<Result>(
+        buffers.size(), options, pool,
+        [&](Batch<Result>& batch, std::size_t index)
+        {
+            const Span<const std::uint8_t> buffer = buffers[index];
+            return Decode(batch, index, buffer.data(), buffer.size(), 0, options);
+        },
+        callback);
+}
+
+ImageBatchStatistics EncodeImages(Span<const ImageUnorm8> images,
+                                  Span<const std::string> fileNames,
+                                  const ImageEncodeCallback& callback,
+                                  const ImageBatchOptions& options, ThreadPool& pool)
+{
+    if (images.size() != fileNames.size())
+    {
+        throw std::invalid_argument{"every image needs one file name"};
+    }
+    return RunBatch<bool>(
+        images.size(), options, pool,
+        [&](Batch<bool>& batch, std::size_t index) -> std::pair<bool, std::size_t>
+        {
+            const ImageUnorm8& image = images[index];
+            // The encoders build the whole file in memory, which is at most about the size of
+            // the pixels.
+            const std::size_t bytes = static_cast<std::size_t>(image.Width()) *
+                                      static_cast<std::size_t>(image.Height()) *
+                                      static_cast<std::size_t>(image.Channels());
+            if (!batch.Reserve(index, bytes))
+            {
+                return {false, 0};
+            }
+            const PerfClock::time_point start = PerfClock::now();
+            const bool saved = SaveByExtension(image, fileNames[index]);
+            AddElapsed(batch.encodeTime, start);
+            batch.Release(bytes);
+            return {saved, 0};
+        },
+        callback);
+}
+
+} // namespace rad
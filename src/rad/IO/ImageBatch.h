@@ -0,0 +1,76 @@
+#pragma once
+
+#include <rad/Core/Span.h>
+#include <rad/IO/Image.h>
+#include <rad/System/ThreadPool.h>
+#include <rad/System/Time.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace rad
+{
+
+struct ImageBatchOptions
+{
+    // 0 preserves each source's channel count; otherwise 1 through 4. Ignored when encoding.
+    int desiredChannels = 0;
+    // Bounds the memory held by items in flight: the mapped file and decoded pixels of a decode,
+    // or the pixels being encoded. An item larger than the budget still runs, on its own.
+    std::size_t memoryBudget = std::size_t{1} << 30;
+    // Delivers results in input order; otherwise as soon as each item completes.
+    bool ordered = true;
+};
+
+// Stage times are summed over every thread, so with many workers they exceed wallTime.
+struct ImageBatchStatistics
+{
+    std::size_t succeeded = 0;
+    std::size_t failed = 0;
+    // Mapping files and reading their headers.
+    Nanoseconds readTime{};
+    Nanoseconds decodeTime{};
+    // Encoding and writing files.
+    Nanoseconds encodeTime{};
+    // Workers blocked waiting for the memory budget.
+    Nanoseconds budgetWaitTime{};
+    // The calling thread inside the callback.
+    Nanoseconds callbackTime{};
+    Nanoseconds wallTime{};
+    std::size_t peakBytesInFlight = 0;
+};
+
+// Receives the index of the input and its image, or std::nullopt if it could not be decoded.
+using ImageDecodeCallback = std::function<void(std::size_t index, std::optional<ImageUnorm8>)>;
+// Receives the index of the input and whether it was written.
+using ImageEncodeCallback = std::function<void(std::size_t index, bool saved)>;
+
+// Decode and encode many images on the pool's workers. Workers take the inputs in order, and the
+// calling thread runs every callback, one at a time. An item's memory counts against the budget
+// until its callback returns. The calling thread must not be one of the pool's workers. If a
+// callback throws, the remaining items are abandoned and the exception is rethrown once the
+// workers have stopped.
+
+// Decodes files as ImageUnorm8::LoadFromFile does.
+ImageBatchStatistics DecodeImages(Span<const std::string> fileNames,
+                                  const ImageDecodeCallback& callback,
+                                  const ImageBatchOptions& options = {},
+                                  ThreadPool& pool = GetGlobalThreadPool());
+// Decodes encoded images held in memory as ImageUnorm8::LoadFromMemory does. The buffers must
+// stay alive until the call returns.
+ImageBatchStatistics DecodeImages(Span<const Span<const std::uint8_t>> buffers,
+                                  const ImageDecodeCallback& callback,
+                                  const ImageBatchOptions& options = {},
+                                  ThreadPool& pool = GetGlobalThreadPool());
+// Writes images[i] to fileNames[i], choosing the format from the extension: .png, .jpg or .jpeg
+// (quality 90), .bmp, .tga or .hdr, in any case. Other extensions fail.
+ImageBatchStatistics EncodeImages(Span<const ImageUnorm8> images,
+                                  Span<const std::string> fileNames,
+                                  const ImageEncodeCallback& callback,
+                                  const ImageBatchOptions& options = {},
+                                  ThreadPool& pool = GetGlobalThreadPool());
+
+} // namespace rad
@@ -0,0 +1,147 @@
+#include <rad/IO/ImageBatch.h>
+#include <rad/System/MappedFile.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Images of different sizes and channel counts, so that items finish out of order.
+std::vector<rad::ImageUnorm8> MakeImages(std::size_t count)
+{
+    std::vector<rad::ImageUnorm8> images;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const int size = 8 + static_cast<int>(index * 37 % 120);
+        const int channels = 1 + static_cast<int>(index % 4);
+        rad::ImageUnorm8 image{size, size + 3, channels};
+        std::uint8_t* data = image.Data();
+        const std::size_t valueCount = static_cast<std::size_t>(size) * (size + 3) * channels;
+        for (std::size_t value = 0; value < valueCount; ++value)
+        {
+            data[value] = static_cast<std::uint8_t>(value * 13 + index);
+        }
+        images.push_back(std::move(image));
+    }
+    return images;
+}
+
+bool SameImage(const rad::ImageUnorm8& lhs, const rad::ImageUnorm8& rhs)
+{
+    return (lhs.Width() == rhs.Width()) && (lhs.Height() == rhs.Height()) &&
+           (lhs.Channels() == rhs.Channels()) &&
+           std::equal(lhs.Data(), lhs.Data() + lhs.Width() * lhs.Height() * lhs.Channels(),
+                      rhs.Data());
+}
+
+} // namespace
+
+TEST(IO, ImageBatch)
+{
+    rad::ThreadPool pool(4);
+    const std::vector<rad::ImageUnorm8> images = MakeImages(24);
+    std::vector<std::string> fileNames;
+    for (std::size_t index = 0; index < images.size(); ++index)
+    {
+        fileNames.push_back("batch-" + std::to_string(index) + (index % 2 == 0 ? ".png" : ".TGA"));
+    }
+    fileNames[5] = "batch-5.unknown";
+
+    std::vector<std::size_t> order;
+    const rad::ImageBatchStatistics encoded = rad::EncodeImages(
+        images, fileNames,
+        [&](std::size_t index, bool saved)
+        {
+            order.push_back(index);
+            EXPECT_EQ(saved, index != 5) << index;
+        },
+        {}, pool);
+    EXPECT_EQ(encoded.succeeded, images.size() - 1);
+    EXPECT_EQ(encoded.failed, 1u);
+    for (std::size_t index = 0; index < order.size(); ++index)
+    {
+        EXPECT_EQ(order[index], index);
+    }
+
+    // A budget smaller than most images still decodes every one, in order.
+    order.clear();
+    rad::ImageBatchOptions options;
+    options.memoryBudget = 1000;
+    const rad::ImageBatchStatistics decoded = rad::DecodeImages(
+        fileNames,
+        [&](std::size_t index, std::optional<rad::ImageUnorm8> image)
+        {
+            order.push_back(index);
+            ASSERT_EQ(image.has_value(), index != 5) << index;
+            if (image)
+            {
+                EXPECT_TRUE(SameImage(*image, images[index])) << index;
+            }
+        },
+        options, pool);
+    ASSERT_EQ(order.size(), images.size());
+    for (std::size_t index = 0; index < order.size(); ++index)
+    {
+        EXPECT_EQ(order[index], index);
+    }
+    EXPECT_EQ(decoded.succeeded, images.size() - 1);
+    EXPECT_EQ(decoded.failed, 1u);
+    EXPECT_GT(decoded.decodeTime.count(), 0);
+    EXPECT_GT(decoded.wallTime.count(), 0);
+    EXPECT_GT(decoded.peakBytesInFlight, 0u);
+
+    // Decoding from memory, in completion order, with desired channels.
+    std::vector<rad::MappedFile> files;
+    std::vector<rad::Span<const std::uint8_t>> buffers;
+    for (const std::string& fileName : fileNames)
+    {
+        std::error_code error;
+        files.emplace_back(fileName, error);
+        buffers.emplace_back(reinterpret_cast<const std::uint8_t*>(files.back().Data()),
+                             files.back().Size());
+    }
+    options.ordered = false;
+    options.desiredChannels = 4;
+    options.memoryBudget = 64 * 1024;
+    std::vector<int> deliveries(images.size());
+    const rad::ImageBatchStatistics fromMemory = rad::DecodeImages(
+        buffers,
+        [&](std::size_t index, std::optional<rad::ImageUnorm8> image)
+        {
+            ++deliveries[index];
+            if (image)
+            {
+                EXPECT_EQ(image->Channels(), 4);
+                EXPECT_EQ(image->Width(), images[index].Width());
+            }
+        },
+        options, pool);
+    EXPECT_EQ(fromMemory.succeeded, images.size() - 1);
+    EXPECT_TRUE(std::all_of(deliveries.begin(), deliveries.end(),
+                            [](int count) { return count == 1; }));
+    // Only an item delivered next may exceed the budget, by at most its own size.
+    EXPECT_LE(fromMemory.peakBytesInFlight, options.memoryBudget + 128 * 131 * 4);
+
+    std::size_t calls = 0;
+    EXPECT_THROW(rad::DecodeImages(
+                     fileNames,
+                     [&](std::size_t, std::optional<rad::ImageUnorm8>)
+                     {
+                         if (++calls == 3)
+                         {
+                             throw std::runtime_error("callback failed");
+                         }
+                     },
+                     {}, pool),
+                 std::runtime_error);
+    EXPECT_EQ(calls, 3u);
+    EXPECT_EQ(pool.Submit([]() { return 7; }).get(), 7);
+}
@@ -0,0 +1,56 @@
+#include <rad/IO/ImageCache.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace
+{
+
+const std::string FileName = "bench-cache.png";
+
+bool SaveImage()
+{
+    rad::ImageUnorm8 image{512, 512, 3};
+    std::uint8_t* data = image.Data();
+    for (std::size_t value = 0; value < std::size_t{512} * 512 * 3; ++value)
+    {
+        data[value] = static_cast<std::uint8_t>(value * 7);
+    }
+    return image.SavePNG(FileName);
+}
+
+// What every request costs without the cache.
+void BM_ImageCacheMiss(benchmark::State& state)
+{
+    if (!SaveImage())
+    {
+        state.SkipWithError("failed to write the PNG file");
+        return;
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rad::ImageUnorm8::LoadFromFile(FileName));
+    }
+}
+
+// A hit costs one stat of the file and a lookup; threads contend for the cache's lock.
+void BM_ImageCacheHit(benchmark::State& state)
+{
+    static rad::ImageCache cache{std::size_t{64} << 20};
+    if ((state.thread_index() == 0) && (!SaveImage() || !cache.Get(FileName)))
+    {
+        state.SkipWithError("failed to write the PNG file");
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(cache.Get(FileName));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ImageCacheMiss);
+BENCHMARK(BM_ImageCacheHit)->Threads(1)->Threads(4)->UseRealTime();
@@ -0,0 +1,250 @@
+#include <rad/IO/ImageCache.h>
+#include <rad/Core/Hash.h>
+#include <rad/System/OS.h>
+
+#include <exception>
+#include <future>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+namespace rad
+{
+
+namespace
+{
+
+struct CacheKey
+{
+    std::string fileName;
+    int desiredChannels = 0;
+
+    bool operator==(const CacheKey&) const = default;
+};
+
+struct CacheKeyHash
+{
+    [[nodiscard]] std::size_t operator()(const CacheKey& key) const noexcept
+    {
+        return static_cast<std::size_t>(
+            HashCombine(HashBytes64(key.fileName.data(), key.fileName.size()),
+                        static_cast<Uint64>(key.desiredChannels)));
+    }
+};
+
+// Tells whether a file changed since it was loaded, without reading it. The device and inode
+// catch a path replaced by rename, and the status change time catches rewrites that restore the
+// modification time. Rewrites in place within the file system's timestamp granularity, at the
+// same size, cannot be detected.
+struct FileVersion
+{
+    std::uintmax_t device = 0;
+    std::uintmax_t inode = 0;
+    std::uintmax_t size = 0;
+    os::FileTime mtime{};
+    os::FileTime ctime{};
+
+    bool operator==(const FileVersion&) const = default;
+};
+
+using ImagePointer = std::shared_ptr<const ImageUnorm8>;
+
+[[nodiscard]] std::size_t GetImageBytes(const ImageUnorm8& image) noexcept
+{
+    return static_cast<std::size_t>(image.Width()) * static_cast<std::size_t>(image.Height()) *
+           static_cast<std::size_t>(image.Channels());
+}
+
+} // namespace
+
+struct ImageCache::State
+{
+    struct Entry
+    {
+        FileVersion version;
+        // Becomes ready when the thread that created the entry finishes loading.
+        std::shared_future<ImagePointer> image;
+        bool ready = false;
+        std::size_t bytes = 0;
+        // Valid once ready.
+        std::list<const CacheKey*>::iterator recency;
+    };
+
+    using EntryMap = std::unordered_map<CacheKey, std::shared_ptr<Entry>, CacheKeyHash>;
+
+    explicit State(std::size_t byteBudget) : byteBudget(byteBudget) {}
+
+    // Removes the entry and, if it was ready, its bytes.
+    void Erase(EntryMap::iterator position)
+    {
+        const Entry& entry = *position->second;
+        if (entry.ready)
+        {
+            recency.erase(entry.recency);
+            bytes -= entry.bytes;
+        }
+        entries.erase(position);
+    }
+
+    void Evict()
+    {
+        while ((bytes > byteBudget) && !recency.empty())
+        {
+            Erase(entries.find(*recency.back()));
+            ++evictions;
+        }
+    }
+
+    const std::size_t byteBudget;
+    mutable std::mutex mutex;
+    // Ready entries and loads in progress. Map nodes keep their address, so recency can point at
+    // the keys.
+    EntryMap entries;
+    // Ready entries, most recently used first.
+    std::list<const CacheKey*> recency;
+    std::size_t bytes = 0;
+    std::uint64_t hits = 0;
+    std::uint64_t sharedLoads = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+};
+
+ImageCache::ImageCache(std::size_t byteBudget) : m_state(std::make_unique<State>(byteBudget)) {}
+
+ImageCache::~ImageCache() = default;
+
+std::shared_ptr<const ImageUnorm8> ImageCache::Get(const std::string& fileName,
+                                                   int desiredChannels)
+{
+    State& state = *m_state;
+    std::optional<FileVersion> version;
+    try
+    {
+        const os::StatResult info = os::stat(fileName);
+        version = FileVersion{info.device, info.inode, info.size, info.mtime, info.ctime};
+    }
+    catch (const std::system_error&)
+    {
+    }
+
+    CacheKey key{fileName, desiredChannels};
+    std::unique_lock lock{state.mutex};
+    auto found = state.entries.find(key);
+    if (!version)
+    {
+        if (found != state.entries.end())
+        {
+            state.Erase(found);
+        }
+        ++state.misses;
+        return nullptr;
+    }
+    if (found != state.entries.end())
+    {
+        State::Entry& entry = *found->second;
+        if (entry.version == *version)
+        {
+            if (entry.ready)
+            {
+                ++state.hits;
+                state.recency.splice(state.recency.begin(), state.recency, entry.recency);
+                return entry.image.get();
+            }
+            ++state.sharedLoads;
+            const std::shared_future<ImagePointer> pending = entry.image;
+            lock.unlock();
+            return pending.get();
+        }
+        // The file changed; requests still waiting on the old load keep their future.
+        state.Erase(found);
+    }
+
+    ++state.misses;
+    std::promise<ImagePointer> promise;
+    const auto entry = std::make_shared<State::Entry>();
+    entry->version = *version;
+    entry->image = promise.get_future().share();
+    state.entries.emplace(key, entry);
+    lock.unlock();
+
+    // The slot may have been cleared or taken by a newer version of the file meanwhile.
+    const auto takeOwnEntry = [&]() -> State::EntryMap::iterator
+    {
+        const auto position = state.entries.find(key);
+        return ((position != state.entries.end()) && (position->second == entry))
+                   ? position
+                   : state.entries.end();
+    };
+
+    ImagePointer image;
+    try
+    {
+        std::optional<ImageUnorm8> loaded = ImageUnorm8::LoadFromFile(fileName, desiredChannels);
+        if (loaded)
+        {
+            image = std::make_shared<const ImageUnorm8>(std::move(*loaded));
+        }
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+        lock.lock();
+        if (const auto position = takeOwnEntry(); position != state.entries.end())
+        {
+            state.entries.erase(position);
+        }
+        throw;
+    }
+    promise.set_value(image);
+
+    lock.lock();
+    const auto position = takeOwnEntry();
+    if (position == state.entries.end())
+    {
+        return image;
+    }
+    const std::size_t bytes = image ? GetImageBytes(*image) : 0;
+    if (!image || (bytes > state.byteBudget))
+    {
+        state.entries.erase(position);
+        return image;
+    }
+    state.recency.push_front(&position->first);
+    entry->recency = state.recency.begin();
+    entry->bytes = bytes;
+    entry->ready = true;
+    state.bytes += bytes;
+    state.Evict();
+    return image;
+}
+
+void ImageCache::Clear()
+{
+    std::lock_guard lock{m_state->mutex};
+    m_state->entries.clear();
+    m_state->recency.clear();
+    m_state->bytes = 0;
+}
+
+std::size_t ImageCache::GetByteBudget() const noexcept
+{
+    return m_state->byteBudget;
+}
+
+ImageCacheStatistics ImageCache::GetStatistics() const
+{
+    std::lock_guard lock{m_state->mutex};
+    ImageCacheStatistics statistics;
+    statistics.hits = m_state->hits;
+    statistics.sharedLoads = m_state->sharedLoads;
+    statistics.misses = m_state->misses;
+    statistics.evictions = m_state->evictions;
+    statistics.entryCount = m_state->recency.size();
+    statistics.bytes = m_state->bytes;
+    return statistics;
+}
+
+} // namespace rad
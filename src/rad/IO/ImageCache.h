@@ -0,0 +1,61 @@
+#pragma once
+
+#include <rad/IO/Image.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace rad
+{
+
+struct ImageCacheStatistics
+{
+    // Requests served from the cache.
+    std::uint64_t hits = 0;
+    // Requests that waited for another thread already loading the same image.
+    std::uint64_t sharedLoads = 0;
+    // Requests that loaded the image themselves, or found no readable file.
+    std::uint64_t misses = 0;
+    // Images dropped, least recently used first, to stay within the budget.
+    std::uint64_t evictions = 0;
+    std::size_t entryCount = 0;
+    // Pixel bytes of the cached images.
+    std::size_t bytes = 0;
+};
+
+// Keeps decoded images for reuse, keyed by file name, desired channel count, and the file's
+// identity, size and change times from os::stat, so a file replaced or rewritten since it was
+// cached is loaded again; only a same-size rewrite in place within the file system's timestamp
+// granularity goes unnoticed. Images are shared and immutable; callers may keep them after they
+// are evicted. When the images exceed the byte budget, the least recently used are evicted; an
+// image larger than the whole budget is returned but not kept. Thread-safe: concurrent requests
+// for the same image wait for one load instead of decoding it again, and loads of different
+// images run in parallel.
+class ImageCache
+{
+public:
+    explicit ImageCache(std::size_t byteBudget);
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+    ~ImageCache();
+
+    // Loads the image as ImageUnorm8::LoadFromFile does, unless it is cached. Returns nullptr if
+    // the file is missing or cannot be decoded; failures are not cached. Requests waiting on a
+    // load that throws receive the same exception.
+    [[nodiscard]] std::shared_ptr<const ImageUnorm8> Get(const std::string& fileName,
+                                                         int desiredChannels = 0);
+    // Drops every cached image. Loads in progress complete but are not kept.
+    void Clear();
+
+    [[nodiscard]] std::size_t GetByteBudget() const noexcept;
+    [[nodiscard]] ImageCacheStatistics GetStatistics() const;
+
+private:
+    struct State;
+
+    std::unique_ptr<State> m_state;
+}; // class ImageCache
+
+} // namespace rad
@@ -0,0 +1,121 @@
+#include <rad/IO/ImageCache.h>
+#include <rad/System/OS.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+bool SaveImage(const std::string& fileName, int width, int height, std::uint8_t seed)
+{
+    rad::ImageUnorm8 image{width, height, 3};
+    std::uint8_t* data = image.Data();
+    for (std::size_t value = 0; value < static_cast<std::size_t>(width) * height * 3; ++value)
+    {
+        data[value] = static_cast<std::uint8_t>(value * 7 + seed);
+    }
+    return image.SavePNG(fileName);
+}
+
+} // namespace
+
+TEST(IO, ImageCache)
+{
+    ASSERT_TRUE(SaveImage("cache-a.png", 16, 16, 1));
+    ASSERT_TRUE(SaveImage("cache-b.png", 16, 16, 2));
+    ASSERT_TRUE(SaveImage("cache-c.png", 16, 16, 3));
+    constexpr std::size_t imageBytes = 16 * 16 * 3;
+
+    rad::ImageCache cache{2 * imageBytes};
+    EXPECT_EQ(cache.GetByteBudget(), 2 * imageBytes);
+    const std::shared_ptr<const rad::ImageUnorm8> a = cache.Get("cache-a.png");
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a->Channels(), 3);
+    EXPECT_EQ(cache.Get("cache-a.png"), a);
+    // The channel count is part of the key.
+    const std::shared_ptr<const rad::ImageUnorm8> gray = cache.Get("cache-a.png", 1);
+    ASSERT_NE(gray, nullptr);
+    EXPECT_EQ(gray->Channels(), 1);
+    EXPECT_EQ(cache.Get("missing.png"), nullptr);
+
+    rad::ImageCacheStatistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.hits, 1u);
+    EXPECT_EQ(statistics.misses, 3u);
+    EXPECT_EQ(statistics.evictions, 0u);
+    EXPECT_EQ(statistics.entryCount, 2u);
+    EXPECT_EQ(statistics.bytes, imageBytes + imageBytes / 3);
+
+    // Touching a makes gray the least recently used, so loading b evicts gray; touching a again
+    // leaves b to be evicted by c.
+    EXPECT_EQ(cache.Get("cache-a.png"), a);
+    const std::shared_ptr<const rad::ImageUnorm8> b = cache.Get("cache-b.png");
+    EXPECT_EQ(cache.GetStatistics().evictions, 1u);
+    EXPECT_EQ(cache.Get("cache-a.png"), a);
+    EXPECT_NE(cache.Get("cache-c.png"), nullptr);
+    statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.evictions, 2u);
+    EXPECT_EQ(statistics.entryCount, 2u);
+    EXPECT_EQ(statistics.bytes, 2 * imageBytes);
+    EXPECT_EQ(cache.Get("cache-a.png"), a);
+    // Evicted images stay valid for their holders, and load again on request.
+    EXPECT_EQ(b->Width(), 16);
+    EXPECT_NE(cache.Get("cache-b.png"), b);
+
+    // Rewriting a file invalidates its entry.
+    ASSERT_TRUE(SaveImage("cache-a.png", 8, 8, 4));
+    const std::shared_ptr<const rad::ImageUnorm8> rewritten = cache.Get("cache-a.png");
+    ASSERT_NE(rewritten, nullptr);
+    EXPECT_EQ(rewritten->Width(), 8);
+    EXPECT_EQ(a->Width(), 16);
+
+    // Replacing a file with a same-sized image, as an atomic save does, also invalidates it,
+    // even within the same second.
+    ASSERT_TRUE(SaveImage("cache-b.png.tmp", 16, 16, 7));
+    const std::shared_ptr<const rad::ImageUnorm8> before = cache.Get("cache-b.png");
+    rad::os::replace("cache-b.png.tmp", "cache-b.png");
+    const std::shared_ptr<const rad::ImageUnorm8> after = cache.Get("cache-b.png");
+    ASSERT_NE(after, nullptr);
+    EXPECT_NE(after, before);
+    EXPECT_EQ(after->Width(), 16);
+    EXPECT_EQ(after->Data()[0], 7);
+    EXPECT_EQ(before->Data()[0], 2);
+
+    // Images larger than the budget are returned but not kept.
+    ASSERT_TRUE(SaveImage("cache-large.png", 64, 64, 5));
+    const std::size_t entryCount = cache.GetStatistics().entryCount;
+    EXPECT_NE(cache.Get("cache-large.png"), nullptr);
+    EXPECT_EQ(cache.GetStatistics().entryCount, entryCount);
+
+    cache.Clear();
+    statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.entryCount, 0u);
+    EXPECT_EQ(statistics.bytes, 0u);
+}
+
+TEST(IO, ImageCacheConcurrent)
+{
+    ASSERT_TRUE(SaveImage("cache-shared.png", 512, 512, 6));
+    rad::ImageCache cache{std::size_t{64} << 20};
+    rad::ThreadPool pool(8);
+    constexpr std::size_t requestCount = 64;
+    std::vector<std::shared_ptr<const rad::ImageUnorm8>> images(requestCount);
+    pool.ParallelFor(requestCount,
+                     [&](std::size_t index) { images[index] = cache.Get("cache-shared.png"); });
+
+    // Exactly one request decodes the file; the others share its image.
+    ASSERT_NE(images[0], nullptr);
+    for (const std::shared_ptr<const rad::ImageUnorm8>& image : images)
+    {
+        EXPECT_EQ(image, images[0]);
+    }
+    const rad::ImageCacheStatistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.hits + statistics.sharedLoads, requestCount - 1);
+    EXPECT_EQ(statistics.entryCount, 1u);
+}
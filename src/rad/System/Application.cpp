@@ -65,6 +65,10 @@ bool IsUtf8Locale(std::string_view name)
         return "Object";
     case AllocationKind::ObjectArray:
         return "ObjectArray";
+    case AllocationKind::Pooled:
+        return "Pooled";
+    case AllocationKind::Large:
+        return "Large";
     }
     return "Unknown";
 }
@@ -1,8 +1,17 @@
 #include <rad/System/CpuInfo.h>
 
+#include <atomic>
+
 namespace rad
 {
 
+namespace
+{
+
+std::atomic<SimdLevel> g_simdLevelLimit = SimdLevel::NEON;
+
+} // namespace
+
 std::string_view GetCpuBrandString() noexcept
 {
 #if defined(CPU_FEATURES_ARCH_X86)
@@ -18,6 +27,77 @@ std::string_view GetCpuBrandString() noexcept
 #endif
 }
 
+bool IsSimdLevelSupported(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+    case SimdLevel::Scalar:
+        return true;
+#if defined(CPU_FEATURES_ARCH_X86)
+    case SimdLevel::SSE4_2:
+    {
+        const cpu_features::X86Features& features = GetX86Info().features;
+        return features.ssse3 && features.sse4_1 && features.sse4_2 && features.popcnt;
+    }
+    case SimdLevel::AVX2:
+    {
+        const cpu_features::X86Features& features = GetX86Info().features;
+        return IsSimdLevelSupported(SimdLevel::SSE4_2) && features.avx2 && features.fma3 &&
+               features.f16c && features.bmi1 && features.bmi2;
+    }
+    case SimdLevel::AVX512:
+    {
+        const cpu_features::X86Features& features = GetX86Info().features;
+        return IsSimdLevelSupported(SimdLevel::AVX2) && features.avx512f && features.avx512bw &&
+               features.avx512dq && features.avx512vl;
+    }
+#elif defined(CPU_FEATURES_ARCH_AARCH64)
+    case SimdLevel::NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+SimdLevel GetSimdLevel() noexcept
+{
+    // Resolved once; the limit only narrows it down.
+    static const SimdLevel detected = []() noexcept
+    {
+        for (SimdLevel level : {SimdLevel::NEON, SimdLevel::AVX512, SimdLevel::AVX2,
+                                SimdLevel::SSE4_2})
+        {
+            if (IsSimdLevelSupported(level))
+            {
+                return level;
+            }
+        }
+        return SimdLevel::Scalar;
+    }();
+
+    const SimdLevel limit = g_simdLevelLimit.load(std::memory_order_relaxed);
+    if (detected <= limit)
+    {
+        return detected;
+    }
+    // Levels from different architectures are not ordered against each other, so fall back to
+    // the highest supported level at or below the limit.
+    for (int level = static_cast<int>(limit); level > 0; --level)
+    {
+        if (IsSimdLevelSupported(static_cast<SimdLevel>(level)))
+        {
+            return static_cast<SimdLevel>(level);
+        }
+    }
+    return SimdLevel::Scalar;
+}
+
+void SetSimdLevelLimit(SimdLevel limit) noexcept
+{
+    g_simdLevelLimit.store(limit, std::memory_order_relaxed);
+}
+
 #if defined(CPU_FEATURES_ARCH_X86)
 const cpu_features::X86Info& GetX86Info()
 {
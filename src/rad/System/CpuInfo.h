@@ -31,6 +31,28 @@ namespace rad
 
 [[nodiscard]] std::string_view GetCpuBrandString() noexcept;
 
+// Instruction-set tiers for kernels that are selected at run time. Each x86 tier implies the
+// ones below it.
+enum class SimdLevel
+{
+    Scalar,
+    // x86-64-v2: SSSE3, SSE4.1, SSE4.2 and POPCNT.
+    SSE4_2,
+    // x86-64-v3: AVX2, FMA, F16C, BMI1 and BMI2.
+    AVX2,
+    // x86-64-v4: AVX-512 F, BW, DQ and VL.
+    AVX512,
+    // AArch64 Advanced SIMD, which every AArch64 CPU has.
+    NEON,
+};
+
+[[nodiscard]] bool IsSimdLevelSupported(SimdLevel level) noexcept;
+// Returns the highest supported level that does not exceed the limit set by SetSimdLevelLimit.
+[[nodiscard]] SimdLevel GetSimdLevel() noexcept;
+// Caps the level returned by GetSimdLevel, e.g. to compare kernels in tests and benchmarks.
+// Defaults to the highest level; not intended to be changed while kernels run on other threads.
+void SetSimdLevelLimit(SimdLevel limit) noexcept;
+
 #if defined(CPU_FEATURES_ARCH_X86)
 const cpu_features::X86Info& GetX86Info();
 const cpu_features::CacheInfo& GetX86CacheInfo();
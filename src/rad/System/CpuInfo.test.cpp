@@ -10,3 +10,15 @@ TEST(System, CpuInfo)
     std::cout << "CPU: " << brand << '\n';
     EXPECT_FALSE(brand.empty());
 }
+
+TEST(System, SimdLevel)
+{
+    const rad::SimdLevel detected = rad::GetSimdLevel();
+    EXPECT_TRUE(rad::IsSimdLevelSupported(detected));
+    EXPECT_TRUE(rad::IsSimdLevelSupported(rad::SimdLevel::Scalar));
+
+    rad::SetSimdLevelLimit(rad::SimdLevel::Scalar);
+    EXPECT_EQ(rad::GetSimdLevel(), rad::SimdLevel::Scalar);
+    rad::SetSimdLevelLimit(rad::SimdLevel::NEON);
+    EXPECT_EQ(rad::GetSimdLevel(), detected);
+}
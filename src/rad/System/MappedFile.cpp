@@ -0,0 +1,178 @@
+#include <rad/System/MappedFile.h>
+#include <rad/Core/Platform.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#if defined(RAD_OS_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rad
+{
+namespace
+{
+
+[[nodiscard]] std::error_code LastError() noexcept
+{
+#if defined(RAD_OS_WINDOWS)
+    return std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+#else
+    return std::error_code(errno, std::generic_category());
+#endif
+}
+
+#if defined(RAD_OS_WINDOWS)
+// Closes a handle when leaving scope; the view outlives both the file and the mapping handles.
+struct HandleCloser
+{
+    HANDLE handle;
+    ~HandleCloser() { ::CloseHandle(handle); }
+};
+#endif
+
+} // namespace
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+    std::error_code error;
+    MappedFile mapping(path, error);
+    if (error)
+    {
+        throw std::system_error(error, "MappedFile");
+    }
+    *this = std::move(mapping);
+}
+
+#if defined(RAD_OS_WINDOWS)
+MappedFile::MappedFile(const std::filesystem::path& path, std::error_code& error) noexcept
+{
+    error.clear();
+    const HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ,
+                                      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        error = LastError();
+        return;
+    }
+    const HandleCloser fileCloser{file};
+    LARGE_INTEGER size = {};
+    if (!::GetFileSizeEx(file, &size))
+    {
+        error = LastError();
+        return;
+    }
+    if (static_cast<unsigned long long>(size.QuadPart) > std::numeric_limits<std::size_t>::max())
+    {
+        error = std::make_error_code(std::errc::file_too_large);
+        return;
+    }
+    if (size.QuadPart == 0)
+    {
+        return;
+    }
+    const HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        error = LastError();
+        return;
+    }
+    const HandleCloser mappingCloser{mapping};
+    const void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        error = LastError();
+        return;
+    }
+    m_data = static_cast<const std::byte*>(data);
+    m_size = static_cast<std::size_t>(size.QuadPart);
+}
+
+void MappedFile::Unmap() noexcept
+{
+    if (m_data != nullptr)
+    {
+        ::UnmapViewOfFile(m_data);
+    }
+}
+#else
+MappedFile::MappedFile(const std::filesystem::path& path, std::error_code& error) noexcept
+{
+    error.clear();
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+    {
+        error = LastError();
+        return;
+    }
+    struct stat status = {};
+    if (::fstat(file, &status) != 0)
+    {
+        error = LastError();
+        ::close(file);
+        return;
+    }
+    if (static_cast<std::uintmax_t>(status.st_size) > std::numeric_limits<std::size_t>::max())
+    {
+        error = std::make_error_code(std::errc::file_too_large);
+        ::close(file);
+        return;
+    }
+    const auto size = static_cast<std::size_t>(status.st_size);
+    if (size == 0)
+    {
+        ::close(file);
+        return;
+    }
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping keeps its own reference to the file.
+    ::close(file);
+    if (data == MAP_FAILED)
+    {
+        error = LastError();
+        return;
+    }
+    m_data = static_cast<const std::byte*>(data);
+    m_size = size;
+}
+
+void MappedFile::Unmap() noexcept
+{
+    if (m_data != nullptr)
+    {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+}
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    m_data(std::exchange(other.m_data, nullptr)),
+    m_size(std::exchange(other.m_size, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+} // namespace rad
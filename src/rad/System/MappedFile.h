@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+
+namespace rad
+{
+
+// A read-only memory mapping of a whole file. The kernel reads pages on first access, so callers
+// that only inspect a header read little more than the first page. Empty files map to an empty
+// view. The mapping stays valid after the file is renamed or unlinked.
+class MappedFile
+{
+public:
+    MappedFile() noexcept = default;
+    // Throws std::system_error if the file cannot be opened or mapped.
+    explicit MappedFile(const std::filesystem::path& path);
+    // Reports failures through error and leaves the object empty.
+    MappedFile(const std::filesystem::path& path, std::error_code& error) noexcept;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    [[nodiscard]] const std::byte* Data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t Size() const noexcept { return m_size; }
+    [[nodiscard]] bool Empty() const noexcept { return m_size == 0; }
+
+private:
+    void Unmap() noexcept;
+
+    const std::byte* m_data = nullptr;
+    std::size_t m_size = 0;
+}; // class MappedFile
+
+} // namespace rad
@@ -0,0 +1,48 @@
+#include <rad/System/MappedFile.h>
+#include <rad/System/OS.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+TEST(System, MappedFile)
+{
+    const rad::os::FilePath path = rad::os::temp_directory_path() / "rad-mapped-file.bin";
+    std::string contents(100000, '\0');
+    for (std::size_t index = 0; index < contents.size(); ++index)
+    {
+        contents[index] = static_cast<char>(index * 31);
+    }
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    rad::MappedFile mapping(path);
+    ASSERT_EQ(mapping.Size(), contents.size());
+    EXPECT_EQ(std::memcmp(mapping.Data(), contents.data(), contents.size()), 0);
+
+    // The mapping outlives the file's directory entry and moves without remapping.
+    rad::os::remove(path);
+    const std::byte* data = mapping.Data();
+    rad::MappedFile moved = std::move(mapping);
+    EXPECT_TRUE(mapping.Empty());
+    EXPECT_EQ(moved.Data(), data);
+    EXPECT_EQ(std::memcmp(moved.Data(), contents.data(), contents.size()), 0);
+
+    std::ofstream(path, std::ios::binary).close();
+    const rad::MappedFile empty(path);
+    EXPECT_TRUE(empty.Empty());
+    rad::os::remove(path);
+
+    std::error_code error;
+    const rad::MappedFile missing(path, error);
+    EXPECT_TRUE(error);
+    EXPECT_TRUE(missing.Empty());
+    EXPECT_THROW(rad::MappedFile{path}, std::system_error);
+}
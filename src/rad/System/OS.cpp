@@ -52,6 +52,7 @@ namespace
     ThrowError(std::error_code(errno, std::generic_category()), operation);
 }
 
+#if defined(RAD_OS_WINDOWS)
 [[nodiscard]] FileTime FromTimeT(std::time_t value)
 {
     return std::chrono::system_clock::from_time_t(value);
@@ -63,6 +64,13 @@ namespace
     const auto systemNow = std::chrono::system_clock::now();
     return std::chrono::time_point_cast<FileTime::duration>(value - fileNow + systemNow);
 }
+#else
+[[nodiscard]] FileTime FromTimespec(const struct ::timespec& value)
+{
+    return FileTime{std::chrono::duration_cast<FileTime::duration>(
+        std::chrono::seconds{value.tv_sec} + std::chrono::nanoseconds{value.tv_nsec})};
+}
+#endif
 
 [[nodiscard]] StatResult ReadStat(const FilePath& path, bool followSymlinks)
 {
@@ -103,6 +111,8 @@ namespace
     struct _stat64 nativeStat{};
     if (_wstat64(path.c_str(), &nativeStat) == 0)
     {
+        result.device = static_cast<std::uintmax_t>(nativeStat.st_dev);
+        result.inode = static_cast<std::uintmax_t>(nativeStat.st_ino);
         result.atime = FromTimeT(nativeStat.st_atime);
         result.mtime = FromTimeT(nativeStat.st_mtime);
         result.ctime = FromTimeT(nativeStat.st_ctime);
@@ -124,9 +134,17 @@ namespace
     {
         ThrowErrno(followSymlinks ? "os::stat" : "os::lstat");
     }
-    result.atime = FromTimeT(nativeStat.st_atime);
-    result.mtime = FromTimeT(nativeStat.st_mtime);
-    result.ctime = FromTimeT(nativeStat.st_ctime);
+    result.device = static_cast<std::uintmax_t>(nativeStat.st_dev);
+    result.inode = static_cast<std::uintmax_t>(nativeStat.st_ino);
+#if defined(RAD_OS_MACOS)
+    result.atime = FromTimespec(nativeStat.st_atimespec);
+    result.mtime = FromTimespec(nativeStat.st_mtimespec);
+    result.ctime = FromTimespec(nativeStat.st_ctimespec);
+#else
+    result.atime = FromTimespec(nativeStat.st_atim);
+    result.mtime = FromTimespec(nativeStat.st_mtim);
+    result.ctime = FromTimespec(nativeStat.st_ctim);
+#endif
 #endif
     return result;
 }
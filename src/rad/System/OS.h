@@ -51,6 +51,16 @@ inline constexpr std::string_view linesep = "\n";
 inline const FilePath devnull = "/dev/null";
 #endif
 
+// <unistd.h> defines these names as macros, and standard headers such as <condition_variable>
+// may include it before this header.
+#pragma push_macro("F_OK")
+#pragma push_macro("X_OK")
+#pragma push_macro("W_OK")
+#pragma push_macro("R_OK")
+#undef F_OK
+#undef X_OK
+#undef W_OK
+#undef R_OK
 enum class AccessMode : unsigned int
 {
     F_OK = 0,
@@ -58,6 +68,10 @@ enum class AccessMode : unsigned int
     W_OK = 2,
     R_OK = 4,
 };
+#pragma pop_macro("R_OK")
+#pragma pop_macro("W_OK")
+#pragma pop_macro("X_OK")
+#pragma pop_macro("F_OK")
 
 [[nodiscard]] constexpr AccessMode operator|(AccessMode lhs, AccessMode rhs) noexcept
 {
@@ -70,6 +84,11 @@ struct StatResult
     std::filesystem::perms permissions = std::filesystem::perms::unknown;
     std::uintmax_t size = 0;
     std::uintmax_t hardLinks = 0;
+    // Together identify the file, so a path replaced by another file can be told apart. Windows
+    // reports no inode numbers, leaving inode 0.
+    std::uintmax_t device = 0;
+    std::uintmax_t inode = 0;
+    // As precise as the file system and the clock allow; whole seconds on Windows.
     FileTime atime{};
     FileTime mtime{};
     FileTime ctime{};
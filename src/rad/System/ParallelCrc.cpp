@@ -0,0 +1,45 @@
+#include <rad/System/ParallelCrc.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace rad
+{
+
+namespace detail
+{
+
+Uint64 ComputeCrcSegments(const void* data, std::size_t size, ThreadPool& pool,
+                          std::size_t minSegmentSize, CrcComputeFunction compute,
+                          CrcCombineFunction combine)
+{
+    const std::size_t segmentCount = std::clamp<std::size_t>(
+        size / std::max<std::size_t>(minSegmentSize, 1), 1, pool.GetThreadCount() + 1);
+    if (segmentCount == 1)
+    {
+        return compute(data, size);
+    }
+
+    const auto* bytes = static_cast<const std::byte*>(data);
+    const std::size_t segmentSize = size / segmentCount;
+    const auto segmentSizeOf = [&](std::size_t index)
+    { return (index + 1 == segmentCount) ? size - index * segmentSize : segmentSize; };
+    std::vector<Uint64> partials(segmentCount);
+    pool.ParallelFor(segmentCount,
+                     [&](std::size_t index)
+                     {
+                         partials[index] =
+                             compute(bytes + index * segmentSize, segmentSizeOf(index));
+                     });
+
+    Uint64 crc = partials[0];
+    for (std::size_t index = 1; index < segmentCount; ++index)
+    {
+        crc = combine(crc, partials[index], segmentSizeOf(index));
+    }
+    return crc;
+}
+
+} // namespace detail
+
+} // namespace rad
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <rad/Core/Crc.h>
+#include <rad/System/ThreadPool.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rad
+{
+
+namespace detail
+{
+
+using CrcComputeFunction = Uint64 (*)(const void* data, std::size_t size) noexcept;
+using CrcCombineFunction = Uint64 (*)(Uint64 crcA, Uint64 crcB, std::uint64_t sizeB) noexcept;
+
+// Checksums segments of data with compute on the pool's workers and the calling thread, then
+// folds the partial CRCs in order with combine.
+[[nodiscard]] Uint64 ComputeCrcSegments(const void* data, std::size_t size, ThreadPool& pool,
+                                        std::size_t minSegmentSize, CrcComputeFunction compute,
+                                        CrcCombineFunction combine);
+
+} // namespace detail
+
+// Returns CrcType::Compute(data, size), checksumming segments on the pool's workers and the
+// calling thread and joining them with CrcType::Combine. Inputs too small to give each segment
+// minSegmentSize bytes run serially.
+template <typename CrcType>
+[[nodiscard]] typename CrcType::ValueType ComputeCrcParallel(
+    const void* data, std::size_t size, ThreadPool& pool = GetGlobalThreadPool(),
+    std::size_t minSegmentSize = 1024 * 1024)
+{
+    using ValueType = typename CrcType::ValueType;
+    return static_cast<ValueType>(detail::ComputeCrcSegments(
+        data, size, pool, minSegmentSize,
+        [](const void* segment, std::size_t segmentSize) noexcept -> Uint64
+        { return CrcType::Compute(segment, segmentSize); },
+        [](Uint64 crcA, Uint64 crcB, std::uint64_t sizeB) noexcept -> Uint64
+        {
+            return CrcType::Combine(static_cast<ValueType>(crcA), static_cast<ValueType>(crcB),
+                                    sizeB);
+        }));
+}
+
+} // namespace rad
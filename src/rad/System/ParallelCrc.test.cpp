@@ -0,0 +1,34 @@
+#include <rad/System/ParallelCrc.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST(System, ComputeCrcParallel)
+{
+    std::mt19937 random(9);
+    std::vector<std::uint8_t> data(100'003);
+    for (std::uint8_t& value : data)
+    {
+        value = static_cast<std::uint8_t>(random());
+    }
+
+    rad::ThreadPool pool(3);
+    for (const std::size_t minSegmentSize : {1, 1000, 30'000, 1'000'000})
+    {
+        EXPECT_EQ(rad::ComputeCrcParallel<rad::Crc32>(data.data(), data.size(), pool,
+                                                      minSegmentSize),
+                  rad::Crc32::Compute(data.data(), data.size()));
+        EXPECT_EQ(rad::ComputeCrcParallel<rad::Crc64Xz>(data.data(), data.size(), pool,
+                                                        minSegmentSize),
+                  rad::Crc64Xz::Compute(data.data(), data.size()));
+        EXPECT_EQ(rad::ComputeCrcParallel<rad::Crc16Xmodem>(data.data(), data.size(), pool,
+                                                            minSegmentSize),
+                  rad::Crc16Xmodem::Compute(data.data(), data.size()));
+    }
+    EXPECT_EQ(rad::ComputeCrcParallel<rad::Crc32>(data.data(), 0, pool, 1),
+              rad::Crc32::Compute(data.data(), 0));
+}
@@ -0,0 +1,160 @@
+#include <rad/System/ThreadPool.h>
+
+#include <rad/System/Thread.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace rad
+{
+
+namespace
+{
+
+// Shared by ParallelFor and its helper tasks. Helpers that start after every index has been
+// claimed return without touching task, which may be gone by then.
+struct ParallelForState
+{
+    const std::function<void(std::size_t)>* task;
+    std::size_t count;
+    std::atomic<std::size_t> nextIndex = 0;
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::size_t completedCount = 0;
+    std::exception_ptr exception;
+
+    // Claims and runs indices until none are left.
+    void Run()
+    {
+        std::size_t completed = 0;
+        std::exception_ptr firstException;
+        for (std::size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed); index < count;
+             index = nextIndex.fetch_add(1, std::memory_order_relaxed))
+        {
+            try
+            {
+                (*task)(index);
+            }
+            catch (...)
+            {
+                if (!firstException)
+                {
+                    firstException = std::current_exception();
+                }
+            }
+            ++completed;
+        }
+        if (completed == 0)
+        {
+            return;
+        }
+
+        std::lock_guard lock(mutex);
+        if (firstException && !exception)
+        {
+            exception = firstException;
+        }
+        completedCount += completed;
+        if (completedCount == count)
+        {
+            finished.notify_all();
+        }
+    }
+};
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    m_threads.reserve(threadCount);
+    for (std::size_t index = 0; index < threadCount; ++index)
+    {
+        m_threads.emplace_back(&ThreadPool::WorkerMain, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (count == 1)
+    {
+        task(0);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->task = &task;
+    state->count = count;
+    const std::size_t helperCount = std::min(count - 1, GetThreadCount());
+    for (std::size_t index = 0; index < helperCount; ++index)
+    {
+        Enqueue([state]() { state->Run(); });
+    }
+    state->Run();
+
+    std::unique_lock lock(state->mutex);
+    state->finished.wait(lock, [&]() { return state->completedCount == count; });
+    if (state->exception)
+    {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_condition.notify_one();
+}
+
+void ThreadPool::WorkerMain()
+{
+    static_cast<void>(SetThreadName("rad-worker"));
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+ThreadPool& GetGlobalThreadPool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace rad
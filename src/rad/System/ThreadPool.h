@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rad
+{
+
+// Fixed set of worker threads serving a shared FIFO queue.
+class ThreadPool
+{
+public:
+    // Zero selects std::thread::hardware_concurrency(), or one thread if that is unknown.
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    // Runs the tasks still queued, then joins the workers.
+    ~ThreadPool();
+
+    [[nodiscard]] std::size_t GetThreadCount() const noexcept { return m_threads.size(); }
+
+    // Queues task and returns a future for its result; exceptions are delivered through the
+    // future.
+    template <typename F>
+    [[nodiscard]] std::future<std::invoke_result_t<std::decay_t<F>>> Submit(F&& task)
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        // std::function needs a copyable target.
+        auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packagedTask->get_future();
+        Enqueue([packagedTask]() { (*packagedTask)(); });
+        return future;
+    }
+
+    // Calls task(index) for every index in [0, count) on the workers and the calling thread, and
+    // returns once every call has finished. The calling thread keeps claiming indices while it
+    // waits, so tasks may call ParallelFor themselves. Rethrows the first exception thrown by a
+    // call; the remaining indices still run.
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+    void Enqueue(std::function<void()> task);
+    void WorkerMain();
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::function<void()>> m_tasks;
+    bool m_stopping = false;
+    std::vector<std::thread> m_threads;
+}; // class ThreadPool
+
+// Process-wide pool with one worker per hardware thread, created on first use.
+[[nodiscard]] ThreadPool& GetGlobalThreadPool();
+
+} // namespace rad
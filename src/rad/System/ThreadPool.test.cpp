@@ -0,0 +1,58 @@
+#include <rad/System/ThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+TEST(System, ThreadPool)
+{
+    rad::ThreadPool pool(2);
+    EXPECT_EQ(pool.GetThreadCount(), 2u);
+
+    std::vector<std::future<int>> results;
+    for (int value = 0; value < 100; ++value)
+    {
+        results.push_back(pool.Submit([value]() { return value * value; }));
+    }
+    for (int value = 0; value < 100; ++value)
+    {
+        EXPECT_EQ(results[value].get(), value * value);
+    }
+
+    std::future<void> failed = pool.Submit([]() { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST(System, ThreadPoolParallelFor)
+{
+    rad::ThreadPool pool(3);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.ParallelFor(visits.size(), [&](std::size_t index) { ++visits[index]; });
+    for (const std::atomic<int>& count : visits)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+
+    // Nested loops from every worker must not deadlock on the queue.
+    std::atomic<int> innerCalls = 0;
+    pool.ParallelFor(8, [&](std::size_t)
+                     { pool.ParallelFor(8, [&](std::size_t) { ++innerCalls; }); });
+    EXPECT_EQ(innerCalls.load(), 64);
+
+    std::atomic<int> calls = 0;
+    EXPECT_THROW(pool.ParallelFor(10,
+                                  [&](std::size_t index)
+                                  {
+                                      ++calls;
+                                      if (index == 3)
+                                      {
+                                          throw std::runtime_error("index failed");
+                                      }
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(calls.load(), 10);
+}